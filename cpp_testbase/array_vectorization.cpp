@@ -0,0 +1,138 @@
+/** TEST CASE EXPECTED OUTPUT
+11
+7
+440
+70
+211
+800
+19
+5
+4294967290
+26
+6
+4294967280
+4294967185
+33
+3782626012
+*/
+
+extern void printnum(int);
+
+int a[37];
+int b[37];
+int c[37];
+char small[40];
+
+int sumOf(int n) {
+    // Vectorized sum, with a remainder of n % lanes iterations
+    int s = 0;
+    for (int i = 0; i < n; i = i + 1) {
+        s = s + c[i];
+    }
+    return s;
+}
+
+int main() {
+    // Scalar loops fill the arrays: the induction variable is used as a value
+    for (int i = 0; i < 37; i = i + 1) {
+        a[i] = i * 7 % 13 - 6;
+        b[i] = 20 - i * 3 % 11;
+    }
+
+    // Element-wise add with a loop-invariant operand
+    int n = 37;
+    int bias = 3;
+    for (int i = 0; i < n; i = i + 1) {
+        c[i] = a[i] + b[i] - bias;
+    }
+    printnum(c[0]);
+    printnum(c[36]);
+    printnum(sumOf(n));
+    printnum(sumOf(6));
+
+    // Select between two values
+    for (int i = 0; i < n; i = i + 1) {
+        if (a[i] > b[i] - 20) {
+            c[i] = a[i];
+        } else {
+            c[i] = b[i] - a[i];
+        }
+    }
+    printnum(sumOf(n));
+
+    // Masked store, logical operators and comparisons as values
+    for (int i = 0; i < n; i = i + 1) {
+        if (a[i] == 0 || b[i] < 12 && a[i] >= 2) {
+            c[i] = 100;
+        }
+    }
+    printnum(sumOf(n));
+    for (int i = 0; i < n; i = i + 1) {
+        c[i] = (a[i] < b[i] - 15) + !a[i];
+    }
+    printnum(sumOf(n));
+
+    // Neighbouring elements of an array that is only read
+    for (int i = 0; i < n - 1; i = i + 1) {
+        c[i] = a[i + 1] - a[i];
+    }
+    printnum(sumOf(n - 1));
+
+    // Min, max and a sum reduction in one loop
+    int lowest = 1000;
+    int highest = 0 - 1000;
+    int total = 0;
+    for (int i = 0; i < n; i = i + 1) {
+        if (a[i] < lowest) {
+            lowest = a[i];
+        }
+        if (highest < b[i] - a[i]) {
+            highest = b[i] - a[i];
+        }
+        total = total - a[i];
+    }
+    printnum(lowest);
+    printnum(highest);
+    printnum(total);
+
+    // Local char arrays, indexed with constants and variables
+    char p[40];
+    char q[40];
+    char r[40];
+    p[0] = 5;
+    int k = 1;
+    p[k] = 0 - 7;
+    for (int i = 2; i < 40; i = i + 1) {
+        p[i] = p[i - 1] * 3 + p[i - 2];
+        q[i] = i;
+    }
+    q[0] = 100;
+    q[1] = 0 - 100;
+    printnum(p[2]);
+    printnum(p[k + 38]);
+
+    for (int i = 0; i < 40; i = i + 1) {
+        if (p[i] < q[i]) {
+            r[i] = p[i];
+        } else {
+            r[i] = q[i] + 1;
+        }
+    }
+    char biggest = 0 - 128;
+    for (int i = 0; i < 40; i = i + 1) {
+        if (r[i] > biggest) {
+            biggest = r[i];
+        }
+    }
+    printnum(biggest);
+
+    for (int i = 3; i < 40; i = i + 1) {
+        small[i] = r[i] + p[i];
+    }
+    int check = 0;
+    for (int i = 0; i < 40; i = i + 1) {
+        check = check * 3 + small[i];
+    }
+    printnum(check);
+    return 0;
+}
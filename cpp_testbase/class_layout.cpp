@@ -0,0 +1,73 @@
+/** TEST CASE EXPECTED OUTPUT
+42
+47
+50
+221
+17
+*/
+
+extern void printnum(int);
+
+// As declared: 1 + 3 + 4 + 1 + 7 + 8 + 4 + 4 = 32 bytes, 24 once reordered
+class [[zpp::reorder]] Particle {
+    char tag;
+    int x;
+    char flags;
+    char *name;
+    int y;
+};
+
+// Kept as declared: 4 + 4 + 1 + 3 = 12 bytes
+class Point {
+    int x;
+    int y;
+    char visible;
+};
+
+class Segment {
+    Point from;
+    char kind;
+    Point to;
+};
+
+int length(int steps) {
+    Segment segment;
+    segment.from.x = 1;
+    segment.from.y = 2;
+    segment.to.x = 10;
+    segment.to.y = 20;
+    segment.kind = 3;
+    int i = 0;
+    while (i < steps) {
+        segment.from.x = segment.from.x + segment.kind;
+        segment.to.y = segment.to.y - 1;
+        i = i + 1;
+    }
+    return (segment.to.x - segment.from.x) * 100 + segment.to.y;
+}
+
+int main() {
+    Particle particle;
+    particle.tag = 7;
+    particle.x = 40;
+    particle.flags = 2;
+    particle.y = particle.x + particle.tag;
+    printnum(particle.x + particle.flags);
+    printnum(particle.y);
+
+    Point point;
+    point.x = 5;
+    point.y = 6;
+    point.visible = 1;
+    int sum = 0;
+    int i = 0;
+    while (i < 10) {
+        point.x = point.x + i;
+        sum = sum + point.x * point.visible;
+        i = i + 1;
+    }
+    printnum(point.x);
+    printnum(sum + point.y);
+    printnum(length(3));
+    return 0;
+}
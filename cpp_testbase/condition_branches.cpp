@@ -0,0 +1,30 @@
+/** TEST CASE EXPECTED OUTPUT
+1000
+1
+0
+3
+*/
+
+extern void printnum(int);
+
+int main() {
+    int count = 0;
+    while (count < 1000) {
+        count = count + 1;
+    }
+    printnum(count);
+
+    int isBig = count > 999;
+    int isSmall = count <= 10;
+    printnum(isBig);
+    printnum(isSmall);
+
+    int hits = 0;
+    for (int i = 0; i != 3; i = i + 1) {
+        if (i >= 0) {
+            hits = hits + 1;
+        }
+    }
+    printnum(hits);
+    return 0;
+}
@@ -0,0 +1,92 @@
+/** TEST CASE EXPECTED OUTPUT
+4294967292
+17
+30
+30
+4
+44
+4294967295
+1899
+904
+*/
+
+extern void printnum(int);
+
+int main() {
+    int a = 17;
+    int b = 0 - 4;
+    int m = 0;
+
+    // min / max diamonds become cmp + cmov
+    if (a < b) {
+        m = a;
+    } else {
+        m = b;
+    }
+    printnum(m);
+    if (a > b) {
+        m = a;
+    } else {
+        m = b;
+    }
+    printnum(m);
+
+    // Without an else the current value is kept
+    int clamped = a + 20;
+    if (clamped > 30) {
+        clamped = 30;
+    }
+    printnum(clamped);
+    if (clamped < 0) {
+        clamped = 0;
+    }
+    printnum(clamped);
+
+    // Absolute value, with an expression arm
+    int abs = b;
+    if (b < 0) {
+        abs = 0 - b;
+    }
+    printnum(abs);
+
+    // Narrow variables are selected in int registers
+    char c = 5;
+    if (a) {
+        c = 300;
+    }
+    printnum(c);
+
+    // A division that could trap is never speculated
+    int divisor = 0;
+    int q = 0;
+    if (divisor != 0) {
+        q = a / divisor;
+    } else {
+        q = 0 - 1;
+    }
+    printnum(q);
+
+    // Expensive arms keep the branch
+    int total = 0;
+    for (int i = 0; i < 10; i = i + 1) {
+        if (i % 3 == 0) {
+            total = total + i * 7 * a + b * i * 3;
+        } else {
+            total = total - i;
+        }
+    }
+    printnum(total);
+
+    // Selects in a loop with data dependent conditions
+    int best = 0;
+    int x = 12345;
+    for (int k = 0; k < 20; k = k + 1) {
+        x = x * 1103 + 12345;
+        int v = x % 1000;
+        if (v > best) {
+            best = v;
+        }
+    }
+    printnum(best);
+    return 0;
+}
@@ -0,0 +1,107 @@
+/** TEST CASE EXPECTED OUTPUT
+3628800
+111
+4294967240
+31
+3628911
+3000000
+42
+3629
+*/
+
+extern void printnum(int);
+
+constexpr int factorial10() {
+    int product = 1;
+    for (int i = 2; i <= 10; i = i + 1) {
+        product = product * i;
+    }
+    return product;
+}
+
+constexpr int collatzSteps() {
+    int n = 27;
+    int steps = 0;
+    while (n != 1) {
+        if (n % 2 == 0) {
+            n = n / 2;
+        } else {
+            n = 3 * n + 1;
+        }
+        steps = steps + 1;
+    }
+    return steps;
+}
+
+// Stores into a char wrap around to its low byte
+constexpr char wrapped() {
+    char c = 100;
+    c = c + 100;
+    return c;
+}
+
+constexpr int fallThrough() {
+    int r = 0;
+    switch (3) {
+        case 1:
+            r = 10;
+            break;
+        case 3:
+            r = 30;
+        case 4:
+            r = r + 1;
+            break;
+        default:
+            r = 99;
+    }
+    return r;
+}
+
+// Nested constexpr calls are evaluated as well
+constexpr int sumOfBoth() {
+    return factorial10() + collatzSteps();
+}
+
+// Past the step limit: left to the runtime
+constexpr int spin() {
+    int i = 0;
+    while (i < 3000000) {
+        i = i + 1;
+    }
+    return i;
+}
+
+// A division that would trap is kept as a call
+constexpr int divideByZero() {
+    int zero = 0;
+    return 1 / zero;
+}
+
+// Past the recursion limit: kept, and never reached
+constexpr int forever() {
+    return forever() + 1;
+}
+
+int notConstexpr() {
+    return 42;
+}
+
+int main() {
+    printnum(factorial10());
+    printnum(collatzSteps());
+    printnum(wrapped());
+    printnum(fallThrough());
+    printnum(sumOfBoth());
+    printnum(spin());
+    printnum(notConstexpr());
+
+    int zero = 0;
+    if (zero) {
+        printnum(divideByZero());
+        printnum(forever());
+    }
+
+    int x = factorial10() / 1000 + 1;
+    printnum(x);
+    return 0;
+}
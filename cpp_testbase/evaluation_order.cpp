@@ -0,0 +1,48 @@
+/** TEST CASE EXPECTED OUTPUT
+11
+1627
+147
+220
+513
+14
+0
+0
+*/
+
+extern void printnum(int);
+
+int main() {
+    int a = 3;
+    int b = 7;
+    int c = 11;
+    int d = 13;
+    int e = 17;
+
+    // Right-leaning trees: the deeper rhs is evaluated first
+    int r = a - (b - (c - (d - e)));
+    printnum(r);
+    r = a + (b * (c + (d * e)));
+    printnum(r);
+    r = a - (b * c - d * e);
+    printnum(r);
+
+    // Balanced and mixed trees
+    r = (a + b) * (c - d) - (d + e) * (a - c);
+    printnum(r);
+    r = (a * b + c) - (d * (e - a * (b + c)));
+    printnum(r);
+
+    // Hardware division with a deeper divisor
+    r = (e * d) / (b - (a - c));
+    printnum(r);
+    r = (e * d * c) % (a + (b * (c - d)));
+    printnum(r);
+
+    // Comparisons with a deeper rhs
+    r = a < (b * (c - (d + e)));
+    printnum(r);
+    if (a + b > c - (d - (e + a))) {
+        printnum(1);
+    }
+    return 0;
+}
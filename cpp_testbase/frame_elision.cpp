@@ -0,0 +1,41 @@
+/** TEST CASE EXPECTED OUTPUT
+7
+9
+12
+*/
+
+extern void printnum(int);
+
+int constant() {
+    return 42;
+}
+
+int early() {
+    if (0) {
+        return 1;
+    }
+    int a = 4;
+    int b = 5;
+    printnum(a + b);
+    return 0;
+}
+
+int leaf() {
+    int a = 3;
+    int b = 9;
+    if (b) {
+        return a + b;
+    }
+    return 0;
+}
+
+int main() {
+    constant();
+    int seven = 7;
+    printnum(seven);
+    early();
+    int twelve = 3 + 9;
+    leaf();
+    printnum(twelve);
+    return 0;
+}
@@ -0,0 +1,90 @@
+/** TEST CASE EXPECTED OUTPUT
+42
+610
+204
+346
+22
+45
+299
+420
+67
+115
+*/
+
+extern void printnum(int);
+
+// Read in place: a and b stay in edi and esi
+int add(int a, int b) {
+    return a + b;
+}
+
+// n is needed after the calls, which overwrite edi: it moves to a register that survives them
+[[gnu::noinline]] int fib(int n) {
+    if (n < 2) {
+        return n;
+    }
+    return fib(n - 1) + fib(n - 2);
+}
+
+// Arguments past the sixth arrive on the stack
+[[gnu::noinline]] int weighted(int a, int b, int c, int d, int e, int f, int g, int h) {
+    return a + 2 * b + 3 * c + 4 * d + 5 * e + 6 * f + 7 * g + 8 * h;
+}
+
+[[gnu::noinline]] int narrow(char a, int b, int c, int d, int e, int f, char g, int h, char i) {
+    return a * 100 + g * 10 + i + h - b - c - d - e - f;
+}
+
+// A parameter written by the body
+[[gnu::noinline]] int countdown(int n, int step) {
+    int total = 0;
+    while (n > 0) {
+        total = total + n;
+        n = n - step;
+    }
+    return total;
+}
+
+// The early exit reads x where the caller left it
+[[gnu::noinline]] int clamp(int x, int low, int high) {
+    if (x < low) {
+        return low;
+    }
+    if (x > high) {
+        return high;
+    }
+    return x;
+}
+
+// Stack arguments computed by calls, with live registers around
+[[gnu::noinline]] int nested(int x) {
+    int y = x * 3;
+    int r = weighted(x, y, add(x, y), fib(x), 1, 2, add(y, 1), fib(y - 10));
+    return r + y;
+}
+
+// Every register is busy when the stack arguments are computed: a spill pushed meanwhile moves the argument area
+[[gnu::noinline]] int crowded(int p, int q) {
+    int a = p + 1;
+    int b = p + 2;
+    int c = p + 3;
+    int d = p + 4;
+    int e = p + 5;
+    int r = (a < q) + weighted(p, q, a, b, c, d, (e < q), (q < a));
+    return r + a + b + c + d + e;
+}
+
+int main() {
+    printnum(add(40, 2));
+    printnum(fib(15));
+    printnum(weighted(1, 2, 3, 4, 5, 6, 7, 8));
+    printnum(narrow(3, 1, 1, 1, 1, 1, 4, 5, 6));
+    printnum(countdown(10, 3));
+    printnum(clamp(5, 10, 20) + clamp(15, 10, 20) + clamp(25, 10, 20));
+    printnum(nested(5));
+    int k = 7;
+    printnum(weighted(k, k + 1, k + 2, k + 3, k + 4, k + 5, k + 6, k + 7));
+    printnum(crowded(0, 1));
+    printnum(crowded(1, 9));
+    return 0;
+}
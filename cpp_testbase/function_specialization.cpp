@@ -0,0 +1,77 @@
+/** TEST CASE EXPECTED OUTPUT
+210
+100
+100
+5
+42
+1766
+45
+9
+*/
+
+extern void printnum(int);
+
+// Parameters never read: call sites passing values without side effects call a clone without them
+[[gnu::noinline]] int scaled(int unused, int alsoUnused) {
+    int r = 7;
+    r = r * 6;
+    return r;
+}
+
+[[gnu::noinline]] void banner(int level) {
+    printnum(100);
+}
+
+int ticks() {
+    printnum(5);
+    return 2;
+}
+
+// Large enough to stay a call
+int mix(int seed) {
+    int h = 17;
+    for (int i = 0; i < 4; i = i + 1) {
+        h = h * 31 + i;
+        h = h % 1000;
+    }
+    return h;
+}
+
+// Both parameters read as literals in the clone: their product is folded
+[[gnu::noinline]] int product(int a, int b) {
+    int r = a * b;
+    for (int i = 0; i < 3; i = i + 1) {
+        r = r + i;
+    }
+    return r;
+}
+
+// A written parameter stays a parameter: no clone for the constant step
+[[gnu::noinline]] int bump(int a, int step) {
+    step = step + 1;
+    return a + step;
+}
+
+int main() {
+    int total = 0;
+    for (int i = 0; i < 5; i = i + 1) {
+        total = total + scaled(i, 3);
+    }
+    printnum(total);
+
+    banner(1);
+    banner(2);
+
+    // The first argument runs for its output: only the second one is dropped
+    printnum(scaled(ticks(), 1));
+
+    printnum(mix(total) + mix(9));
+
+    printnum(product(6, 7));
+    int x = 3;
+    for (int i = 0; i < 2; i = i + 1) {
+        x = bump(x, 2);
+    }
+    printnum(x);
+    return 0;
+}
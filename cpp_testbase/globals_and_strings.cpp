@@ -0,0 +1,80 @@
+/** TEST CASE EXPECTED OUTPUT
+Hello, world
+world
+world
+ld
+A literal longer than one sixteen byte block
+
+129
+30
+13
+3
+23
+104
+*/
+
+extern void print(char *str);
+extern void printnum(int);
+
+// Zero-initialized: .bss
+int counter;
+// Initialized: .data
+int base = 10;
+char sign = 0 - 2;
+// Constants: .rodata, and folded into the code that reads them
+const int scale = 3;
+constexpr int limit = scale * 4 + 1;
+// The address of a pooled literal, stored in .data
+char *greeting = "Hello, world\n";
+
+class Point {
+    int x;
+    char tag;
+    int y;
+};
+
+Point origin;
+
+[[gnu::noinline]] void bump() {
+    counter = counter + base;
+}
+
+int readBase() {
+    return base;
+}
+
+// Writes the global: a caller with a local of the same name keeps the call
+void resetBase() {
+    base = 4;
+}
+
+int main() {
+    print(greeting);
+    // Same contents, and a suffix of the greeting: no new bytes
+    print("world\n");
+    print("world\n");
+    print("ld\n");
+    print("A literal longer than one sixteen byte block\n");
+
+    // The callee writes counter on every iteration: counter * 2 is not a loop invariant
+    int total = 0;
+    while (counter < 25) {
+        bump();
+        total = total + counter * 2 + scale;
+    }
+    printnum(total);
+    printnum(counter);
+
+    printnum(limit);
+    printnum(sign + 5);
+
+    origin.x = 7;
+    origin.tag = 2;
+    origin.y = origin.x * scale + origin.tag;
+    printnum(origin.y);
+
+    int base = 100;
+    resetBase();
+    printnum(readBase() + base);
+    return 0;
+}
@@ -0,0 +1,78 @@
+/** TEST CASE EXPECTED OUTPUT
+42
+105
+42
+716
+7
+12
+1045
+*/
+
+extern void printnum(int);
+
+// The input is loaded in edi, the output stored from eax
+[[gnu::noinline]] int triple(int x) {
+    int result = 0;
+    asm("\tlea eax, [rdi+rdi*2]\n" : "=eax"(result) : "edi"(x));
+    return result;
+}
+
+// Read and written by the block
+[[gnu::noinline]] int bump(int x) {
+    asm("\tadd ecx, 100\n" : "+ecx"(x));
+    return x;
+}
+
+// a arrives in edi and b in esi: binding them the other way round swaps them
+[[gnu::noinline]] int difference(int a, int b) {
+    int result = 0;
+    asm("\tmov eax, esi\n\tsub eax, edi\n" : "=eax"(result) : "esi"(a), "edi"(b));
+    return result;
+}
+
+// sum lives across both blocks: only the declared clobbers are avoided, rbx is saved by the prologue
+[[gnu::noinline]] int keep(int a, int b) {
+    int sum = a + b;
+    int scratch = 0;
+    asm("\tmov edx, 7\n\tmov r8d, 9\n\tmov eax, edx\n\tadd eax, r8d\n" : "=eax"(scratch) : : "rdx", "r8", "cc");
+    asm("\tmov ebx, 1000\n" : : : "rbx");
+    return sum * 100 + scratch;
+}
+
+// A narrow output is sign-extended like any char
+[[gnu::noinline]] int narrow() {
+    char c = 0;
+    asm("\tmov al, -3\n" : "=al"(c));
+    return c + 10;
+}
+
+[[gnu::noinline]] int outputs() {
+    int x = 0;
+    int y = 0;
+    asm("\tmov eax, 1\n\tmov ecx, 2\n" : "=eax"(x), "=ecx"(y));
+    return x * 10 + y;
+}
+
+// The loop counter and the total stay in registers across the block
+[[gnu::noinline]] int loop(int n) {
+    int total = 0;
+    int i = 0;
+    while (i < n) {
+        int step = 0;
+        asm("\tmov eax, 11\n" : "=eax"(step));
+        total = total + step * i;
+        i = i + 1;
+    }
+    return total;
+}
+
+int main() {
+    printnum(triple(14));
+    printnum(bump(5));
+    printnum(difference(50, 8));
+    printnum(keep(3, 4));
+    printnum(narrow());
+    printnum(outputs());
+    printnum(loop(10) + 550);
+    return 0;
+}
@@ -0,0 +1,89 @@
+/** TEST CASE EXPECTED OUTPUT
+42
+42
+42
+200
+11
+1
+2
+1000
+2000
+3000
+200
+200
+200
+3
+*/
+
+extern void printnum(int);
+
+// Small enough to be expanded at every call site
+void report() {
+    int x = 7;
+    printnum(x * 6);
+}
+
+// Expanded with its own calls already expanded
+inline void reportTwice() {
+    report();
+    report();
+}
+
+// Early returns leave the expanded body, not the caller
+int classify() {
+    int a = 3;
+    int b = 8;
+    if (a > b) {
+        printnum(100);
+        return 1;
+    }
+    if (b - a == 5) {
+        printnum(200);
+        return 2;
+    }
+    printnum(300);
+    return 3;
+}
+
+// Parameters are still evaluated, in order, in the caller's scope
+void consume(int a, int b) {
+    int c = 11;
+    printnum(c);
+}
+
+[[gnu::noinline]] void outOfLine() {
+    printnum(1000);
+}
+
+// Inline asm stays out of line unless forced
+void withAsm() {
+    asm("nop");
+    printnum(2000);
+}
+
+[[gnu::always_inline]] inline void forcedAsm() {
+    asm("nop");
+    printnum(3000);
+}
+
+int main() {
+    report();
+    reportTwice();
+    classify();
+    int a = 1;
+    int b = 2;
+    consume(b, a);
+    printnum(a);
+    printnum(b);
+    outOfLine();
+    withAsm();
+    forcedAsm();
+
+    int sum = 0;
+    for (int i = 0; i < 3; i = i + 1) {
+        classify();
+        sum = sum + i;
+    }
+    printnum(sum);
+    return 0;
+}
@@ -0,0 +1,68 @@
+/** TEST CASE EXPECTED OUTPUT
+1
+0
+1
+20
+44
+4294967240
+1
+4294967240
+4294967259
+44
+112
+112
+2147483648
+1
+*/
+
+extern void printnum(int);
+
+int main() {
+    // Negative ints compare as signed
+    int negative = 0 - 5;
+    int positive = 3;
+    int r = negative < positive;
+    printnum(r);
+    r = negative > positive;
+    printnum(r);
+    if (negative < 0) {
+        printnum(1);
+    }
+    int count = 0;
+    for (int i = 0 - 10; i < 10; i = i + 1) {
+        count = count + 1;
+    }
+    printnum(count);
+
+    // char is signed and promoted to int before arithmetic
+    char small = 100;
+    char wrapped = 200;
+    r = small + wrapped;
+    printnum(r);
+    r = wrapped;
+    printnum(r);
+    r = wrapped < small;
+    printnum(r);
+    char sum = small + small;
+    printnum(sum);
+    r = sum * 2 / 3;
+    printnum(r);
+
+    // Conversions when assigning
+    char c = 0;
+    r = c = 300;
+    printnum(r);
+    int big = 70000;
+    c = big;
+    printnum(c);
+    int back = c;
+    printnum(back);
+
+    // 32-bit wrap-around
+    int max = 2147483647;
+    r = max + 1;
+    printnum(r);
+    r = max + 1 < max;
+    printnum(r);
+    return 0;
+}
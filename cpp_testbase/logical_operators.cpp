@@ -0,0 +1,141 @@
+/** TEST CASE EXPECTED OUTPUT
+1
+3
+4
+6
+7
+8
+10
+1
+0
+0
+1
+0
+3
+11
+7
+21
+0
+100
+300
+500
+12
+13
+100
+21
+42
+53
+74
+99
+0
+0
+0
+1
+15
+*/
+
+extern void printnum(int);
+
+// Seven parameters and two locals in registers: the divisions inside the chains borrow registers, and every path out of
+// a chain has to give them back
+[[gnu::noinline]] int crowdedLogic(int p0, int p1, int p2, int p3, int p4, int p5, int p6) {
+    int total = 0;
+    for (int i = 0; i < 4; i = i + 1) {
+        int v0 = p0 - i;
+        int v1 = p1 + i;
+        if ((p2 % (p3 % 5 + 6)) && (p4 * p5) / (p6 % 5 + 6) || i == 3) {
+            total = total + (((v1 && p5) + (v0 && 7)) * 10 + (p2 % (p4 % 5 + 6) || (p3 / (v0 % 5 + 6)) && p6));
+        }
+        printnum(total);
+        p0 = p0 + (p6 > i) - (p1 % 3);
+        p4 = p4 + (v0 || v1) * 2;
+    }
+    return total + p0 + p4;
+}
+
+int main() {
+    int a = 5;
+    int b = 0;
+    int c = 0 - 3;
+    int zero = 0;
+
+    // Conditions lower to jump chains
+    if (a > 0 && c < 0) {
+        printnum(1);
+    }
+    if (b != 0 && a / b > 1) {
+        printnum(2);
+    } else {
+        printnum(3);
+    }
+    if (zero == 0 || a / zero > 1) {
+        printnum(4);
+    }
+    if (!(a > 3) || b) {
+        printnum(5);
+    } else {
+        printnum(6);
+    }
+    if (!b && !(c > 0)) {
+        printnum(7);
+    }
+
+    // Precedence: && binds tighter than ||
+    if (b || a == 5 && c == 0 - 3) {
+        printnum(8);
+    }
+    if ((b || a == 5) && c > 0) {
+        printnum(9);
+    } else {
+        printnum(10);
+    }
+
+    // Values are materialized as 0 or 1
+    int x = a && c;
+    printnum(x);
+    x = a && b;
+    printnum(x);
+    x = b || zero;
+    printnum(x);
+    x = b || c;
+    printnum(x);
+    x = !a;
+    printnum(x);
+    x = !b + !zero + !!a;
+    printnum(x);
+    x = (a > 4 && c < 0) + (a < 4 || b == 0) * 10;
+    printnum(x);
+
+    // Loops
+    int i = 0;
+    int sum = 0;
+    while (i < 10 && sum < 20) {
+        sum = sum + i;
+        i = i + 1;
+    }
+    printnum(i);
+    printnum(sum);
+    for (int j = 0; !(j >= 6) || j == 8; j = j + 1) {
+        if (!(j == 2 || j == 4)) {
+            printnum(j * 100);
+        }
+    }
+
+    // Right operand side effects only happen when reached
+    int count = 0;
+    if (b && (count = count + 1)) {
+        printnum(11);
+    }
+    if (a || (count = count + 10)) {
+        printnum(12);
+    }
+    if (a && (count = count + 100)) {
+        printnum(13);
+    }
+    printnum(count);
+
+    printnum(crowdedLogic(2, 1, 15, 4, 15, 4, 16));
+    printnum(crowdedLogic(0, 0, 0, 13, 4, 0, 6));
+
+    return 0;
+}
@@ -0,0 +1,76 @@
+/** TEST CASE EXPECTED OUTPUT
+715
+234
+63
+32
+110
+5
+7
+*/
+
+extern void printnum(int);
+
+// Bounds and scales computed once, before the loops
+int main() {
+    int n = 6;
+    int scale = 3;
+    int offset = 10;
+
+    int i = 0;
+    int sum = 0;
+    while (i < n * 2 - 1) {
+        sum = sum + i * (scale + offset);
+        i = i + 1;
+    }
+    printnum(sum);
+
+    int total = 0;
+    for (int j = 0; j < n + n; j = j + 1) {
+        total = total + (offset - scale) * 2 + j;
+    }
+    printnum(total);
+
+    // The body runs once before the condition is tested
+    int k = 0;
+    do {
+        k = k + scale * scale;
+    } while (k < n * offset);
+    printnum(k);
+
+    // Values invariant in the inner loop only stay in the outer one
+    int acc = 0;
+    for (int a = 0; a < 4; a = a + 1) {
+        for (int b = 0; b < n - 2; b = b + 1) {
+            acc = acc + a * scale + (n - offset) + b;
+        }
+    }
+    printnum(acc);
+
+    // Written in the loop: recomputed on every iteration
+    int step = 1;
+    int walked = 0;
+    while (walked < 100) {
+        walked = walked + step * 2;
+        step = step + 1;
+    }
+    printnum(walked);
+
+    // The loop never runs, the division by zero must not be moved before it
+    int zero = 0;
+    int guarded = 5;
+    while (zero > 0) {
+        guarded = guarded + n / zero;
+    }
+    printnum(guarded);
+
+    // A condition invariant for the loop, the body can still leave it
+    int count = 0;
+    while (scale < offset && n > 0) {
+        count = count + 1;
+        if (count == 7) {
+            break;
+        }
+    }
+    printnum(count);
+    return 0;
+}
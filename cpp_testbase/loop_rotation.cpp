@@ -0,0 +1,62 @@
+/** TEST CASE EXPECTED OUTPUT
+0
+1
+2
+3
+4
+5
+120
+35
+21
+*/
+
+extern void printnum(int);
+
+int main() {
+    // Never entered: the entry test skips the body
+    int never = 0;
+    int zero = 0;
+    while (zero > 0) {
+        never = never + 1;
+    }
+    for (int i = 10; i < 5; i = i + 1) {
+        never = never + 1;
+    }
+    printnum(never);
+
+    // The condition runs once more than the body, side effects included
+    int tests = 0;
+    int left = 4;
+    while ((tests = tests + 1) <= left) {
+        printnum(tests);
+    }
+    printnum(tests);
+
+    // Known to be entered: no entry test, the bottom test decides
+    int product = 1;
+    for (int i = 1; i <= 5; i = i + 1) {
+        product = product * i;
+    }
+    printnum(product);
+
+    // Breaks leave from the middle of the rotated body
+    int n = 0;
+    while (n < 100) {
+        n = n + 7;
+        if (n % 5 == 0) {
+            break;
+        }
+    }
+    printnum(n);
+
+    // Without a condition, the bottom of the body jumps back unconditionally
+    int spins = 0;
+    for (int i = 0; ; i = i + 1) {
+        spins = spins + i;
+        if (i == 6) {
+            break;
+        }
+    }
+    printnum(spins);
+    return 0;
+}
@@ -0,0 +1,121 @@
+/** TEST CASE EXPECTED OUTPUT
+55
+5
+0
+1
+3
+6
+10
+15
+21
+28
+36
+45
+55
+144
+2180
+6765
+15
+17
+2147483646
+7
+5
+*/
+
+extern void printnum(int);
+
+int main() {
+    // Small constant trip count: fully unrolled, without any test
+    int squares = 0;
+    for (int i = 0; i < 6; i = i + 1) {
+        squares = squares + i * i;
+    }
+    printnum(squares);
+
+    // Breaks still leave the unrolled copies
+    int found = 0;
+    for (int i = 1; i <= 8; i = i + 1) {
+        if (i * 3 > 14) {
+            found = i;
+            break;
+        }
+    }
+    printnum(found);
+
+    // Unknown trip counts, below, equal to and above the factor
+    for (int n = 0; n < 11; n = n + 1) {
+        int sum = 0;
+#pragma unroll 4
+        for (int i = 0; i < n; i = i + 1) {
+            sum = sum + i + 1;
+        }
+        printnum(sum);
+    }
+
+    // Step larger than one, inclusive bound
+    int limit = 23;
+    int odd = 0;
+#pragma unroll 3
+    for (int i = 1; i <= limit; i = i + 2) {
+        odd = odd + i;
+    }
+    printnum(odd);
+
+    // Counting down
+    int start = 20;
+    int down = 0;
+#pragma GCC unroll 8
+    for (int i = start; i >= 0; i = i - 3) {
+        down = down * 2 + i;
+    }
+    printnum(down);
+
+    // Full unrolling asked for more iterations than the size limit allows by default
+    int fib = 0;
+    int next = 1;
+#pragma unroll
+    for (int i = 0; i < 20; i = i + 1) {
+        int sum = fib + next;
+        fib = next;
+        next = sum;
+    }
+    printnum(fib);
+
+    // No unrolling at all
+    int kept = 0;
+#pragma unroll 1
+    for (int i = 0; i < 3; i = i + 1) {
+        kept = kept + 5;
+    }
+    printnum(kept);
+
+    // Other pragmas are ignored
+#pragma ivdep
+    for (int i = 0; i < 2; i = i + 1) {
+        kept = kept + 1;
+    }
+    printnum(kept);
+
+    // Near the end of the int range: the test of the last copy must not overflow
+    int last = 0;
+    int count = 0;
+#pragma unroll 4
+    for (int i = 2147483640; i < 2147483647; i = i + 1) {
+        last = i;
+        count = count + 1;
+    }
+    printnum(last);
+    printnum(count);
+
+    // The bound changes in the body: the tests can not be skipped
+    int bound = 10;
+    int steps = 0;
+#pragma unroll 4
+    for (int i = 0; i < bound; i = i + 1) {
+        bound = bound - 1;
+        steps = steps + 1;
+    }
+    printnum(steps);
+
+    return 0;
+}
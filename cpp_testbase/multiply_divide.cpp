@@ -0,0 +1,718 @@
+/** TEST CASE EXPECTED OUTPUT
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+1
+0
+0
+1
+0
+1
+0
+1
+0
+1
+0
+1
+0
+1
+0
+1
+0
+1
+0
+1
+0
+1
+0
+1
+0
+1
+0
+1
+0
+1
+0
+1
+0
+1
+0
+1
+7
+0
+3
+1
+2
+1
+1
+3
+1
+2
+1
+1
+1
+0
+0
+7
+0
+7
+0
+7
+0
+7
+0
+7
+0
+7
+0
+7
+0
+7
+0
+7
+2
+1
+4294967294
+1
+100
+0
+50
+0
+33
+1
+25
+0
+20
+0
+16
+4
+14
+2
+12
+4
+10
+0
+6
+4
+4
+0
+0
+100
+0
+100
+0
+100
+0
+100
+0
+100
+33
+1
+4294967263
+1
+2147483647
+0
+1073741823
+1
+715827882
+1
+536870911
+3
+429496729
+2
+357913941
+1
+306783378
+1
+268435455
+7
+214748364
+7
+134217727
+15
+85899345
+22
+17179869
+22
+3350208
+319
+2147483
+647
+32767
+65535
+1
+0
+715827882
+1
+3579139414
+1
+4294967295
+0
+0
+4294967295
+0
+4294967295
+0
+4294967295
+0
+4294967295
+0
+4294967295
+0
+4294967295
+0
+4294967295
+0
+4294967295
+0
+4294967295
+0
+4294967295
+0
+4294967295
+0
+4294967295
+0
+4294967295
+0
+4294967295
+0
+4294967295
+0
+4294967295
+0
+4294967295
+4294967289
+0
+4294967293
+4294967295
+4294967294
+4294967295
+4294967295
+4294967293
+4294967295
+4294967294
+4294967295
+4294967295
+4294967295
+0
+0
+4294967289
+0
+4294967289
+0
+4294967289
+0
+4294967289
+0
+4294967289
+0
+4294967289
+0
+4294967289
+0
+4294967289
+0
+4294967289
+4294967294
+4294967295
+2
+4294967295
+4294967196
+0
+4294967246
+0
+4294967263
+4294967295
+4294967271
+0
+4294967276
+0
+4294967280
+4294967292
+4294967282
+4294967294
+4294967284
+4294967292
+4294967286
+0
+4294967290
+4294967292
+4294967292
+0
+0
+4294967196
+0
+4294967196
+0
+4294967196
+0
+4294967196
+0
+4294967196
+4294967263
+4294967295
+33
+4294967295
+2147483648
+0
+3221225472
+0
+3579139414
+4294967294
+3758096384
+0
+3865470567
+4294967293
+3937053355
+4294967294
+3988183918
+4294967294
+4026531840
+0
+4080218932
+4294967288
+4160749568
+0
+4209067951
+4294967273
+4277787427
+4294967273
+4291617088
+4294966976
+4292819813
+4294966648
+4294934528
+0
+4294967295
+4294967295
+3579139414
+4294967294
+715827882
+4294967294
+0
+0
+7
+7
+14
+14
+21
+21
+35
+35
+63
+63
+70
+70
+84
+84
+126
+126
+168
+168
+280
+280
+504
+504
+700
+700
+7000
+7000
+458752
+458752
+49
+49
+4294967275
+0
+0
+4294967289
+4294967289
+4294967282
+4294967282
+4294967275
+4294967275
+4294967261
+4294967261
+4294967233
+4294967233
+4294967226
+4294967226
+4294967212
+4294967212
+4294967170
+4294967170
+4294967128
+4294967128
+4294967016
+4294967016
+4294966792
+4294966792
+4294966596
+4294966596
+4294960296
+4294960296
+4294508544
+4294508544
+4294967247
+4294967247
+21
+0
+0
+2147483647
+2147483647
+4294967294
+4294967294
+2147483645
+2147483645
+2147483643
+2147483643
+2147483639
+2147483639
+4294967286
+4294967286
+4294967284
+4294967284
+4294967278
+4294967278
+4294967272
+4294967272
+4294967256
+4294967256
+4294967224
+4294967224
+4294967196
+4294967196
+4294966296
+4294966296
+4294901760
+4294901760
+2147483641
+2147483641
+2147483651
+0
+0
+2147483648
+2147483648
+0
+0
+2147483648
+2147483648
+2147483648
+2147483648
+2147483648
+2147483648
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+0
+2147483648
+2147483648
+2147483648
+5
+6
+3
+*/
+
+extern void printnum(int);
+
+int main() {
+    int zero = 0;
+    int one = 1;
+    int seven = 7;
+    int hundred = 100;
+    int max = 2147483647;
+    int negOne = 0 - 1;
+    int negSeven = 0 - 7;
+    int negHundred = 0 - 100;
+    int min = 0 - 2147483647 - 1;
+    int three = 3;
+    int negThree = 0 - 3;
+    int r = 0;
+
+    // Division and modulo by constants (magic numbers, shifts) and by variables (idiv)
+    r = zero / 1; printnum(r); r = zero % 1; printnum(r);
+    r = zero / 2; printnum(r); r = zero % 2; printnum(r);
+    r = zero / 3; printnum(r); r = zero % 3; printnum(r);
+    r = zero / 4; printnum(r); r = zero % 4; printnum(r);
+    r = zero / 5; printnum(r); r = zero % 5; printnum(r);
+    r = zero / 6; printnum(r); r = zero % 6; printnum(r);
+    r = zero / 7; printnum(r); r = zero % 7; printnum(r);
+    r = zero / 8; printnum(r); r = zero % 8; printnum(r);
+    r = zero / 10; printnum(r); r = zero % 10; printnum(r);
+    r = zero / 16; printnum(r); r = zero % 16; printnum(r);
+    r = zero / 25; printnum(r); r = zero % 25; printnum(r);
+    r = zero / 125; printnum(r); r = zero % 125; printnum(r);
+    r = zero / 641; printnum(r); r = zero % 641; printnum(r);
+    r = zero / 1000; printnum(r); r = zero % 1000; printnum(r);
+    r = zero / 65536; printnum(r); r = zero % 65536; printnum(r);
+    r = zero / 2147483647; printnum(r); r = zero % 2147483647; printnum(r);
+    r = zero / three; printnum(r); r = zero % three; printnum(r);
+    r = zero / negThree; printnum(r); r = zero % negThree; printnum(r);
+    r = one / 1; printnum(r); r = one % 1; printnum(r);
+    r = one / 2; printnum(r); r = one % 2; printnum(r);
+    r = one / 3; printnum(r); r = one % 3; printnum(r);
+    r = one / 4; printnum(r); r = one % 4; printnum(r);
+    r = one / 5; printnum(r); r = one % 5; printnum(r);
+    r = one / 6; printnum(r); r = one % 6; printnum(r);
+    r = one / 7; printnum(r); r = one % 7; printnum(r);
+    r = one / 8; printnum(r); r = one % 8; printnum(r);
+    r = one / 10; printnum(r); r = one % 10; printnum(r);
+    r = one / 16; printnum(r); r = one % 16; printnum(r);
+    r = one / 25; printnum(r); r = one % 25; printnum(r);
+    r = one / 125; printnum(r); r = one % 125; printnum(r);
+    r = one / 641; printnum(r); r = one % 641; printnum(r);
+    r = one / 1000; printnum(r); r = one % 1000; printnum(r);
+    r = one / 65536; printnum(r); r = one % 65536; printnum(r);
+    r = one / 2147483647; printnum(r); r = one % 2147483647; printnum(r);
+    r = one / three; printnum(r); r = one % three; printnum(r);
+    r = one / negThree; printnum(r); r = one % negThree; printnum(r);
+    r = seven / 1; printnum(r); r = seven % 1; printnum(r);
+    r = seven / 2; printnum(r); r = seven % 2; printnum(r);
+    r = seven / 3; printnum(r); r = seven % 3; printnum(r);
+    r = seven / 4; printnum(r); r = seven % 4; printnum(r);
+    r = seven / 5; printnum(r); r = seven % 5; printnum(r);
+    r = seven / 6; printnum(r); r = seven % 6; printnum(r);
+    r = seven / 7; printnum(r); r = seven % 7; printnum(r);
+    r = seven / 8; printnum(r); r = seven % 8; printnum(r);
+    r = seven / 10; printnum(r); r = seven % 10; printnum(r);
+    r = seven / 16; printnum(r); r = seven % 16; printnum(r);
+    r = seven / 25; printnum(r); r = seven % 25; printnum(r);
+    r = seven / 125; printnum(r); r = seven % 125; printnum(r);
+    r = seven / 641; printnum(r); r = seven % 641; printnum(r);
+    r = seven / 1000; printnum(r); r = seven % 1000; printnum(r);
+    r = seven / 65536; printnum(r); r = seven % 65536; printnum(r);
+    r = seven / 2147483647; printnum(r); r = seven % 2147483647; printnum(r);
+    r = seven / three; printnum(r); r = seven % three; printnum(r);
+    r = seven / negThree; printnum(r); r = seven % negThree; printnum(r);
+    r = hundred / 1; printnum(r); r = hundred % 1; printnum(r);
+    r = hundred / 2; printnum(r); r = hundred % 2; printnum(r);
+    r = hundred / 3; printnum(r); r = hundred % 3; printnum(r);
+    r = hundred / 4; printnum(r); r = hundred % 4; printnum(r);
+    r = hundred / 5; printnum(r); r = hundred % 5; printnum(r);
+    r = hundred / 6; printnum(r); r = hundred % 6; printnum(r);
+    r = hundred / 7; printnum(r); r = hundred % 7; printnum(r);
+    r = hundred / 8; printnum(r); r = hundred % 8; printnum(r);
+    r = hundred / 10; printnum(r); r = hundred % 10; printnum(r);
+    r = hundred / 16; printnum(r); r = hundred % 16; printnum(r);
+    r = hundred / 25; printnum(r); r = hundred % 25; printnum(r);
+    r = hundred / 125; printnum(r); r = hundred % 125; printnum(r);
+    r = hundred / 641; printnum(r); r = hundred % 641; printnum(r);
+    r = hundred / 1000; printnum(r); r = hundred % 1000; printnum(r);
+    r = hundred / 65536; printnum(r); r = hundred % 65536; printnum(r);
+    r = hundred / 2147483647; printnum(r); r = hundred % 2147483647; printnum(r);
+    r = hundred / three; printnum(r); r = hundred % three; printnum(r);
+    r = hundred / negThree; printnum(r); r = hundred % negThree; printnum(r);
+    r = max / 1; printnum(r); r = max % 1; printnum(r);
+    r = max / 2; printnum(r); r = max % 2; printnum(r);
+    r = max / 3; printnum(r); r = max % 3; printnum(r);
+    r = max / 4; printnum(r); r = max % 4; printnum(r);
+    r = max / 5; printnum(r); r = max % 5; printnum(r);
+    r = max / 6; printnum(r); r = max % 6; printnum(r);
+    r = max / 7; printnum(r); r = max % 7; printnum(r);
+    r = max / 8; printnum(r); r = max % 8; printnum(r);
+    r = max / 10; printnum(r); r = max % 10; printnum(r);
+    r = max / 16; printnum(r); r = max % 16; printnum(r);
+    r = max / 25; printnum(r); r = max % 25; printnum(r);
+    r = max / 125; printnum(r); r = max % 125; printnum(r);
+    r = max / 641; printnum(r); r = max % 641; printnum(r);
+    r = max / 1000; printnum(r); r = max % 1000; printnum(r);
+    r = max / 65536; printnum(r); r = max % 65536; printnum(r);
+    r = max / 2147483647; printnum(r); r = max % 2147483647; printnum(r);
+    r = max / three; printnum(r); r = max % three; printnum(r);
+    r = max / negThree; printnum(r); r = max % negThree; printnum(r);
+    r = negOne / 1; printnum(r); r = negOne % 1; printnum(r);
+    r = negOne / 2; printnum(r); r = negOne % 2; printnum(r);
+    r = negOne / 3; printnum(r); r = negOne % 3; printnum(r);
+    r = negOne / 4; printnum(r); r = negOne % 4; printnum(r);
+    r = negOne / 5; printnum(r); r = negOne % 5; printnum(r);
+    r = negOne / 6; printnum(r); r = negOne % 6; printnum(r);
+    r = negOne / 7; printnum(r); r = negOne % 7; printnum(r);
+    r = negOne / 8; printnum(r); r = negOne % 8; printnum(r);
+    r = negOne / 10; printnum(r); r = negOne % 10; printnum(r);
+    r = negOne / 16; printnum(r); r = negOne % 16; printnum(r);
+    r = negOne / 25; printnum(r); r = negOne % 25; printnum(r);
+    r = negOne / 125; printnum(r); r = negOne % 125; printnum(r);
+    r = negOne / 641; printnum(r); r = negOne % 641; printnum(r);
+    r = negOne / 1000; printnum(r); r = negOne % 1000; printnum(r);
+    r = negOne / 65536; printnum(r); r = negOne % 65536; printnum(r);
+    r = negOne / 2147483647; printnum(r); r = negOne % 2147483647; printnum(r);
+    r = negOne / three; printnum(r); r = negOne % three; printnum(r);
+    r = negOne / negThree; printnum(r); r = negOne % negThree; printnum(r);
+    r = negSeven / 1; printnum(r); r = negSeven % 1; printnum(r);
+    r = negSeven / 2; printnum(r); r = negSeven % 2; printnum(r);
+    r = negSeven / 3; printnum(r); r = negSeven % 3; printnum(r);
+    r = negSeven / 4; printnum(r); r = negSeven % 4; printnum(r);
+    r = negSeven / 5; printnum(r); r = negSeven % 5; printnum(r);
+    r = negSeven / 6; printnum(r); r = negSeven % 6; printnum(r);
+    r = negSeven / 7; printnum(r); r = negSeven % 7; printnum(r);
+    r = negSeven / 8; printnum(r); r = negSeven % 8; printnum(r);
+    r = negSeven / 10; printnum(r); r = negSeven % 10; printnum(r);
+    r = negSeven / 16; printnum(r); r = negSeven % 16; printnum(r);
+    r = negSeven / 25; printnum(r); r = negSeven % 25; printnum(r);
+    r = negSeven / 125; printnum(r); r = negSeven % 125; printnum(r);
+    r = negSeven / 641; printnum(r); r = negSeven % 641; printnum(r);
+    r = negSeven / 1000; printnum(r); r = negSeven % 1000; printnum(r);
+    r = negSeven / 65536; printnum(r); r = negSeven % 65536; printnum(r);
+    r = negSeven / 2147483647; printnum(r); r = negSeven % 2147483647; printnum(r);
+    r = negSeven / three; printnum(r); r = negSeven % three; printnum(r);
+    r = negSeven / negThree; printnum(r); r = negSeven % negThree; printnum(r);
+    r = negHundred / 1; printnum(r); r = negHundred % 1; printnum(r);
+    r = negHundred / 2; printnum(r); r = negHundred % 2; printnum(r);
+    r = negHundred / 3; printnum(r); r = negHundred % 3; printnum(r);
+    r = negHundred / 4; printnum(r); r = negHundred % 4; printnum(r);
+    r = negHundred / 5; printnum(r); r = negHundred % 5; printnum(r);
+    r = negHundred / 6; printnum(r); r = negHundred % 6; printnum(r);
+    r = negHundred / 7; printnum(r); r = negHundred % 7; printnum(r);
+    r = negHundred / 8; printnum(r); r = negHundred % 8; printnum(r);
+    r = negHundred / 10; printnum(r); r = negHundred % 10; printnum(r);
+    r = negHundred / 16; printnum(r); r = negHundred % 16; printnum(r);
+    r = negHundred / 25; printnum(r); r = negHundred % 25; printnum(r);
+    r = negHundred / 125; printnum(r); r = negHundred % 125; printnum(r);
+    r = negHundred / 641; printnum(r); r = negHundred % 641; printnum(r);
+    r = negHundred / 1000; printnum(r); r = negHundred % 1000; printnum(r);
+    r = negHundred / 65536; printnum(r); r = negHundred % 65536; printnum(r);
+    r = negHundred / 2147483647; printnum(r); r = negHundred % 2147483647; printnum(r);
+    r = negHundred / three; printnum(r); r = negHundred % three; printnum(r);
+    r = negHundred / negThree; printnum(r); r = negHundred % negThree; printnum(r);
+    r = min / 1; printnum(r); r = min % 1; printnum(r);
+    r = min / 2; printnum(r); r = min % 2; printnum(r);
+    r = min / 3; printnum(r); r = min % 3; printnum(r);
+    r = min / 4; printnum(r); r = min % 4; printnum(r);
+    r = min / 5; printnum(r); r = min % 5; printnum(r);
+    r = min / 6; printnum(r); r = min % 6; printnum(r);
+    r = min / 7; printnum(r); r = min % 7; printnum(r);
+    r = min / 8; printnum(r); r = min % 8; printnum(r);
+    r = min / 10; printnum(r); r = min % 10; printnum(r);
+    r = min / 16; printnum(r); r = min % 16; printnum(r);
+    r = min / 25; printnum(r); r = min % 25; printnum(r);
+    r = min / 125; printnum(r); r = min % 125; printnum(r);
+    r = min / 641; printnum(r); r = min % 641; printnum(r);
+    r = min / 1000; printnum(r); r = min % 1000; printnum(r);
+    r = min / 65536; printnum(r); r = min % 65536; printnum(r);
+    r = min / 2147483647; printnum(r); r = min % 2147483647; printnum(r);
+    r = min / three; printnum(r); r = min % three; printnum(r);
+    r = min / negThree; printnum(r); r = min % negThree; printnum(r);
+
+    // Multiplication by constants on either side (shl, lea, imul) and by variables
+    r = seven * 0; printnum(r); r = 0 * seven; printnum(r);
+    r = seven * 1; printnum(r); r = 1 * seven; printnum(r);
+    r = seven * 2; printnum(r); r = 2 * seven; printnum(r);
+    r = seven * 3; printnum(r); r = 3 * seven; printnum(r);
+    r = seven * 5; printnum(r); r = 5 * seven; printnum(r);
+    r = seven * 9; printnum(r); r = 9 * seven; printnum(r);
+    r = seven * 10; printnum(r); r = 10 * seven; printnum(r);
+    r = seven * 12; printnum(r); r = 12 * seven; printnum(r);
+    r = seven * 18; printnum(r); r = 18 * seven; printnum(r);
+    r = seven * 24; printnum(r); r = 24 * seven; printnum(r);
+    r = seven * 40; printnum(r); r = 40 * seven; printnum(r);
+    r = seven * 72; printnum(r); r = 72 * seven; printnum(r);
+    r = seven * 100; printnum(r); r = 100 * seven; printnum(r);
+    r = seven * 1000; printnum(r); r = 1000 * seven; printnum(r);
+    r = seven * 65536; printnum(r); r = 65536 * seven; printnum(r);
+    r = seven * 7; printnum(r); r = 7 * seven; printnum(r);
+    r = seven * negThree; printnum(r);
+    r = negSeven * 0; printnum(r); r = 0 * negSeven; printnum(r);
+    r = negSeven * 1; printnum(r); r = 1 * negSeven; printnum(r);
+    r = negSeven * 2; printnum(r); r = 2 * negSeven; printnum(r);
+    r = negSeven * 3; printnum(r); r = 3 * negSeven; printnum(r);
+    r = negSeven * 5; printnum(r); r = 5 * negSeven; printnum(r);
+    r = negSeven * 9; printnum(r); r = 9 * negSeven; printnum(r);
+    r = negSeven * 10; printnum(r); r = 10 * negSeven; printnum(r);
+    r = negSeven * 12; printnum(r); r = 12 * negSeven; printnum(r);
+    r = negSeven * 18; printnum(r); r = 18 * negSeven; printnum(r);
+    r = negSeven * 24; printnum(r); r = 24 * negSeven; printnum(r);
+    r = negSeven * 40; printnum(r); r = 40 * negSeven; printnum(r);
+    r = negSeven * 72; printnum(r); r = 72 * negSeven; printnum(r);
+    r = negSeven * 100; printnum(r); r = 100 * negSeven; printnum(r);
+    r = negSeven * 1000; printnum(r); r = 1000 * negSeven; printnum(r);
+    r = negSeven * 65536; printnum(r); r = 65536 * negSeven; printnum(r);
+    r = negSeven * 7; printnum(r); r = 7 * negSeven; printnum(r);
+    r = negSeven * negThree; printnum(r);
+    r = max * 0; printnum(r); r = 0 * max; printnum(r);
+    r = max * 1; printnum(r); r = 1 * max; printnum(r);
+    r = max * 2; printnum(r); r = 2 * max; printnum(r);
+    r = max * 3; printnum(r); r = 3 * max; printnum(r);
+    r = max * 5; printnum(r); r = 5 * max; printnum(r);
+    r = max * 9; printnum(r); r = 9 * max; printnum(r);
+    r = max * 10; printnum(r); r = 10 * max; printnum(r);
+    r = max * 12; printnum(r); r = 12 * max; printnum(r);
+    r = max * 18; printnum(r); r = 18 * max; printnum(r);
+    r = max * 24; printnum(r); r = 24 * max; printnum(r);
+    r = max * 40; printnum(r); r = 40 * max; printnum(r);
+    r = max * 72; printnum(r); r = 72 * max; printnum(r);
+    r = max * 100; printnum(r); r = 100 * max; printnum(r);
+    r = max * 1000; printnum(r); r = 1000 * max; printnum(r);
+    r = max * 65536; printnum(r); r = 65536 * max; printnum(r);
+    r = max * 7; printnum(r); r = 7 * max; printnum(r);
+    r = max * negThree; printnum(r);
+    r = min * 0; printnum(r); r = 0 * min; printnum(r);
+    r = min * 1; printnum(r); r = 1 * min; printnum(r);
+    r = min * 2; printnum(r); r = 2 * min; printnum(r);
+    r = min * 3; printnum(r); r = 3 * min; printnum(r);
+    r = min * 5; printnum(r); r = 5 * min; printnum(r);
+    r = min * 9; printnum(r); r = 9 * min; printnum(r);
+    r = min * 10; printnum(r); r = 10 * min; printnum(r);
+    r = min * 12; printnum(r); r = 12 * min; printnum(r);
+    r = min * 18; printnum(r); r = 18 * min; printnum(r);
+    r = min * 24; printnum(r); r = 24 * min; printnum(r);
+    r = min * 40; printnum(r); r = 40 * min; printnum(r);
+    r = min * 72; printnum(r); r = 72 * min; printnum(r);
+    r = min * 100; printnum(r); r = 100 * min; printnum(r);
+    r = min * 1000; printnum(r); r = 1000 * min; printnum(r);
+    r = min * 65536; printnum(r); r = 65536 * min; printnum(r);
+    r = min * 7; printnum(r); r = 7 * min; printnum(r);
+    r = min * negThree; printnum(r);
+
+    // Precedence and parentheses
+    r = 1 + 2 * 3 - 8 / 4 % 3; printnum(r);
+    r = (1 + 2) * (3 - 1) + 100 % (7 - 1 * 2); printnum(r);
+    r = three * three * three / 2 + negSeven % three * 10; printnum(r);
+    return 0;
+}
@@ -0,0 +1,85 @@
+/** TEST CASE EXPECTED OUTPUT
+8
+23
+4294967292
+31
+4294967283
+180
+176
+13
+19
+0
+1
+1
+1
+100
+200
+15
+136
+*/
+
+extern void printnum(int);
+
+int main() {
+    // Enough live variables for some of them to stay in their stack slots
+    int a = 1;
+    int b = 2;
+    int c = 3;
+    int d = 4;
+    int e = 5;
+    int f = 6;
+    int g = 7;
+    int h = 8;
+    int i = 9;
+    int j = 10;
+    int k = 11;
+    int l = 12;
+    int m = 13;
+    int n = 14;
+    int o = 15;
+    int p = 16;
+    char small = 0 - 3;
+
+    // Immediates and variables folded in add, sub, imul and cmp
+    int r = a + 7;
+    printnum(r);
+    r = 7 + p;
+    printnum(r);
+    r = p - 20;
+    printnum(r);
+    r = o + p;
+    printnum(r);
+    r = (a + b) - p;
+    printnum(r);
+    r = (c * d) * o;
+    printnum(r);
+    r = p * (e + f);
+    printnum(r);
+    r = small + p;
+    printnum(r);
+    r = p - small;
+    printnum(r);
+    r = p < 5;
+    printnum(r);
+    r = 5 < p;
+    printnum(r);
+    r = o < p;
+    printnum(r);
+    r = small < a;
+    printnum(r);
+    if (p > 15) {
+        printnum(100);
+    }
+    if (o == 15) {
+        printnum(200);
+    }
+    int count = 0;
+    while (count < n) {
+        count = count + 3;
+    }
+    printnum(count);
+
+    r = a + b + c + d + e + f + g + h + i + j + k + l + m + n + o + p;
+    printnum(r);
+    return 0;
+}
@@ -0,0 +1,35 @@
+/** TEST CASE EXPECTED OUTPUT
+0
+136
+150
+*/
+
+extern void printnum(int);
+
+int main() {
+    int zero = 0;
+    printnum(zero);
+
+    int a = 1;
+    int b = 2;
+    int c = 3;
+    int d = 4;
+    int e = 5;
+    int f = 6;
+    int g = 7;
+    int h = 8;
+    int i = 9;
+    int j = 10;
+    int k = 11;
+    int l = 12;
+    int m = 13;
+    int n = 14;
+    int o = 15;
+    int p = 16;
+    int sum = a + b + c + d + e + f + g + h + i + j + k + l + m + n + o + p;
+    printnum(sum);
+    int q = sum;
+    int r = q + n;
+    printnum(a + b + c + d + e + f + g + h + i + j + k + l + m + n + o + p + r - sum);
+    return 0;
+}
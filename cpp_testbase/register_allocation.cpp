@@ -0,0 +1,29 @@
+/** TEST CASE EXPECTED OUTPUT
+10
+55
+55
+3
+*/
+
+extern void printnum(int);
+
+int main() {
+    int sum = 0;
+    int count = 0;
+    for (int i = 1; i <= 10; i = i + 1) {
+        int square = i;
+        sum = sum + square;
+        count = count + 1;
+    }
+    printnum(count);
+    printnum(sum);
+
+    int copy = sum;
+    printnum(copy);
+
+    int a = 1;
+    int b = 2;
+    printnum(a + b);
+
+    return 0;
+}
@@ -0,0 +1,116 @@
+/** TEST CASE EXPECTED OUTPUT
+105
+10
+9
+7
+1
+14
+138
+1
+1
+1
+1
+1
+4
+4
+4
+4
+4
+4
+4
+1
+0
+0
+0
+0
+0
+4
+4
+4
+4
+4
+4
+4
+4
+1
+*/
+
+extern void printnum(int);
+
+int seed = 3;
+
+// Every local stays live across the remainders by a constant, which need three temporaries each
+int remainders() {
+    int a = seed + 1;
+    int b = seed + 2;
+    int c = seed + 3;
+    int d = seed + 4;
+    int e = seed + 5;
+    int f = seed + 6;
+    int g = seed + 7;
+    int h = seed + 8;
+    int j = seed + 9;
+    int k = seed + 10;
+    int l = seed + 11;
+    int m = seed + 12;
+    int n = seed + 13;
+    int r = 1;
+    if ((a * 31 + 5) % 7 > 2) {
+        r = 2;
+    }
+    int q = (a * 31 + 5) % 7 * (c % 4);
+    return r + q + a + b + c + d + e + f + g + h + j + k + l + m + n;
+}
+
+// Seven parameters in registers and the divide claiming rax and rdx leave no free temporary inside the || in the
+// loop: a parameter the statement does not read lends its register
+[[gnu::noinline]] int crowdedDivision(int p0, int p1, int p2, int p3, int p4, int p5, int p6) {
+    int v = p2;
+    if (((p0 % 2) + (p0 != (p5 || p2)))) {
+        int d = 4;
+        do {
+            printnum(((p1 - (p1 > 1)) || ((p0 / (p3 % 5 + 6)) * p6)));
+            d = d - 1;
+        } while (d > 0);
+        int w = p3;
+        p5 = (p0 > ((v || v) - p2));
+        printnum(p1);
+        for (int i = 0; i < (p0 % 9); i = i + 1) {
+            printnum(p4);
+        }
+    }
+    return p5;
+}
+
+int main() {
+    int a = 1;
+    int b = 2;
+    int c = 3;
+    int d = 4;
+    int e = 5;
+    int f = 6;
+    int g = 7;
+    int h = 8;
+    int i = 9;
+    int j = 10;
+    int k = 11;
+    int l = 12;
+    int m = 13;
+    int n = 14;
+    printnum(a + b + c + d + e + f + g + h + i + j + k + l + m + n);
+
+    int x = 0;
+    int y = 0;
+    int z = a + x = b + y = c + d;
+    printnum(z);
+    printnum(x);
+    printnum(y);
+
+    printnum(a + b + c + d + e + f + g + h + i + j + k + l + m + n - n - m - l - k - j - i - h - g - f - e - d - c - b);
+    printnum(n);
+
+    printnum(remainders());
+    printnum(crowdedDivision(7, 1, 2, 3, 4, 5, 6));
+    printnum(crowdedDivision(8, 0, 0, 13, 4, 0, 6));
+    return 0;
+}
@@ -0,0 +1,51 @@
+/** TEST CASE EXPECTED OUTPUT
+3
+7
+200
+120
+*/
+
+extern void printnum(int);
+
+int main() {
+    int a = 1;
+    int b = 2;
+    int c = 3;
+    int d = 4;
+    int e = 5;
+    int f = 6;
+    int g = 7;
+    int h = 8;
+    int i = 9;
+    int j = 10;
+    int k = 11;
+    int l = 12;
+    int m = 13;
+    int n = 14;
+
+    if (a) {
+        int left = a + b;
+        printnum(left);
+    } else {
+        int right = c + d;
+        printnum(right);
+    }
+
+    if (a - 1) {
+        int left = a + b;
+        printnum(left);
+    } else {
+        int right = c + d;
+        printnum(right);
+    }
+
+    int count = 0;
+    while (count < 200) {
+        int next = count + 1;
+        count = next;
+    }
+    printnum(count);
+
+    printnum(a + b + c + d + e + f + g + h + i + j + k + l + m + n + count - count + 15);
+    return 0;
+}
@@ -0,0 +1,146 @@
+/** TEST CASE EXPECTED OUTPUT
+12253
+28
+315
+5
+13
+21
+12
+0
+*/
+
+extern void printnum(int);
+
+// Leaf function whose body is generated again without the red zone: only the kept attempt has a jump table
+int pick(int v) {
+    int r = 0;
+    switch (v) {
+        case 0:
+            r = 10;
+            break;
+        case 1:
+            r = 11;
+            break;
+        case 2:
+            r = 12;
+            break;
+        case 3:
+            r = 13;
+            break;
+    }
+    asm("nop");
+    return r;
+}
+
+int main() {
+    // Dense cases: jump table, with fallthrough and a default
+    int total = 0;
+    for (int i = 0 - 2; i < 10; i = i + 1) {
+        switch (i) {
+            case 0:
+                total = total + 1;
+                break;
+            case 1:
+                total = total + 10;
+            case 2:
+                total = total + 100;
+                break;
+            case 3:
+            case 4:
+                total = total + 1000;
+                break;
+            case 6:
+                total = total + 10000;
+                break;
+            default:
+                total = total + 7;
+        }
+    }
+    printnum(total);
+
+    // Sparse cases: compare tree, without a default
+    int hits = 0;
+    for (int j = 0; j < 2000; j = j + 1) {
+        switch (j * 7) {
+            case 7:
+                hits = hits + 1;
+                break;
+            case 70:
+                hits = hits + 2;
+                break;
+            case 700:
+                hits = hits + 3;
+                break;
+            case 1400:
+                hits = hits + 4;
+                break;
+            case 2100:
+                hits = hits + 5;
+                break;
+            case 7000:
+                hits = hits + 6;
+                break;
+            case 13993:
+                hits = hits + 7;
+                break;
+        }
+    }
+    printnum(hits);
+
+    // Negative case values
+    int sign = 0;
+    for (int k = 0 - 3; k < 4; k = k + 1) {
+        switch (k) {
+            case -3:
+                sign = sign + 1;
+                break;
+            case -2:
+                sign = sign + 2;
+                break;
+            case -1:
+                sign = sign + 4;
+                break;
+            case 2:
+                sign = sign + 8;
+                break;
+            default:
+                sign = sign + 100;
+                break;
+        }
+    }
+    printnum(sign);
+
+    // Few cases, default first
+    int x = 5;
+    switch (x) {
+        default:
+            printnum(0);
+            break;
+        case 5:
+            printnum(5);
+    }
+    switch (x) {
+    }
+
+    // break also leaves loops
+    int n = 0;
+    while (n < 100) {
+        if (n == 13) {
+            break;
+        }
+        n = n + 1;
+    }
+    printnum(n);
+    int m = 0;
+    do {
+        m = m + 3;
+        if (m > 20) {
+            break;
+        }
+    } while (m < 100);
+    printnum(m);
+
+    printnum(pick(2));
+    printnum(pick(7));
+    return 0;
+}
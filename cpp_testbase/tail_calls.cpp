@@ -0,0 +1,129 @@
+/** TEST CASE EXPECTED OUTPUT
+12
+11
+58
+9
+20
+10
+4
+65
+90
+3628800
+20
+1
+7
+4294967295
+*/
+
+extern void printnum(int);
+
+int seven() {
+    return 7;
+}
+
+int three() {
+    return 3;
+}
+
+int four(int unused) {
+    return 4;
+}
+
+// Call results used as operands
+int sum() {
+    return seven() + three();
+}
+
+// Tail calls: the callee returns straight to our caller
+int forward() {
+    return sum();
+}
+
+int forwardTwice() {
+    return forward();
+}
+
+int pickFour() {
+    return four(seven());
+}
+
+char letter() {
+    return 65;
+}
+
+// A char result is sign-extended after a real call
+int fromChar() {
+    return letter();
+}
+
+int ten() {
+    return 10;
+}
+
+int nine() {
+    int a = 4;
+    int b = 5;
+    return a + b;
+}
+
+// The operand read after the recursive call lives across it
+int fact(int n) {
+    if (n <= 1) {
+        return 1;
+    }
+    return n * fact(n - 1);
+}
+
+int id(int value) {
+    return value;
+}
+
+[[gnu::noinline]] int offsetPair(int a, int b) {
+    int r = a * b;
+    int s = a + b;
+    return s - r - 40;
+}
+
+// The initializer starts in the register of v, where q is copied before the call
+int clampBelow(int p, int q) {
+    int w = 3;
+    while (w > 0) {
+        w = w - 1;
+        int v = (q < offsetPair(p, 3)) - 1;
+        q = v;
+    }
+    return q;
+}
+
+int main() {
+    int a = 5;
+    printnum(a + seven());
+    printnum(seven() * three() - sum());
+    printnum(seven() + three() * (sum() + seven()));
+
+    // Nested calls: the outer argument register is in use while the inner call is set up
+    printnum(four(seven()) + a);
+    printnum(a * four(three() + four(a)));
+
+    int x = forwardTwice();
+    printnum(x);
+    printnum(pickFour());
+    printnum(fromChar());
+
+    // Variables folded into an operation whose other operand makes a call
+    int n = ten();
+    printnum(n * nine());
+    printnum(fact(10));
+    printnum(n + id(n));
+
+    if (seven() > three()) {
+        printnum(1);
+    }
+    while (a < seven()) {
+        a = a + 1;
+    }
+    printnum(a);
+    printnum(clampBelow(0 - 9, 2));
+
+    return forward() - 10;
+}
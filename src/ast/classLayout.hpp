@@ -0,0 +1,95 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "ast/scopes/types.hpp"
+#include "dbg/logger.hpp"
+
+namespace ast
+{
+
+// Objects are only reported against it: the stack itself is not aligned to it
+static constexpr scopes::byteSize_t CACHE_LINE_SIZE = 64;
+
+constexpr scopes::byteSize_t alignTo(scopes::byteSize_t offset, scopes::byteSize_t alignment) {
+  return (offset + alignment - 1) / alignment * alignment;
+}
+
+struct ClassLayout {
+  scopes::byteSize_t byteSize;
+  scopes::byteSize_t alignment;
+  // In memory order, with their offset
+  std::vector<scopes::FieldDescription> fields;
+};
+
+// Fields are placed one after the other, each at the next multiple of its alignment, and the size is rounded up to the
+// largest one: the System V layout. Reordering places them by decreasing alignment, ties kept in declaration order.
+// Sizes being multiples of alignments, all powers of two, that leaves padding only at the end.
+inline ClassLayout layoutClass(std::vector<scopes::FieldDescription> fields, bool reorder) {
+  if (reorder) {
+    std::ranges::stable_sort(fields, std::greater{}, [](const scopes::FieldDescription &field) { return field.type->alignment; });
+  }
+
+  ClassLayout layout{.byteSize = 0, .alignment = 1, .fields = std::move(fields)};
+  for (auto &field : layout.fields) {
+    field.offset = alignTo(layout.byteSize, field.type->alignment);
+    layout.byteSize = field.offset + field.type->byteSize;
+    layout.alignment = std::max(layout.alignment, field.type->alignment);
+  }
+  // Distinct objects have distinct addresses: an empty class still takes a byte
+  layout.byteSize = std::max<scopes::byteSize_t>(alignTo(layout.byteSize, layout.alignment), 1);
+  return layout;
+}
+
+struct ClassLayoutEntry {
+  const scopes::TypeDescription *type;
+  bool reordered;
+  // Size of the other layout: reordered for a class laid out as declared, as declared for a reordered one
+  scopes::byteSize_t alternativeSize;
+};
+
+struct ClassLayoutReport {
+  std::vector<ClassLayoutEntry> classes;
+
+  // -fdump-class-layout: offsets, holes, and the fields straddling a cache line boundary
+  void print(std::ostream &os) const {
+    for (const auto &entry : classes) {
+      const auto *type = entry.type;
+      scopes::byteSize_t used = 0;
+      for (const auto &field : type->fields) used += field.type->byteSize;
+
+      os << "class " << type->name << " ; size=" << type->byteSize << " ; align=" << type->alignment
+         << " ; padding=" << type->byteSize - std::min(used, type->byteSize)
+         << " ; cache lines=" << alignTo(type->byteSize, CACHE_LINE_SIZE) / CACHE_LINE_SIZE;
+      if (entry.reordered) os << " ; reordered, " << entry.alternativeSize << " as declared";
+      else if (entry.alternativeSize < type->byteSize) os << " ; " << entry.alternativeSize << " with [[zpp::reorder]]";
+      os << '\n';
+
+      scopes::byteSize_t end = 0;
+      for (const auto &field : type->fields) {
+        if (field.offset > end) os << "      | padding (" << field.offset - end << ")\n";
+        end = field.offset + field.type->byteSize;
+        os << std::string(5 - std::min<size_t>(5, std::to_string(field.offset).size()), ' ') << field.offset << " | "
+           << field.type->name << " " << field.name << " (" << field.type->byteSize << ")";
+        if (field.type->byteSize && field.offset / CACHE_LINE_SIZE != (end - 1) / CACHE_LINE_SIZE) os << " ; crosses a cache line";
+        os << '\n';
+      }
+      if (type->byteSize > end && !type->fields.empty()) os << "      | padding (" << type->byteSize - end << ")\n";
+    }
+  }
+
+  void logDebug() const {
+    std::stringstream ss;
+    print(ss);
+    std::string line;
+    while (std::getline(ss, line)) LOG_DEBUG("[ClassLayout] " << line);
+  }
+};
+
+} // namespace ast
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "dbg/logger.hpp"
+
+namespace ast
+{
+
+// Statements and expressions evaluated for one call replaced at compile time, nested calls included
+static constexpr uint64_t CONSTEVAL_MAX_STEPS = 1 << 20;
+// Nested calls in progress during the evaluation of one call
+static constexpr uint32_t CONSTEVAL_MAX_DEPTH = 512;
+
+struct ConstantEvaluationOptions {
+  // -O2: any function that neither runs inline asm nor calls outside the translation unit, not only constexpr ones
+  bool evaluatePureFunctions = false;
+};
+
+// How a statement ends in the compile-time interpreter
+enum class Completion : uint8_t {
+  NORMAL,
+  BREAK,
+  RETURN,
+  // Not evaluable at compile time: the call is kept
+  FAILED,
+};
+
+struct ConstantCallDecision {
+  std::string_view caller;
+  std::string_view callee;
+  bool evaluated;
+  // The value when evaluated, the failure otherwise
+  int32_t value;
+  const char *reason;
+  uint64_t steps;
+};
+
+struct ConstantEvaluationReport {
+  std::vector<ConstantCallDecision> decisions;
+
+  void logDebug() const {
+    for (const auto &decision : decisions) {
+      if (decision.evaluated) {
+        LOG_DEBUG("[ConstEval] " << decision.caller << " <- " << decision.callee << " ; replaced by " << decision.value
+                  << " ; steps=" << decision.steps);
+      }
+      else {
+        LOG_DEBUG("[ConstEval] " << decision.caller << " <- " << decision.callee << " ; kept (" << decision.reason
+                  << ") ; steps=" << decision.steps);
+      }
+    }
+  }
+};
+
+} // namespace ast
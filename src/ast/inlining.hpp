@@ -0,0 +1,74 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <string_view>
+#include <vector>
+
+#include "dbg/logger.hpp"
+
+namespace ast
+{
+
+// `inline`, [[gnu::always_inline]] and [[gnu::noinline]] on a function definition
+enum class InlineHint : uint8_t {
+  NONE,
+  INLINE,
+  ALWAYS,
+  NEVER,
+};
+
+// Sizes are counted in AST nodes of the callee body (see summarize)
+static constexpr uint32_t INLINE_THRESHOLD = 24;
+static constexpr uint32_t INLINE_HINT_THRESHOLD = 64;
+// Call sequence, frame setup and teardown saved by expanding the body in place
+static constexpr uint32_t INLINE_CALL_BONUS = 6;
+// A literal argument usually simplifies the expanded body
+static constexpr uint32_t INLINE_CONSTANT_ARGUMENT_BONUS = 4;
+// Per enclosing loop of the call site, counted up to INLINE_MAX_LOOP_DEPTH loops
+static constexpr uint32_t INLINE_LOOP_BONUS = 16;
+static constexpr uint32_t INLINE_MAX_LOOP_DEPTH = 3;
+// Callers stop growing past this size, except for always_inline callees
+static constexpr uint32_t INLINE_MAX_CALLER_SIZE = 2000;
+
+// Largest callee worth expanding at a call site
+constexpr uint32_t inlineThreshold(InlineHint hint, uint32_t loopDepth, size_t constantArguments) {
+  uint32_t threshold = hint == InlineHint::INLINE ? INLINE_HINT_THRESHOLD : INLINE_THRESHOLD;
+  threshold += INLINE_CALL_BONUS;
+  threshold += INLINE_CONSTANT_ARGUMENT_BONUS * static_cast<uint32_t>(constantArguments);
+  threshold += INLINE_LOOP_BONUS * std::min(loopDepth, INLINE_MAX_LOOP_DEPTH);
+  return threshold;
+}
+
+struct InlineSummary {
+  uint32_t size = 0;
+  bool containsInlineAsm = false;
+  // Names read or written, and names of the parameters and locals: an expanded body resolves its names from the scope
+  // of the call site, where a global it uses may be hidden
+  std::set<std::string_view> usedNames;
+  std::set<std::string_view> declaredNames;
+};
+
+struct InlineDecision {
+  std::string_view caller;
+  std::string_view callee;
+  uint32_t calleeSize;
+  uint32_t threshold;
+  bool inlined;
+  const char *reason;
+};
+
+struct InlineReport {
+  std::vector<InlineDecision> decisions;
+
+  void logDebug() const {
+    for (const auto &decision : decisions) {
+      LOG_DEBUG("[Inliner] " << decision.caller << " <- " << decision.callee << " ; " << (decision.inlined ? "inlined" : "kept")
+                << " (" << decision.reason << ") ; size=" << decision.calleeSize << " ; threshold=" << decision.threshold);
+    }
+  }
+};
+
+} // namespace ast
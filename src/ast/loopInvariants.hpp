@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <set>
+
+#include "ast/scopes/memory_x86_64.hpp"
+
+namespace ast
+{
+
+// Each hoisted value holds a register for the whole loop
+static constexpr size_t MAX_HOISTED_PER_LOOP = 4;
+
+// What a loop (condition, body and increment) may change
+struct LoopEffects {
+  std::set<const scopes::VariableDescription *> written;
+  // Inline asm may write any variable
+  bool containsInlineAsm = false;
+  // A callee may write any global that is not const
+  bool containsCall = false;
+  // Reads or stores an element: the vectorizer reports on the counted loops that do
+  bool accessesArrays = false;
+};
+
+} // namespace ast
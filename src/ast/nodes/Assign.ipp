@@ -7,33 +7,66 @@ Assign::Assign(Variable lhs, Expression rhs)
       : lhs(std::make_unique<Variable>(std::move(lhs)))
       , rhs(std::make_unique<Expression>(std::move(rhs))) {}
 
+Assign::Assign(Variable lhs, Expression rhs, std::unique_ptr<Expression> &&index)
+      : lhs(std::make_unique<Variable>(std::move(lhs)))
+      , rhs(std::make_unique<Expression>(std::move(rhs)))
+      , index(std::move(index)) {}
+
 Assign::Assign(const Assign &other)
       : lhs(std::make_unique<Variable>(*other.lhs))
-      , rhs(std::make_unique<Expression>(*other.rhs)) {}
+      , rhs(std::make_unique<Expression>(*other.rhs))
+      , index(other.index ? std::make_unique<Expression>(*other.index) : nullptr) {}
 
 inline void Assign::debug(size_t depth) const {
   logNode(depth);
   lhs->debug(depth+1);
+  if (index) index->debug(depth+1);
   rhs->debug(depth+1);
 }
 
 inline void Assign::decorate(scopes::ScopeStack &scopeStack, scopes::Scope &scope) {
   lhs->decorate(scopeStack, scope);
+  USER_ASSERT(!lhs->getVariableDescription()->isReadOnly, "Assignment to the const variable " << lhs->getName());
+  if (index) {
+    USER_ASSERT(lhs->getType()->isArray(), lhs->getName() << " is not an array");
+    index->decorate(scopeStack, scope);
+    Subscript::checkIndex(*lhs, *index);
+  }
+  else {
+    USER_ASSERT(!lhs->getType()->isArray(), "Assignment to the array " << lhs->getName() << ": arrays are written element by element");
+  }
   rhs->decorate(scopeStack, scope);
   // TODO check rhs can be implicitly casted to lhs's type
-  // TODO evaluate type as lhs's type
+}
+
+// The value stays in the target while the address of the element is computed
+inline uint32_t Assign::getRegisterNeed() const {
+  if (!index) return rhs->getRegisterNeed();
+  return std::max(rhs->getRegisterNeed(), 1 + Subscript::addressRegisterNeed(*lhs, *index));
 }
 
 inline void Assign::genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const {
   auto regGuard = generator.regSet().acquireGuard();
-  loadValueInRegister(generator, regGuard->reg);
+  loadValueInRegister(generator, regGuard.reg);
 }
 
 inline void Assign::loadValueInRegister(codegen::NasmGenerator_x86_64 &generator,
                                 scopes::GeneralPurposeRegister targetRegister) const {
   rhs->loadValueInRegister(generator, targetRegister);
+  if (index) {
+    scopes::byteSize_t size = getType()->byteSize;
+    auto element = Subscript::emitElementAddress(generator, *lhs, *index, std::nullopt, scopes::toMask(targetRegister));
+    generator.emitBinaryOp(codegen::Opcode::MOV, element.operand, scopes::getProperRegisterFromID64(targetRegister, size));
+    // The value of the assignment is the converted one
+    if (size < 4) generator.emitBinaryOp(codegen::Opcode::MOVSX, generator.int32(targetRegister), scopes::getProperRegisterFromID64(targetRegister, size));
+    return;
+  }
   auto &varDesc = *lhs->getVariableDescription();
-  generator.emitStoreInMemory(varDesc.location, scopes::getProperRegisterFromID64(targetRegister));
+  scopes::byteSize_t size = (*varDesc.typeDescription)->byteSize;
+  generator.emitStoreInMemory(varDesc.location, scopes::getProperRegisterFromID64(targetRegister, size));
+
+  // The value of the assignment is the converted one
+  if (size < 4) lhs->loadValueInRegister(generator, targetRegister);
 }
 
 } /* namespace ast */
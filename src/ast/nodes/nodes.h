@@ -1,15 +1,26 @@
 #pragma once
 
 #include <cstddef>
+#include <deque>
+#include <format>
+#include <string>
 #include <string_view>
 #include <variant>
 #include <vector>
 
+#include "ast/classLayout.hpp"
+#include "ast/constantEvaluation.hpp"
+#include "ast/inlining.hpp"
 #include "ast/literalTypes.hpp"
+#include "ast/loopInvariants.hpp"
 #include "ast/scopes/registers.hpp"
 #include "ast/scopes/scopeStack.hpp"
 #include "ast/scopes/types.hpp"
+#include "ast/specialization.hpp"
 #include "codegen/generate.hpp"
+#include "codegen/liveness.hpp"
+#include "codegen/RegisterAllocator.hpp"
+#include "codegen/unrolling.hpp"
 #include "dbg/errors.hpp"
 #include "interface/AstNode.hpp"
 
@@ -20,16 +31,22 @@ namespace ast {
   X(Declaration)                                                               \
   X(FunctionCall)                                                              \
   X(BinaryOperation)                                                           \
+  X(UnaryOperation)                                                            \
   X(Assign)                                                                    \
+  X(Subscript)                                                                 \
   X(NumberLiteral)                                                             \
   X(StringLiteral)                                                             \
   X(ReturnStatement)                                                           \
+  X(BreakStatement)                                                            \
   X(InlineAsmStatement)                                                        \
   X(ConditionalStatement)                                                      \
   X(WhileStatement)                                                            \
   X(DoStatement)                                                               \
   X(ForStatement)                                                              \
+  X(SwitchStatement)                                                           \
+  X(InlinedCall)                                                               \
   X(CodeBlock)                                                                 \
+  X(GlobalVariable)                                                            \
   X(FunctionParameter)                                                         \
   X(FunctionParameterList)                                                     \
   X(FunctionDeclaration)                                                       \
@@ -54,6 +71,12 @@ namespace ast {
 NODE_LIST
 #undef X
 
+class Inliner;
+class LoopInvariantHoister;
+class ConstantEvaluator;
+class CallSpecializer;
+class LoopVectorizer;
+
 enum class Visibility { Public, Protected, Private };
 constexpr Visibility allVisibilities[] = {
     Visibility::Public, Visibility::Protected, Visibility::Private};
@@ -63,8 +86,8 @@ public:
   static constexpr const char *node_name = "Node_Type";
 
 public:
-  Type(std::string_view name, int pointerDepth)
-      : name(name), pointerDepth(pointerDepth) {}
+  Type(std::string_view name, int pointerDepth, bool isConst = false)
+      : name(name), pointerDepth(pointerDepth), isConst(isConst) {}
 
   inline void decorate (scopes::ScopeStack &scopeStack, scopes::Scope &scope);
   inline void debug(size_t depth) const;
@@ -75,12 +98,26 @@ public:
     THROW("TypeDescription not set for type " << fullName());
   }
   inline std::string fullName() const {
-    return std::string(name) + std::string(pointerDepth, '*');
+    std::string arraySuffix = arrayLength ? std::format("[{}]", *arrayLength) : "";
+    return (isConst ? "const " : "") + std::string(name) + std::string(pointerDepth, '*') + arraySuffix;
   }
 
+  inline void setConst() { isConst = true; }
+
+  // `T name[length]`: the declared variable is an array of length elements of this type
+  inline void setArrayLength(uint32_t length) { arrayLength = length; }
+
+  // The const of a pointer type applies to what it points to: the pointer itself can still be assigned
+  inline bool isReadOnly() const { return isConst && pointerDepth == 0; }
+
+  // Known before decoration: a literal read in place of a variable of this type keeps its value
+  inline bool isInt() const { return name == "int" && pointerDepth == 0 && !arrayLength; }
+
 private:
   std::string_view name;
   int pointerDepth;
+  bool isConst;
+  std::optional<uint32_t> arrayLength;
   const scopes::TypeDescription *description = nullptr;
 };
 
@@ -89,20 +126,53 @@ public:
   static constexpr const char *node_name = "Node_Variable";
 
 public:
-  Variable(std::string_view &&name) : name(name) {}
+  // p.x.y names the field y of the field x of the object p: decorated with the description of that field
+  Variable(std::string_view &&name, std::vector<std::string_view> &&members = {}) : name(name), members(std::move(members)) {}
 
   inline void decorate (scopes::ScopeStack &scopeStack, scopes::Scope &scope);
 
   inline void debug(size_t depth) const;
 
+  inline void computeLiveness(codegen::LivenessBuilder &liveness);
+  inline void summarize(InlineSummary &summary) const;
+  inline void collectLoopEffects(LoopEffects &effects) const;
+  inline void replaceInvariants(LoopInvariantHoister &hoister);
+  inline void foldConstantCalls(ConstantEvaluator &evaluator);
+  inline void specializeCalls(CallSpecializer &specializer, uint32_t loopDepth);
+  inline std::optional<int32_t> evaluate(ConstantEvaluator &evaluator) const;
+
+  // Parameters are defined on entry, where the caller left them (see LivenessBuilder::parameter)
+  inline void defineParameter(codegen::LivenessBuilder &liveness, const scopes::LocationDescription &incoming,
+                              codegen::programPoint_t entry);
+
+  // Narrow types are sign-extended: values in registers are always promoted (see scopes::promote)
   inline void loadValueInRegister(codegen::NasmGenerator_x86_64 &generator,
                                   scopes::GeneralPurposeRegister targetRegister) const {
-    const scopes::byteSize_t size = (*getVariableDescription()->typeDescription)->byteSize;
+    const scopes::byteSize_t size = getType()->byteSize;
+    if (size < 4) {
+      generator.emitLoadSignExtended(scopes::getProperRegisterFromID64(targetRegister, 4), getVariableDescription()->location, size);
+      return;
+    }
     generator.emitLoadFromMemory(scopes::getProperRegisterFromID64(targetRegister, size), getVariableDescription()->location);
   }
 
   inline std::string_view getName() const { return name; }
 
+  inline const std::vector<std::string_view> &getMembers() const { return members; }
+
+  inline bool isDecorated() const { return description != nullptr; }
+
+  inline const scopes::TypeDescription *getType() const { return *getVariableDescription()->typeDescription; }
+
+  inline uint32_t getRegisterNeed() const { return 1; }
+
+  // Variables already stored at the operation size are read in place, from their slot or register
+  inline bool isFoldableOperand(scopes::byteSize_t size) const { return getType()->byteSize == size; }
+
+  inline codegen::MachineOperand asOperand(codegen::NasmGenerator_x86_64 &generator, scopes::byteSize_t size) const {
+    return generator.locationOperand(getVariableDescription()->location, size);
+  }
+
   inline const scopes::VariableDescription *getVariableDescription() const {
     if (description)
       return description;
@@ -116,7 +186,8 @@ public:
 
 private:
   std::string_view name;
-  const scopes::VariableDescription *description = nullptr;
+  std::vector<std::string_view> members;
+  scopes::VariableDescription *description = nullptr;
 };
 
 class NumberLiteral : public interface::AstNode<NumberLiteral> {
@@ -128,17 +199,32 @@ public:
 
   inline void debug(size_t depth) const;
   inline void decorate (scopes::ScopeStack &scopeStack, scopes::Scope &scope);
-
+  inline void computeLiveness(codegen::LivenessBuilder &liveness);
+  inline void summarize(InlineSummary &summary) const;
+  inline void collectLoopEffects(LoopEffects &effects) const;
+  inline void replaceInvariants(LoopInvariantHoister &hoister);
+  inline void foldConstantCalls(ConstantEvaluator &evaluator);
+  inline void specializeCalls(CallSpecializer &specializer, uint32_t loopDepth);
+  inline std::optional<int32_t> evaluate(ConstantEvaluator &evaluator) const;
+
+  // 32-bit writes zero the upper half: the shorter encoding is enough for anything below 2^32
   void loadValueInRegister(codegen::NasmGenerator_x86_64 &generator,
                            scopes::GeneralPurposeRegister targetRegister) const {
-    generator.emitLoadNumberLiteral(scopes::getProperRegisterFromID64(targetRegister, NumberLiteralUnderlyingTypeSize), number);
+    scopes::byteSize_t size = number <= UINT32_MAX ? 4 : NumberLiteralUnderlyingTypeSize;
+    generator.emitLoadNumberLiteral(scopes::getProperRegisterFromID64(targetRegister, size), number);
   }
 
+  inline const scopes::TypeDescription *getType() const { return &scopes::INT_TYPE; }
+
+  inline uint32_t getRegisterNeed() const { return 1; }
+
   inline void genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const {
     (void)generator;
     THROW("NumberLiteral genAsm_x86_64 should not be called");
   }
 
+  NumberLiteralUnderlyingType getValue() const { return number; }
+
 private:
   NumberLiteralUnderlyingType number;
 };
@@ -153,6 +239,23 @@ public:
   inline void debug(size_t depth) const;
 
   inline void decorate (scopes::ScopeStack &scopeStack, scopes::Scope &scope);
+  inline void computeLiveness(codegen::LivenessBuilder &liveness);
+  inline void summarize(InlineSummary &summary) const;
+  inline void collectLoopEffects(LoopEffects &effects) const;
+  inline void replaceInvariants(LoopInvariantHoister &hoister);
+  inline void foldConstantCalls(ConstantEvaluator &evaluator);
+  inline void specializeCalls(CallSpecializer &specializer, uint32_t loopDepth);
+  inline std::optional<int32_t> evaluate(ConstantEvaluator &evaluator) const;
+
+  // As an expression, the address of the NUL-terminated contents in the .rodata string pool
+  void loadValueInRegister(codegen::NasmGenerator_x86_64 &generator,
+                           scopes::GeneralPurposeRegister targetRegister) const {
+    generator.emitLoadAddress(scopes::getProperRegisterFromID64(targetRegister), generator.internString(content));
+  }
+
+  inline const scopes::TypeDescription *getType() const { return &scopes::POINTER_TYPE; }
+
+  inline uint32_t getRegisterNeed() const { return 1; }
 
   std::string_view getContent() const { return content; }
 
@@ -177,18 +280,59 @@ public:
 
   inline void decorate (scopes::ScopeStack &scopeStack, scopes::Scope &scope);
 
+  inline void computeLiveness(codegen::LivenessBuilder &liveness);
+  inline void summarize(InlineSummary &summary) const;
+  inline void collectLoopEffects(LoopEffects &effects) const;
+  inline void replaceInvariants(LoopInvariantHoister &hoister);
+  inline void foldConstantCalls(ConstantEvaluator &evaluator);
+  inline void specializeCalls(CallSpecializer &specializer, uint32_t loopDepth);
+  inline std::optional<int32_t> evaluate(ConstantEvaluator &evaluator) const;
+
   inline void genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const;
 
   inline void loadValueInRegister(codegen::NasmGenerator_x86_64 &generator,
-                                  scopes::GeneralPurposeRegister targetRegister) const {
-    (void)generator;
-    (void)targetRegister;
-    TODO("FunctionCall loadValueInRegister Not implemented");
+                                  scopes::GeneralPurposeRegister targetRegister) const;
+
+  inline const scopes::TypeDescription *getType() const {
+    DEBUG_ASSERT(description, "FunctionCall " << name << " is not decorated");
+    return description->returnType;
   }
 
+  // `return f(args)` can jump to f after tearing down the frame: every argument is passed in a register and the result
+  // needs no conversion, whatever the return type of the caller
+  inline bool isTailCallable() const;
+
+  // Argument setup, then a jump to the callee in place of the function epilogue
+  inline void genTailCall_x86_64(codegen::NasmGenerator_x86_64 &generator) const;
+
+  // The result lands in rax, arguments are evaluated one at a time into their registers
+  inline uint32_t getRegisterNeed() const { return 1; }
+
+  inline std::string_view getName() const { return name; }
+
+  inline const std::vector<Expression> &getArguments() const { return arguments; }
+
+  // Calls a specialized clone instead, which no longer takes the removed arguments (see CallSpecializer)
+  inline void redirect(std::string_view target, const std::vector<bool> &removedArguments);
+
+private:
+  // Loads the arguments in their registers, held by the returned guards, released in reverse order. The result
+  // register belongs to the caller: it is never saved, as it is about to be overwritten.
+  inline std::vector<scopes::GPRegisterSet::RegisterGuard> loadArguments(codegen::NasmGenerator_x86_64 &generator,
+                                                                         std::optional<scopes::GeneralPurposeRegister> resultRegister) const;
+
+  // Arguments beyond the sixth, evaluated in order into an aligned area at the bottom of the stack. Returns the bytes to
+  // release after the call, alignment padding included.
+  inline scopes::byteSize_t storeStackArguments(codegen::NasmGenerator_x86_64 &generator) const;
+
+  // The result, when needed, is copied out of rax before the caller-saved registers are restored
+  inline void emitCall(codegen::NasmGenerator_x86_64 &generator, std::optional<scopes::GeneralPurposeRegister> resultRegister) const;
+
 private:
   std::string_view name;
   std::vector<Expression> arguments;
+  const scopes::FunctionDescription *description = nullptr;
+  codegen::programPoint_t callPoint = 0;
 };
 
 class BinaryOperation: interface::AstNode<BinaryOperation> {
@@ -199,12 +343,15 @@ public:
     SUBSTRACT = '-',
     MULTIPLY = '*',
     DIVIDE = '/',
+    MODULO = '%',
     CMP_EQ = static_cast<char>(codegen::CMP_OPERATION::EQ),
     CMP_NEQ = static_cast<char>(codegen::CMP_OPERATION::NEQ),
     CMP_LEQ = static_cast<char>(codegen::CMP_OPERATION::LEQ),
     CMP_GEQ = static_cast<char>(codegen::CMP_OPERATION::GEQ),
     CMP_LT = static_cast<char>(codegen::CMP_OPERATION::LT),
     CMP_GT = static_cast<char>(codegen::CMP_OPERATION::GT),
+    LOGICAL_AND = '&',
+    LOGICAL_OR = '|',
   };
 
   static constexpr const char *node_name = "Node_BinaryOperation";
@@ -225,12 +372,135 @@ public:
 
   inline void decorate(scopes::ScopeStack &scopeStack, scopes::Scope &scope);
 
+  inline void computeLiveness(codegen::LivenessBuilder &liveness);
+  inline void summarize(InlineSummary &summary) const;
+  inline void collectLoopEffects(LoopEffects &effects) const;
+  inline void replaceInvariants(LoopInvariantHoister &hoister);
+  inline void foldConstantCalls(ConstantEvaluator &evaluator);
+  inline void specializeCalls(CallSpecializer &specializer, uint32_t loopDepth);
+  inline std::optional<int32_t> evaluate(ConstantEvaluator &evaluator) const;
+
   inline void loadValueInRegister(codegen::NasmGenerator_x86_64 &generator, scopes::GeneralPurposeRegister targetRegister) const;
 
+  inline bool isComparison() const;
+
+  // && and ||: the rhs is only evaluated when the lhs does not decide the result
+  inline bool isLogical() const { return op == Operation::LOGICAL_AND || op == Operation::LOGICAL_OR; }
+
+  // Comparisons and logical operations yield an int (there is no bool yet), arithmetic yields the common operand type
+  inline const scopes::TypeDescription *getType() const {
+    DEBUG_ASSERT(operandType, "BinaryOperation is not decorated");
+    return isComparison() || isLogical() ? &scopes::INT_TYPE : operandType;
+  }
+
+  // Sethi-Ullman number: registers needed to evaluate the subtree without spilling
+  inline uint32_t getRegisterNeed() const { return registerNeed; }
+
+  // Division or modulo by something else than a foldable constant: needs idiv, which clobbers edx:eax
+  inline bool usesHardwareDivide() const;
+
+  inline std::optional<uint32_t> speculationCost() const;
+
+  inline bool isLoopInvariant(const LoopEffects &effects) const;
+
+  inline Operation getOperation() const { return op; }
+  inline const Expression &getLhs() const { return *lhs; }
+  inline const Expression &getRhs() const { return *rhs; }
+
+  // Leaves the flags of `lhs cmp rhs` for the caller to branch on or materialize. lhs is evaluated in lhsRegister,
+  // unless it is compared in place.
+  inline codegen::CMP_OPERATION emitCompare(codegen::NasmGenerator_x86_64 &generator, scopes::GeneralPurposeRegister lhsRegister) const;
+
+  // Jump chain of a logical operation: each operand branches on its own flags, the rhs only when still undecided
+  inline void emitLogicalBranch(codegen::NasmGenerator_x86_64 &generator, std::string_view label, bool jumpIfTrue) const;
+
+private:
+  // 0 or 1 in the target, with the same jump chain as in a condition
+  inline void loadLogicalValue(codegen::NasmGenerator_x86_64 &generator, scopes::GeneralPurposeRegister targetRegister) const;
+
+  // Second operand of the instruction applied to the target: a temporary, or folded in the instruction
+  struct SourceOperand {
+    std::optional<scopes::GPRegisterSet::RegisterGuard> guard;
+    codegen::MachineOperand operand;
+  };
+
+  enum class Folding {
+    NONE,
+    RHS,
+    // The operands may be swapped to fold the lhs
+    COMMUTATIVE,
+  };
+
+  inline uint32_t computeRegisterNeed() const;
+
+  // Sethi-Ullman order: the operand needing more registers is evaluated first, while no other register is held
+  inline bool evaluatesRhsFirst() const;
+
+  // Loads one operand in the target and returns the other one, never in one of the excluded registers
+  inline SourceOperand loadOperands(codegen::NasmGenerator_x86_64 &generator, scopes::GeneralPurposeRegister targetRegister, scopes::RegisterMask exclude, Folding folding) const;
+
+  // x + 7, x - 7, x + y with x and y in registers: a single lea instead of copying x to the target first
+  inline bool tryEmitLea(codegen::NasmGenerator_x86_64 &generator, scopes::GeneralPurposeRegister targetRegister) const;
+
+  inline void loadProduct(codegen::NasmGenerator_x86_64 &generator, scopes::GeneralPurposeRegister targetRegister) const;
+  inline void loadQuotient(codegen::NasmGenerator_x86_64 &generator, scopes::GeneralPurposeRegister targetRegister) const;
+
 private:
   Operation op;
   std::unique_ptr<Expression> lhs;
   std::unique_ptr<Expression> rhs;
+  // Operands are converted to it before the operation
+  const scopes::TypeDescription *operandType = nullptr;
+  uint32_t registerNeed = 0;
+};
+
+class UnaryOperation : public interface::AstNode<UnaryOperation> {
+public:
+  enum class Operation : char {
+    LOGICAL_NOT = '!',
+  };
+
+  static constexpr const char *node_name = "Node_UnaryOperation";
+
+public:
+  UnaryOperation(Operation op, std::unique_ptr<Expression> &&operand)
+    : op(op), operand(std::move(operand)) {}
+
+  UnaryOperation(const UnaryOperation &other)
+    : op(other.op), operand(std::make_unique<Expression>(*other.operand)) {}
+
+  inline void genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const {
+    (void)generator;
+    THROW("UnaryOperation genAsm_x86_64 should not be called");
+  }
+
+  inline void debug(size_t depth) const;
+
+  inline void decorate(scopes::ScopeStack &scopeStack, scopes::Scope &scope);
+
+  inline void computeLiveness(codegen::LivenessBuilder &liveness);
+  inline void summarize(InlineSummary &summary) const;
+  inline void collectLoopEffects(LoopEffects &effects) const;
+  inline void replaceInvariants(LoopInvariantHoister &hoister);
+  inline void foldConstantCalls(ConstantEvaluator &evaluator);
+  inline void specializeCalls(CallSpecializer &specializer, uint32_t loopDepth);
+  inline std::optional<int32_t> evaluate(ConstantEvaluator &evaluator) const;
+
+  inline void loadValueInRegister(codegen::NasmGenerator_x86_64 &generator, scopes::GeneralPurposeRegister targetRegister) const;
+
+  inline const scopes::TypeDescription *getType() const { return &scopes::INT_TYPE; }
+
+  inline uint32_t getRegisterNeed() const;
+
+  inline std::optional<uint32_t> speculationCost() const;
+
+  inline bool isLoopInvariant(const LoopEffects &effects) const;
+
+  inline const Expression &getOperand() const { return *operand; }
+
+private:
+  Operation op;
+  std::unique_ptr<Expression> operand;
 };
 
 class Assign : public interface::AstNode<Assign> {
@@ -240,38 +510,187 @@ public:
 public:
   Assign(const Assign &other);
   Assign(Variable lhs, Expression rhs);
+  // lhs[index] = rhs
+  Assign(Variable lhs, Expression rhs, std::unique_ptr<Expression> &&index);
 
   inline void debug(size_t depth) const;
   inline void decorate(scopes::ScopeStack &scopeStack, scopes::Scope &scope);
+  inline void computeLiveness(codegen::LivenessBuilder &liveness);
+  inline void summarize(InlineSummary &summary) const;
+  inline void collectLoopEffects(LoopEffects &effects) const;
+  inline void replaceInvariants(LoopInvariantHoister &hoister);
+  inline void foldConstantCalls(ConstantEvaluator &evaluator);
+  inline void specializeCalls(CallSpecializer &specializer, uint32_t loopDepth);
+  inline std::optional<int32_t> evaluate(ConstantEvaluator &evaluator) const;
   inline void genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const;
   inline void loadValueInRegister(codegen::NasmGenerator_x86_64 &generator,
                                   scopes::GeneralPurposeRegister targetRegister) const;
 
+  inline const scopes::TypeDescription *getType() const {
+    return isElementStore() ? lhs->getType()->elementType : lhs->getType();
+  }
+
+  inline uint32_t getRegisterNeed() const;
+
+  inline const Variable &getVariable() const { return *lhs; }
+
+  inline const Expression &getValue() const { return *rhs; }
+
+  // Writes an element of the array lhs instead of the whole variable
+  inline bool isElementStore() const { return index != nullptr; }
+
+  inline const Expression &getIndex() const { return *index; }
+
 private:
   std::unique_ptr<Variable> lhs;
   std::unique_ptr<Expression> rhs;
+  std::unique_ptr<Expression> index;
+};
+
+// array[index], with array a fixed-size array variable. Indices are not checked at run time, literal ones are checked
+// against the length when decorating.
+class Subscript : public interface::AstNode<Subscript> {
+public:
+  static constexpr const char *node_name = "Node_Subscript";
+
+public:
+  Subscript(Variable &&array, std::unique_ptr<Expression> &&index)
+    : array(std::move(array)), index(std::move(index)) {}
+
+  Subscript(const Subscript &other)
+    : array(other.array), index(std::make_unique<Expression>(*other.index)) {}
+
+  inline void debug(size_t depth) const;
+  inline void decorate(scopes::ScopeStack &scopeStack, scopes::Scope &scope);
+  inline void computeLiveness(codegen::LivenessBuilder &liveness);
+  inline void summarize(InlineSummary &summary) const;
+  inline void collectLoopEffects(LoopEffects &effects) const;
+  inline void replaceInvariants(LoopInvariantHoister &hoister);
+  inline void foldConstantCalls(ConstantEvaluator &evaluator);
+  inline void specializeCalls(CallSpecializer &specializer, uint32_t loopDepth);
+  inline std::optional<int32_t> evaluate(ConstantEvaluator &evaluator) const;
+
+  inline void genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const {
+    (void)generator;
+    THROW("Subscript genAsm_x86_64 should not be called");
+  }
+
+  // Narrow elements are sign-extended, like variables
+  inline void loadValueInRegister(codegen::NasmGenerator_x86_64 &generator, scopes::GeneralPurposeRegister targetRegister) const;
+
+  inline const scopes::TypeDescription *getType() const { return array.getType()->elementType; }
+
+  inline uint32_t getRegisterNeed() const;
+
+  inline std::optional<uint32_t> speculationCost() const;
+
+  inline const Variable &getArray() const { return array; }
+  inline const Expression &getIndex() const { return *index; }
+
+  // Memory operand of array[index], valid until the next push or pop. A literal index is folded in the displacement,
+  // any other one is evaluated in indexRegister, or in a temporary when none is given. A global array is addressed from
+  // rip, which takes no index: its address is loaded in a temporary first. Temporaries are never one of the excluded
+  // registers, and are held by the returned guards while the operand is in use.
+  struct ElementAddress {
+    codegen::MemoryOperand operand;
+    // Released base first: a spilled temporary is reloaded in the reverse order
+    std::optional<scopes::GPRegisterSet::RegisterGuard> index;
+    std::optional<scopes::GPRegisterSet::RegisterGuard> base;
+  };
+  static inline ElementAddress emitElementAddress(codegen::NasmGenerator_x86_64 &generator, const Variable &array,
+                                                  const Expression &index,
+                                                  std::optional<scopes::GeneralPurposeRegister> indexRegister,
+                                                  scopes::RegisterMask exclude = {});
+
+  // Temporaries held by emitElementAddress without an index register
+  static inline uint32_t addressRegisterNeed(const Variable &array, const Expression &index);
+
+  // A literal index must be within the array
+  static inline void checkIndex(const Variable &array, const Expression &index);
+
+private:
+  Variable array;
+  std::unique_ptr<Expression> index;
 };
 
 class Expression : public interface::AstNode<Expression> {
 public:
   static constexpr const char *node_name = "Node_Expression";
-  using ExpressionVariant = std::variant<NumberLiteral, Variable, FunctionCall, BinaryOperation, Assign>;
+  using ExpressionVariant = std::variant<NumberLiteral, StringLiteral, Variable, FunctionCall, BinaryOperation, UnaryOperation, Assign, Subscript>;
 
 public:
   Expression(const Expression &other) : expr(other.expr) {}
   Expression(const Expression &&other) : expr(std::move(other.expr)) {}
   Expression(NumberLiteral &&expr) : expr(std::move(expr)) {}
+  Expression(StringLiteral &&expr) : expr(std::move(expr)) {}
   Expression(Variable &&expr) : expr(std::move(expr)) {}
   Expression(FunctionCall &&expr) : expr(std::move(expr)) {}
   Expression(BinaryOperation &&expr) : expr(std::move(expr)) {}
+  Expression(UnaryOperation &&expr) : expr(std::move(expr)) {}
   Expression(Assign &&expr) : expr(std::move(expr)) {}
+  Expression(Subscript &&expr) : expr(std::move(expr)) {}
 
   inline void debug(size_t depth) const;
 
   inline void decorate (scopes::ScopeStack &scopeStack, scopes::Scope &scope);
 
+  inline void computeLiveness(codegen::LivenessBuilder &liveness);
+  inline void summarize(InlineSummary &summary) const;
+  inline void collectLoopEffects(LoopEffects &effects) const;
+  inline void replaceInvariants(LoopInvariantHoister &hoister);
+  // valueUsed is false for expression statements: a call whose result is dropped is kept for its effects
+  inline void foldConstantCalls(ConstantEvaluator &evaluator, bool valueUsed = true);
+  inline void specializeCalls(CallSpecializer &specializer, uint32_t loopDepth);
+  inline std::optional<int32_t> evaluate(ConstantEvaluator &evaluator) const;
+  // Reads a variable instead of computing the value, needs decorating again
+  inline void replaceByVariable(Variable &&variable) { expr = std::move(variable); }
+  // A call evaluated at compile time. The literal keeps the type of the call: ints are 32-bit patterns in registers.
+  inline void replaceByConstant(int32_t value) {
+    expr = NumberLiteral(static_cast<uint32_t>(value));
+    registerNeed = 1;
+  }
+
+  inline const codegen::ProgramRange &getProgramRange() const { return programRange; }
+
+  inline const Variable *asVariable() const { return std::get_if<Variable>(&expr); }
+
+  inline const NumberLiteral *asNumberLiteral() const { return std::get_if<NumberLiteral>(&expr); }
+
+  inline const StringLiteral *asStringLiteral() const { return std::get_if<StringLiteral>(&expr); }
+
+  inline const Assign *asAssign() const { return std::get_if<Assign>(&expr); }
+
+  inline const BinaryOperation *asBinaryOperation() const { return std::get_if<BinaryOperation>(&expr); }
+
+  inline const FunctionCall *asFunctionCall() const { return std::get_if<FunctionCall>(&expr); }
+
+  inline const UnaryOperation *asUnaryOperation() const { return std::get_if<UnaryOperation>(&expr); }
+
+  inline const Subscript *asSubscript() const { return std::get_if<Subscript>(&expr); }
+
+  inline const scopes::TypeDescription *getType() const {
+    DEBUG_ASSERT(type, "Expression is not decorated");
+    return type;
+  }
+
+  inline uint32_t getRegisterNeed() const { return registerNeed; }
+
+  // Literal small enough to be folded in an int instruction sequence
+  inline std::optional<int32_t> asInt32Constant() const {
+    const auto *literal = asNumberLiteral();
+    if (!literal) return std::nullopt;
+    return codegen::asInt32Constant(literal->getValue());
+  }
+
+  // Usable as the source of a size-byte instruction without being loaded: int32 literals and variables of that size
+  inline bool isFoldableOperand(scopes::byteSize_t size) const;
+
+  // Built right before the instruction using it (see NasmGenerator_x86_64::locationOperand)
+  inline codegen::MachineOperand asFoldedOperand(codegen::NasmGenerator_x86_64 &generator, scopes::byteSize_t size) const;
+
   void loadValueInRegister(codegen::NasmGenerator_x86_64 &generator,
                            scopes::GeneralPurposeRegister targetRegister) const {
+    auto pinGuard = generator.pinLiveRegisters(programRange);
     std::visit(
         [&generator, targetRegister](auto &&expr) {
           expr.loadValueInRegister(generator, targetRegister);
@@ -281,8 +700,23 @@ public:
 
   inline void genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const;
 
+  // Condition context: jumps to label when the expression is (jumpIfTrue) or is not truthy, without materializing it
+  inline void emitBranch(codegen::NasmGenerator_x86_64 &generator, std::string_view label, bool jumpIfTrue) const;
+
+  // Sets the flags and returns the condition holding when the expression is truthy. reg is used if it has to be loaded.
+  inline codegen::CMP_OPERATION emitFlags(codegen::NasmGenerator_x86_64 &generator, scopes::GeneralPurposeRegister reg) const;
+
+  // Operations executed to evaluate the expression unconditionally. None when it could trap or has side effects.
+  inline std::optional<uint32_t> speculationCost() const;
+
+  // Same value on every iteration of the loop: built from variables it never writes
+  inline bool isLoopInvariant(const LoopEffects &effects) const;
+
 private:
   ExpressionVariant expr;
+  codegen::ProgramRange programRange;
+  const scopes::TypeDescription *type = nullptr;
+  uint32_t registerNeed = 0;
 };
 
 class Declaration : public interface::AstNode<Declaration> {
@@ -300,12 +734,27 @@ public:
 
   inline void decorate (scopes::ScopeStack &scopeStack, scopes::Scope &scope);
 
+  // The initial value is resolved in valueScope, the variable is declared in scope (inlined parameters)
+  inline void decorateBinding(scopes::ScopeStack &scopeStack, scopes::Scope &valueScope, scopes::Scope &scope);
+
+  inline void computeLiveness(codegen::LivenessBuilder &liveness);
+  inline void summarize(InlineSummary &summary) const;
+  inline void collectLoopEffects(LoopEffects &effects) const;
+  inline void replaceInvariants(LoopInvariantHoister &hoister);
+  inline void foldConstantCalls(ConstantEvaluator &evaluator);
+  inline void specializeCalls(CallSpecializer &specializer, uint32_t loopDepth);
+  inline Completion evaluate(ConstantEvaluator &evaluator) const;
+
   inline void genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const;
 
+  inline const Variable &getVariable() const { return variable; }
+  inline const std::optional<Expression> &getAssignment() const { return assignment; }
+
 private:
   Type type;
   Variable variable;
   std::optional<Expression> assignment;
+  codegen::ProgramRange programRange;
 };
 
 class ReturnStatement : public interface::AstNode<ReturnStatement> {
@@ -320,41 +769,95 @@ public:
 
   inline void decorate (scopes::ScopeStack &scopeStack, scopes::Scope &scope);
 
+  inline void computeLiveness(codegen::LivenessBuilder &liveness);
+  inline void summarize(InlineSummary &summary) const;
+  inline void collectLoopEffects(LoopEffects &effects) const;
+  inline void replaceInvariants(LoopInvariantHoister &hoister);
+  inline void foldConstantCalls(ConstantEvaluator &evaluator);
+  inline void specializeCalls(CallSpecializer &specializer, uint32_t loopDepth);
+  inline Completion evaluate(ConstantEvaluator &evaluator) const;
+
   inline void genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const;
 
 private:
   Expression expression;
 };
 
+// Leaves the innermost loop or switch (NasmGenerator_x86_64::breakLabel)
+class BreakStatement : public interface::AstNode<BreakStatement> {
+public:
+  static constexpr const char *node_name = "Node_BreakStatement";
+
+public:
+  inline void debug(size_t depth) const;
+
+  inline void decorate (scopes::ScopeStack &scopeStack, scopes::Scope &scope);
+
+  inline void computeLiveness(codegen::LivenessBuilder &liveness);
+  inline void summarize(InlineSummary &summary) const;
+  inline void collectLoopEffects(LoopEffects &effects) const;
+  inline void replaceInvariants(LoopInvariantHoister &hoister);
+  inline void foldConstantCalls(ConstantEvaluator &evaluator);
+  inline void specializeCalls(CallSpecializer &specializer, uint32_t loopDepth);
+  inline Completion evaluate(ConstantEvaluator &evaluator) const;
+
+  inline void genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const;
+};
+
 class InlineAsmStatement : public interface::AstNode<InlineAsmStatement> {
 public:
   static constexpr const char *node_name = "Node_InlineAsmStatement";
 
+  // GCC-style operands, bound to a fixed register: the register name picks the register, the variable type its width
   struct BindingRequest {
+    enum class Constraint : uint8_t {
+      INPUT,      // "reg": loaded before the block
+      OUTPUT,     // "=reg": stored back after the block
+      READ_WRITE, // "+reg": both
+    };
+
+    Constraint constraint;
     scopes::Register registerTo;
-    std::string varIdentifier;
+    Variable variable;
+
+    bool isRead() const { return constraint != Constraint::OUTPUT; }
+    bool isWritten() const { return constraint != Constraint::INPUT; }
   };
 
 public:
+  // Without clobbers, the block is basic asm: it may write any register
   InlineAsmStatement(StringLiteral &&asmBlock,
-                     std::vector<BindingRequest> &&requests)
-      : asmBlock(std::move(asmBlock)), requests(std::move(requests)) {}
+                     std::vector<BindingRequest> &&requests,
+                     std::optional<scopes::RegisterMask> clobbers)
+      : asmBlock(std::move(asmBlock)), requests(std::move(requests)), clobbers(clobbers) {}
 
   inline void debug(size_t depth) const;
 
   inline void decorate (scopes::ScopeStack &scopeStack, scopes::Scope &scope);
 
+  inline void computeLiveness(codegen::LivenessBuilder &liveness);
+  inline void summarize(InlineSummary &summary) const;
+  inline void collectLoopEffects(LoopEffects &effects) const;
+  inline void replaceInvariants(LoopInvariantHoister &hoister);
+  inline void foldConstantCalls(ConstantEvaluator &evaluator);
+  inline void specializeCalls(CallSpecializer &specializer, uint32_t loopDepth);
+  inline Completion evaluate(ConstantEvaluator &evaluator) const;
+
   inline void genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const;
 
+  // Declared clobbers and every operand register: inputs are not assumed to survive the block
+  inline scopes::RegisterMask clobberedRegisters() const;
+
 private:
   StringLiteral asmBlock;
   std::vector<BindingRequest> requests;
+  std::optional<scopes::RegisterMask> clobbers;
 };
 class Instruction : public interface::AstNode<Instruction> {
 public:
   static constexpr const char *node_name = "Node_Instruction";
   using InstructionVariant =
-      std::variant<ReturnStatement, InlineAsmStatement, Declaration, Expression>;
+      std::variant<ReturnStatement, BreakStatement, InlineAsmStatement, Declaration, Expression>;
 
 public:
   template <typename T>
@@ -364,8 +867,22 @@ public:
 
   inline void decorate (scopes::ScopeStack &scopeStack, scopes::Scope &scope);
 
+  inline void computeLiveness(codegen::LivenessBuilder &liveness);
+  inline void summarize(InlineSummary &summary) const;
+  inline void collectLoopEffects(LoopEffects &effects) const;
+  inline void replaceInvariants(LoopInvariantHoister &hoister);
+  inline void foldConstantCalls(ConstantEvaluator &evaluator);
+  inline void specializeCalls(CallSpecializer &specializer, uint32_t loopDepth);
+  inline Completion evaluate(ConstantEvaluator &evaluator) const;
+
+  inline void hoistLoopInvariants(scopes::ScopeStack &scopeStack, scopes::Scope &scope);
+
   inline void genAsm_x86_64(codegen::NasmGenerator_x86_64 &evaluator) const;
 
+  inline bool isReturn() const { return std::holds_alternative<ReturnStatement>(instr); }
+
+  inline const Expression *asExpression() const { return std::get_if<Expression>(&instr); }
+
 private:
   InstructionVariant instr;
 };
@@ -386,8 +903,24 @@ public:
 
   inline void decorate (scopes::ScopeStack &scopeStack, scopes::Scope &scope);
 
+  inline void computeLiveness(codegen::LivenessBuilder &liveness);
+  inline void summarize(InlineSummary &summary) const;
+  inline void collectLoopEffects(LoopEffects &effects) const;
+  inline void replaceInvariants(LoopInvariantHoister &hoister);
+  inline void foldConstantCalls(ConstantEvaluator &evaluator);
+  inline void specializeCalls(CallSpecializer &specializer, uint32_t loopDepth);
+  inline Completion evaluate(ConstantEvaluator &evaluator) const;
+
+  inline void hoistLoopInvariants(scopes::ScopeStack &scopeStack, scopes::Scope &scope);
+
+  inline void inlineCalls(Inliner &inliner, uint32_t loopDepth);
+
   inline void genAsm_x86_64(codegen::NasmGenerator_x86_64 &evaluator) const;
 
+  inline scopes::Scope *getScope() const { return scope; }
+
+  inline const std::vector<Statement> &getStatements() const { return statements; }
+
   inline scopes::Scope &getOrCreateScope(scopes::ScopeStack &scopeStack,
                                          scopes::Scope &scope) {
     if (!this->scope) {
@@ -419,9 +952,38 @@ public:
 
   inline void decorate (scopes::ScopeStack &scopeStack, scopes::Scope &scope);
 
+  inline void computeLiveness(codegen::LivenessBuilder &liveness);
+  inline void summarize(InlineSummary &summary) const;
+  inline void collectLoopEffects(LoopEffects &effects) const;
+  inline void replaceInvariants(LoopInvariantHoister &hoister);
+  inline void foldConstantCalls(ConstantEvaluator &evaluator);
+  inline void specializeCalls(CallSpecializer &specializer, uint32_t loopDepth);
+  inline Completion evaluate(ConstantEvaluator &evaluator) const;
+
+  inline void hoistLoopInvariants(scopes::ScopeStack &scopeStack, scopes::Scope &scope);
+
+  inline void inlineCalls(Inliner &inliner, uint32_t loopDepth);
+
   inline void genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const;
 
+  // if (...) return ...; without an else
+  inline bool isEarlyExit() const;
+
+  inline const Expression &getCondition() const { return condition; }
+  inline const CodeBlock &getIfBody() const { return ifBody; }
+  inline const CodeBlock *getElseBody() const { return elseBody ? &*elseBody : nullptr; }
+
 private:
+  // Both arms are evaluated by a select: worth it while they are cheaper than a mispredicted branch
+  static constexpr uint32_t MAX_SELECT_COST = 8;
+
+  // The assignment expression when the block is a single `v = value;`
+  static inline const Expression *singleAssignment(const CodeBlock &block);
+
+  // if (c) { v = x; } [else { v = y; }] with cheap arms that can not trap: cmp + cmovcc instead of branches
+  inline bool isSelect() const;
+  inline void genSelect_x86_64(codegen::NasmGenerator_x86_64 &generator) const;
+
   Expression condition;
   CodeBlock ifBody;
   std::optional<CodeBlock> elseBody;
@@ -439,11 +1001,25 @@ public:
 
   inline void decorate (scopes::ScopeStack &scopeStack, scopes::Scope &scope);
 
+  inline void computeLiveness(codegen::LivenessBuilder &liveness);
+  inline void summarize(InlineSummary &summary) const;
+  inline void collectLoopEffects(LoopEffects &effects) const;
+  inline void replaceInvariants(LoopInvariantHoister &hoister);
+  inline void foldConstantCalls(ConstantEvaluator &evaluator);
+  inline void specializeCalls(CallSpecializer &specializer, uint32_t loopDepth);
+  inline Completion evaluate(ConstantEvaluator &evaluator) const;
+
+  inline void hoistLoopInvariants(scopes::ScopeStack &scopeStack, scopes::Scope &scope);
+
+  inline void inlineCalls(Inliner &inliner, uint32_t loopDepth);
+
   inline void genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const;
 
 private:
   Expression condition;
   CodeBlock body;
+  // Loop invariants, computed once before entering the loop
+  std::vector<Declaration> preheader;
 };
 
 class DoStatement : public interface::AstNode<DoStatement> {
@@ -458,11 +1034,25 @@ public:
 
   inline void decorate (scopes::ScopeStack &scopeStack, scopes::Scope &scope);
 
+  inline void computeLiveness(codegen::LivenessBuilder &liveness);
+  inline void summarize(InlineSummary &summary) const;
+  inline void collectLoopEffects(LoopEffects &effects) const;
+  inline void replaceInvariants(LoopInvariantHoister &hoister);
+  inline void foldConstantCalls(ConstantEvaluator &evaluator);
+  inline void specializeCalls(CallSpecializer &specializer, uint32_t loopDepth);
+  inline Completion evaluate(ConstantEvaluator &evaluator) const;
+
+  inline void hoistLoopInvariants(scopes::ScopeStack &scopeStack, scopes::Scope &scope);
+
+  inline void inlineCalls(Inliner &inliner, uint32_t loopDepth);
+
   inline void genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const;
 
 private:
   Expression expr;
   CodeBlock body;
+  // Loop invariants, computed once before entering the loop
+  std::vector<Declaration> preheader;
 };
 
 class ForStatement : public interface::AstNode<ForStatement> {
@@ -470,14 +1060,27 @@ public:
   static constexpr const char *node_name = "Node_ForStatement";
 
 public:
+  // unrollCount comes from a `#pragma unroll` placed before the loop
   ForStatement(Declaration &&init, std::optional<Expression> &&condition,
-                std::optional<Expression> &&expr, CodeBlock &&body)
-      : init(init), condition(std::move(condition)), expr(expr), body(std::move(body)) {}
+                std::optional<Expression> &&expr, CodeBlock &&body, std::optional<uint32_t> unrollCount = std::nullopt)
+      : init(init), condition(std::move(condition)), expr(expr), body(std::move(body)), unrollCount(unrollCount) {}
 
   inline void debug(size_t depth) const;
 
   inline void decorate (scopes::ScopeStack &scopeStack, scopes::Scope &scope);
 
+  inline void computeLiveness(codegen::LivenessBuilder &liveness);
+  inline void summarize(InlineSummary &summary) const;
+  inline void collectLoopEffects(LoopEffects &effects) const;
+  inline void replaceInvariants(LoopInvariantHoister &hoister);
+  inline void foldConstantCalls(ConstantEvaluator &evaluator);
+  inline void specializeCalls(CallSpecializer &specializer, uint32_t loopDepth);
+  inline Completion evaluate(ConstantEvaluator &evaluator) const;
+
+  inline void hoistLoopInvariants(scopes::ScopeStack &scopeStack, scopes::Scope &scope);
+
+  inline void inlineCalls(Inliner &inliner, uint32_t loopDepth);
+
   inline void genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const;
 
 private:
@@ -485,8 +1088,108 @@ private:
   std::optional<Expression> condition;
   std::optional<Expression> expr;
   CodeBlock body;
+  // Loop invariants, computed once after the init statement
+  std::vector<Declaration> preheader;
+  std::optional<uint32_t> unrollCount;
 
   scopes::Scope *loopScope = nullptr;
+
+  // for (int i = start; i op bound; i = i + step), where the body changes neither i nor bound
+  struct CountedLoop {
+    const scopes::VariableDescription *induction;
+    std::optional<int32_t> start;
+    codegen::CMP_OPERATION op;
+    const Expression *bound;
+    int32_t step;
+  };
+
+  inline std::optional<CountedLoop> analyzeCountedLoop() const;
+
+  // True when the first test of the condition is known to pass: for (int i = 0; i < 10; ...)
+  inline bool entryTestPasses() const;
+
+  // Guarded do-while form: the entry test skips the loop, the test at the bottom is the only branch of an iteration
+  inline void genRotatedLoop_x86_64(codegen::NasmGenerator_x86_64 &generator, std::string_view endLabel, bool guarded) const;
+
+  // Copies of the body with the tests between them removed, followed by the rolled loop for the remaining iterations
+  inline void genUnrolled_x86_64(codegen::NasmGenerator_x86_64 &generator, const CountedLoop &loop, const codegen::UnrollPlan &plan) const;
+
+  // Element-wise loops over arrays: a vector loop running several iterations at once, followed by the rolled loop for
+  // the remaining ones (see LoopVectorizer). False when nothing was generated.
+  inline bool genVectorized_x86_64(codegen::NasmGenerator_x86_64 &generator, const CountedLoop &loop, std::optional<uint64_t> trips) const;
+};
+
+class SwitchStatement : public interface::AstNode<SwitchStatement> {
+public:
+  static constexpr const char *node_name = "Node_SwitchStatement";
+
+  // `case value:`, or `default:` without a value, placed before the body statement at statementIndex
+  struct CaseLabel {
+    std::optional<int32_t> value;
+    size_t statementIndex;
+  };
+
+public:
+  SwitchStatement(Expression &&condition, CodeBlock &&body, std::vector<CaseLabel> &&labels)
+      : condition(std::move(condition)), body(std::move(body)), labels(std::move(labels)) {}
+
+  inline void debug(size_t depth) const;
+
+  inline void decorate (scopes::ScopeStack &scopeStack, scopes::Scope &scope);
+
+  inline void computeLiveness(codegen::LivenessBuilder &liveness);
+  inline void summarize(InlineSummary &summary) const;
+  inline void collectLoopEffects(LoopEffects &effects) const;
+  inline void replaceInvariants(LoopInvariantHoister &hoister);
+  inline void foldConstantCalls(ConstantEvaluator &evaluator);
+  inline void specializeCalls(CallSpecializer &specializer, uint32_t loopDepth);
+  inline Completion evaluate(ConstantEvaluator &evaluator) const;
+
+  inline void hoistLoopInvariants(scopes::ScopeStack &scopeStack, scopes::Scope &scope);
+
+  inline void inlineCalls(Inliner &inliner, uint32_t loopDepth);
+
+  inline void genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const;
+
+private:
+  Expression condition;
+  CodeBlock body;
+  std::vector<CaseLabel> labels;
+};
+
+// Body of a call expanded in place by the Inliner. The parameters are locals of the body, initialized with the
+// arguments, and returns jump to the end of the body.
+class InlinedCall : public interface::AstNode<InlinedCall> {
+public:
+  static constexpr const char *node_name = "Node_InlinedCall";
+
+public:
+  InlinedCall(std::string_view callee, std::vector<Declaration> &&parameters, CodeBlock &&body)
+      : callee(callee), parameters(std::move(parameters)), body(std::move(body)) {}
+
+  inline void debug(size_t depth) const;
+
+  inline void decorate (scopes::ScopeStack &scopeStack, scopes::Scope &scope);
+
+  inline void computeLiveness(codegen::LivenessBuilder &liveness);
+  inline void summarize(InlineSummary &summary) const;
+  inline void collectLoopEffects(LoopEffects &effects) const;
+  inline void replaceInvariants(LoopInvariantHoister &hoister);
+  inline void foldConstantCalls(ConstantEvaluator &evaluator);
+  inline void specializeCalls(CallSpecializer &specializer, uint32_t loopDepth);
+  inline Completion evaluate(ConstantEvaluator &evaluator) const;
+
+  inline void hoistLoopInvariants(scopes::ScopeStack &scopeStack, scopes::Scope &scope);
+
+  // The body was copied with its own calls already expanded
+  inline void inlineCalls(Inliner &inliner, uint32_t loopDepth) { (void)inliner; (void)loopDepth; }
+
+  inline void genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const;
+
+private:
+  std::string_view callee;
+  std::vector<Declaration> parameters;
+  CodeBlock body;
 };
 
 class FunctionParameter : public interface::AstNode<FunctionParameter> {
@@ -501,10 +1204,17 @@ public:
 
   inline void decorate (scopes::ScopeStack &scopeStack, scopes::Scope &scope);
 
+  // index is the position in the parameter list, which gives the incoming register or stack slot
+  inline void computeLiveness(codegen::LivenessBuilder &liveness, size_t index, codegen::programPoint_t entry);
+
   inline const scopes::TypeDescription *getTypeDescription() const {
     return type.getTypeDescription();
   }
 
+  inline const Type &getType() const { return type; }
+
+  inline const Variable &getVariable() const { return variable; }
+
 private:
   Type type;
   Variable variable;
@@ -521,6 +1231,10 @@ public:
 
   inline void decorate (scopes::ScopeStack &scopeStack, scopes::Scope &scope);
 
+  inline std::string_view getName() const { return variable.getName(); }
+
+  inline const scopes::TypeDescription *getTypeDescription() const { return type.getTypeDescription(); }
+
 private:
   Type type;
   Variable variable;
@@ -545,6 +1259,12 @@ public:
   inline std::vector<FunctionParameter>::iterator end() {
     return parameters.end();
   }
+  inline std::vector<FunctionParameter>::const_iterator begin() const {
+    return parameters.begin();
+  }
+  inline std::vector<FunctionParameter>::const_iterator end() const {
+    return parameters.end();
+  }
 
 private:
   std::vector<FunctionParameter> parameters;
@@ -578,21 +1298,63 @@ public:
 
 public:
   Function(Type &&returnType, std::string_view name,
-           FunctionParameterList &&params, CodeBlock &&body)
-      : returnType(returnType), name(name), params(params), body(std::move(body)) {}
+           FunctionParameterList &&params, CodeBlock &&body, InlineHint inlineHint = InlineHint::NONE,
+           bool isConstexpr = false)
+      : returnType(returnType), name(name), params(params), body(std::move(body)), inlineHint(inlineHint),
+        constexprSpecified(isConstexpr) {}
 
   inline void debug(size_t depth) const;
 
   inline void decorate (scopes::ScopeStack &scopeStack, scopes::Scope &scope);
 
+  inline std::string_view getName() const { return name; }
+
+  inline const FunctionParameterList &getParams() const { return params; }
+
+  inline const CodeBlock &getBody() const { return body; }
+
+  inline InlineHint getInlineHint() const { return inlineHint; }
+
+  inline bool isConstexpr() const { return constexprSpecified; }
+
+  inline const scopes::TypeDescription *getReturnType() const { return returnType.getTypeDescription(); }
+
+  inline void summarize(InlineSummary &summary) const {
+    for (const auto &param : params) summary.declaredNames.insert(param.getVariable().getName());
+    body.summarize(summary);
+  }
+
+  inline void inlineCalls(Inliner &inliner) { body.inlineCalls(inliner, 0); }
+
+  inline void hoistLoopInvariants(scopes::ScopeStack &scopeStack) { body.hoistLoopInvariants(scopeStack, *body.getScope()); }
+
+  inline void foldConstantCalls(ConstantEvaluator &evaluator) { body.foldConstantCalls(evaluator); }
+
+  inline void specializeCalls(CallSpecializer &specializer) { body.specializeCalls(specializer, 0); }
+
+  // Copy of the function under another name, local to the translation unit, without the parameters that are bound or
+  // dropped. The specializer then replaces the reads of the bound ones by their literal.
+  inline Function cloneSpecialized(std::string_view cloneName, const std::vector<ParameterBinding> &bindings) const;
+
+  inline void allocateRegisters();
+
+  inline void debugRegisterAllocation() const;
+
   inline void genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const;
 
+  inline bool isExported() const { return exported; }
+
 private:
   Type returnType;
   std::string_view name;
   FunctionParameterList params;
   CodeBlock body;
+  InlineHint inlineHint;
+  bool constexprSpecified;
+  // Specialized clones are only called from the translation unit: no global symbol
+  bool exported = true;
   const scopes::FunctionDescription *description = nullptr;
+  codegen::FunctionAllocation allocation;
 };
 
 class Method : public interface::AstNode<Method> {
@@ -639,17 +1401,33 @@ public:
   using MethodList = std::vector<std::pair<Method, AccessSpecifier>>;
 
 public:
-  Class(std::string_view name, AttributeList &&attributes, MethodList &&methods)
-      : name(name), attributes(attributes), methods(methods) {}
+  Class(std::string_view name, AttributeList &&attributes, MethodList &&methods, bool reorder = false)
+      : name(name), attributes(attributes), methods(methods), reorder(reorder) {}
 
   inline void debug(size_t depth) const;
 
+  // Registers the class type with its layout: declared before any function, which may declare objects of it
   inline void decorate (scopes::ScopeStack &scopeStack, scopes::Scope &scope);
 
+  inline ClassLayoutEntry layoutEntry() const { return {getTypeDescription(), reorder, alternativeSize}; }
+
+  inline const scopes::TypeDescription *getTypeDescription() const {
+    if (description)
+      return description;
+    THROW("TypeDescription not set for class " << name);
+  }
+
+  inline void genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const;
+
 private:
   std::string_view name;
   AttributeList attributes;
   MethodList methods;
+  // [[zpp::reorder]]: fields sorted to minimize padding (see layoutClass)
+  bool reorder;
+  // Size of the class laid out the other way, reported by -fdump-class-layout
+  scopes::byteSize_t alternativeSize = 0;
+  const scopes::TypeDescription *description = nullptr;
 };
 
 class Statement: public interface::AstNode<Statement> {
@@ -661,7 +1439,9 @@ class Statement: public interface::AstNode<Statement> {
       CodeBlock,
       WhileStatement,
       DoStatement,
-      ForStatement
+      ForStatement,
+      SwitchStatement,
+      InlinedCall
     >;
 
   public:
@@ -672,12 +1452,76 @@ class Statement: public interface::AstNode<Statement> {
 
     inline void decorate (scopes::ScopeStack &scopeStack, scopes::Scope &scope);
 
+    inline void computeLiveness(codegen::LivenessBuilder &liveness);
+    inline void summarize(InlineSummary &summary) const;
+    inline void collectLoopEffects(LoopEffects &effects) const;
+    inline void replaceInvariants(LoopInvariantHoister &hoister);
+    inline void foldConstantCalls(ConstantEvaluator &evaluator);
+    inline void specializeCalls(CallSpecializer &specializer, uint32_t loopDepth);
+    inline Completion evaluate(ConstantEvaluator &evaluator) const;
+
+    inline void hoistLoopInvariants(scopes::ScopeStack &scopeStack, scopes::Scope &scope);
+
+    // Expands the call when the statement is one (see Inliner::expand)
+    inline void inlineCalls(Inliner &inliner, uint32_t loopDepth);
+
     inline void genAsm_x86_64(codegen::NasmGenerator_x86_64 &evaluator) const;
 
+    inline bool isEarlyExit() const {
+      const auto *conditional = std::get_if<ConditionalStatement>(&statement);
+      return conditional && conditional->isEarlyExit();
+    }
+
+    inline bool isReturn() const {
+      const auto *instruction = std::get_if<Instruction>(&statement);
+      return instruction && instruction->isReturn();
+    }
+
+    inline const Expression *asExpression() const {
+      const auto *instruction = std::get_if<Instruction>(&statement);
+      return instruction ? instruction->asExpression() : nullptr;
+    }
+
+    inline const FunctionCall *asFunctionCall() const {
+      const auto *expression = asExpression();
+      return expression ? expression->asFunctionCall() : nullptr;
+    }
+
+    inline const ConditionalStatement *asConditionalStatement() const { return std::get_if<ConditionalStatement>(&statement); }
+
   private:
     StatementVariant statement;
 };
 
+// Defined at namespace scope: stored in .data, .bss or .rodata, and addressed relative to rip
+class GlobalVariable : public interface::AstNode<GlobalVariable> {
+public:
+  static constexpr const char *node_name = "Node_GlobalVariable";
+
+public:
+  GlobalVariable(Type &&type, Variable &&variable, std::optional<Expression> &&initializer)
+      : type(std::move(type)), variable(std::move(variable)), initializer(std::move(initializer)) {}
+
+  inline void debug(size_t depth) const;
+
+  inline void decorate (scopes::ScopeStack &scopeStack, scopes::Scope &scope);
+
+  // There is no dynamic initialization: the initializer is evaluated at compile time, before the calls are folded.
+  // Const globals are then read as their value.
+  inline void evaluateInitializer(ConstantEvaluator &evaluator);
+
+  inline void genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const;
+
+  inline std::string_view getName() const { return variable.getName(); }
+
+private:
+  Type type;
+  Variable variable;
+  std::optional<Expression> initializer;
+  // Initializers other than string literals, once evaluated
+  std::optional<int32_t> initialValue;
+};
+
 class TranslationUnit : public interface::AstNode<TranslationUnit> {
 public:
   static constexpr const char *node_name = "Node_TranslationUnit";
@@ -685,13 +1529,33 @@ public:
 public:
   TranslationUnit(std::vector<FunctionDeclaration> &&functionDeclarations,
                   std::vector<Function> &&functions,
-                  std::vector<Class> &&classes)
-      : functionDeclarations(functionDeclarations), functions(functions), classes(classes) {}
+                  std::vector<Class> &&classes,
+                  std::vector<GlobalVariable> &&globals = {})
+      : functionDeclarations(functionDeclarations), functions(functions), classes(classes), globals(std::move(globals)) {}
 
   inline void debug(size_t depth) const;
 
   inline void decorate (scopes::ScopeStack &scopeStack, scopes::Scope &scope);
 
+  // Runs before decoration: expanded bodies are decorated in the scope of their call site
+  inline InlineReport inlineCalls();
+
+  // Runs after inlining, before decoration: remaining calls with constant or unused arguments are redirected to clones
+  inline SpecializationReport specializeCalls();
+
+  // Runs after decoration: hoisted values are stored in new variables of the scope enclosing the loop
+  inline void hoistLoopInvariants(scopes::ScopeStack &scopeStack);
+
+  // Runs after decoration, before loop invariants are hoisted: calls with constant arguments are replaced by their value
+  inline ConstantEvaluationReport evaluateConstantCalls(const ConstantEvaluationOptions &options);
+
+  inline void allocateRegisters();
+
+  inline void debugRegisterAllocation() const;
+
+  // Runs after decoration
+  inline ClassLayoutReport classLayouts() const;
+
   inline std::string genAsm_x86_64(codegen::NasmGenerator_x86_64 &evaluator) const;
 
   inline bool isDecorated() const { return true; }
@@ -700,6 +1564,9 @@ private:
   std::vector<FunctionDeclaration> functionDeclarations;
   std::vector<Function> functions;
   std::vector<Class> classes;
+  std::vector<GlobalVariable> globals;
+  // Names of the specialized clones, referenced by their Function and FunctionCall nodes
+  std::deque<std::string> cloneNames;
 };
 
 } /* namespace ast */
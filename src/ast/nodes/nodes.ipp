@@ -1,8 +1,14 @@
 #pragma once
 
+#include "nodes_consteval.ipp"
 #include "nodes_debug.ipp"
 #include "nodes_decorate.ipp"
 #include "nodes_genAsm_x86_64.ipp"
+#include "nodes_inline.ipp"
+#include "nodes_licm.ipp"
+#include "nodes_liveness.ipp"
 #include "nodes_loadValueInRegister.ipp"
+#include "nodes_specialize.ipp"
+#include "nodes_vectorize.ipp"
 
 #include "Assign.ipp"
@@ -0,0 +1,558 @@
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <set>
+#include <utility>
+
+#include "ast/constantEvaluation.hpp"
+#include "nodes.h"
+
+namespace ast {
+
+// Runs calls whose arguments are all literals at compile time, over the decorated AST, and replaces them by their
+// value. Callees are `constexpr` functions, or at -O2 any function defined here: the evaluation gives up on the first
+// inline asm block or call to a function without a body, so that only side-effect-free paths are ever folded. Ints
+// wrap around like the generated code does; a division that would trap keeps the call for the runtime to fault.
+class ConstantEvaluator {
+public:
+  ConstantEvaluator(const std::vector<Function> &functions, const ConstantEvaluationOptions &options) : options(options) {
+    for (const auto &function : functions) definitions.emplace(function.getName(), &function);
+  }
+
+  // Value of a global initializer or of an operation on literals, evaluated like the body of a call without parameters
+  std::optional<int32_t> evaluateInitializer(const Expression &initializer) {
+    steps = 0;
+    failure = nullptr;
+    frames.emplace_back();
+    auto value = initializer.evaluate(*this);
+    frames.pop_back();
+    return value;
+  }
+
+  const char *getFailure() const { return failure; }
+
+  // Const globals are read as their value, by the evaluation and by the generated code
+  void defineConstant(const scopes::VariableDescription *description, int32_t value) {
+    constants[description->variableId] = value;
+  }
+
+  std::optional<int32_t> constantValue(const Variable &variable) const {
+    auto constant = constants.find(variable.getVariableDescription()->variableId);
+    if (constant == constants.end()) return std::nullopt;
+    return constant->second;
+  }
+
+  ConstantEvaluationReport run(std::vector<Function> &functions) {
+    // Source order: callees are folded before their callers, which then evaluate faster
+    for (auto &function : functions) {
+      caller = &function;
+      function.foldConstantCalls(*this);
+    }
+    return std::move(report);
+  }
+
+  // Value of the call when its arguments are literals and its callee can run at compile time
+  std::optional<int32_t> tryEvaluate(const FunctionCall &call) {
+    const Function *callee = findCallee(call);
+    if (!callee) return std::nullopt;
+
+    std::vector<int32_t> arguments;
+    for (const auto &argument : call.getArguments()) {
+      const auto *literal = argument.asNumberLiteral();
+      if (!literal) return std::nullopt;
+      arguments.push_back(toInt32(literal->getValue()));
+    }
+
+    steps = 0;
+    failure = nullptr;
+    auto value = invoke(*callee, std::move(arguments));
+    report.decisions.push_back({caller->getName(), call.getName(), value.has_value(), value.value_or(0), failure, steps});
+    return value;
+  }
+
+  // Call left for the runtime: its callee stays emitted
+  void keep(const FunctionCall &call) { calls[caller->getName()].insert(call.getName()); }
+
+  // Exported functions, and the local ones still called from them after folding
+  std::set<std::string_view> reachableFunctions(const std::vector<Function> &functions) const {
+    std::set<std::string_view> reached;
+    std::vector<std::string_view> pending;
+    for (const auto &function : functions) {
+      if (function.isExported()) pending.push_back(function.getName());
+    }
+    while (!pending.empty()) {
+      auto name = pending.back();
+      pending.pop_back();
+      if (!reached.insert(name).second) continue;
+      auto callees = calls.find(name);
+      if (callees != calls.end()) pending.insert(pending.end(), callees->second.begin(), callees->second.end());
+    }
+    return reached;
+  }
+
+  // Nested call, met while evaluating a body
+  std::optional<int32_t> evaluateCall(const FunctionCall &call, std::vector<int32_t> &&arguments) {
+    const Function *callee = findCallee(call);
+    if (!callee) {
+      return fail(definitions.contains(call.getName()) ? "calls a function that is not constexpr" : "calls an extern function");
+    }
+    return invoke(*callee, std::move(arguments));
+  }
+
+  // Counts one statement or expression: false once the evaluation ran for too long
+  bool step() {
+    if (++steps <= CONSTEVAL_MAX_STEPS) return true;
+    fail("step limit");
+    return false;
+  }
+
+  std::optional<int32_t> read(const Variable &variable) {
+    if (variable.getVariableDescription()->isGlobal()) {
+      if (auto value = constantValue(variable)) return value;
+      return fail("reads a global variable that is not const");
+    }
+    auto &frame = frames.back();
+    auto value = frame.find(variable.getVariableDescription()->variableId);
+    if (value == frame.end()) return fail("reads an uninitialized variable");
+    return value->second;
+  }
+
+  // Narrow variables keep the sign-extended value of their low bytes
+  std::optional<int32_t> write(const Variable &variable, int32_t value) {
+    if (variable.getVariableDescription()->isGlobal()) return fail("writes a global variable");
+    return frames.back()[variable.getVariableDescription()->variableId] = convert(value, variable.getType());
+  }
+
+  // A declaration without initializer, run again by a loop, forgets the previous value
+  void forget(const Variable &variable) { frames.back().erase(variable.getVariableDescription()->variableId); }
+
+  void setReturnValue(int32_t value) { returned = value; }
+
+  // The first failure is the one reported
+  std::nullopt_t fail(const char *reason) {
+    if (!failure) failure = reason;
+    return std::nullopt;
+  }
+
+  static int32_t toInt32(NumberLiteralUnderlyingType value) { return static_cast<int32_t>(static_cast<uint32_t>(value)); }
+
+private:
+  const Function *findCallee(const FunctionCall &call) const {
+    auto definition = definitions.find(call.getName());
+    if (definition == definitions.end()) return nullptr;
+    if (!options.evaluatePureFunctions && !definition->second->isConstexpr()) return nullptr;
+    return definition->second;
+  }
+
+  std::optional<int32_t> invoke(const Function &function, std::vector<int32_t> &&arguments) {
+    if (function.getReturnType()->byteSize == 0) return fail("returns void");
+    if (arguments.size() != function.getParams().size()) return fail("argument count mismatch");
+    if (frames.size() >= CONSTEVAL_MAX_DEPTH) return fail("recursion limit");
+
+    auto &frame = frames.emplace_back();
+    auto argument = arguments.begin();
+    for (const auto &parameter : function.getParams()) {
+      // Unnamed parameters have no variable to bind
+      const auto &variable = parameter.getVariable();
+      if (variable.isDecorated()) frame[variable.getVariableDescription()->variableId] = convert(*argument, parameter.getTypeDescription());
+      argument++;
+    }
+
+    auto completion = function.getBody().evaluate(*this);
+    frames.pop_back();
+    if (completion == Completion::FAILED) return std::nullopt;
+    if (completion != Completion::RETURN || !returned) return fail("flows off the end without a return");
+    return convert(*std::exchange(returned, std::nullopt), function.getReturnType());
+  }
+
+public:
+  static int32_t convert(int32_t value, const scopes::TypeDescription *type) {
+    if (type->byteSize == 1) return static_cast<int8_t>(value);
+    return value;
+  }
+
+private:
+  const ConstantEvaluationOptions &options;
+  std::map<std::string_view, const Function *> definitions;
+  // Values of the variables of each call in progress
+  std::vector<std::map<scopes::id_t, int32_t>> frames;
+  std::map<scopes::id_t, int32_t> constants;
+  std::optional<int32_t> returned;
+  uint64_t steps = 0;
+  const char *failure = nullptr;
+  const Function *caller = nullptr;
+  // Callees of the calls left in each function
+  std::map<std::string_view, std::set<std::string_view>> calls;
+  ConstantEvaluationReport report;
+};
+
+inline ConstantEvaluationReport TranslationUnit::evaluateConstantCalls(const ConstantEvaluationOptions &options) {
+  ConstantEvaluator evaluator(functions, options);
+  // Source order: an initializer reads the const globals defined before it
+  for (auto &global : globals) global.evaluateInitializer(evaluator);
+  auto report = evaluator.run(functions);
+  // A specialized clone whose calls were all folded is not emitted
+  auto reachable = evaluator.reachableFunctions(functions);
+  std::erase_if(functions, [&reachable](const Function &function) { return !reachable.contains(function.getName()); });
+  return report;
+}
+
+inline void GlobalVariable::evaluateInitializer(ConstantEvaluator &evaluator) {
+  if (!initializer || initializer->asStringLiteral()) return;
+
+  auto value = evaluator.evaluateInitializer(*initializer);
+  USER_ASSERT(value.has_value(), "Initializer of global " << variable.getName() << " is not a constant expression ("
+              << evaluator.getFailure() << ")");
+  const auto *typeDescription = variable.getType();
+  USER_ASSERT(typeDescription->id != scopes::IDX_POINTER_TYPE || *value == 0,
+              "Global pointer " << variable.getName() << " can only be initialized with a string literal or 0");
+
+  initialValue = ConstantEvaluator::convert(*value, typeDescription);
+  if (variable.getVariableDescription()->isReadOnly) evaluator.defineConstant(variable.getVariableDescription(), *initialValue);
+}
+
+/** Folding: calls are replaced bottom-up, a call of literals may become the argument of its parent **/
+
+inline void Variable::foldConstantCalls(ConstantEvaluator &evaluator) {
+  (void)evaluator;
+}
+
+inline void NumberLiteral::foldConstantCalls(ConstantEvaluator &evaluator) {
+  (void)evaluator;
+}
+
+inline void StringLiteral::foldConstantCalls(ConstantEvaluator &evaluator) {
+  (void)evaluator;
+}
+
+inline void FunctionCall::foldConstantCalls(ConstantEvaluator &evaluator) {
+  for (auto &argument : arguments) {
+    argument.foldConstantCalls(evaluator);
+  }
+}
+
+inline void BinaryOperation::foldConstantCalls(ConstantEvaluator &evaluator) {
+  lhs->foldConstantCalls(evaluator);
+  rhs->foldConstantCalls(evaluator);
+  registerNeed = computeRegisterNeed();
+}
+
+inline void UnaryOperation::foldConstantCalls(ConstantEvaluator &evaluator) {
+  operand->foldConstantCalls(evaluator);
+}
+
+inline void Assign::foldConstantCalls(ConstantEvaluator &evaluator) {
+  if (index) index->foldConstantCalls(evaluator);
+  rhs->foldConstantCalls(evaluator);
+}
+
+inline void Subscript::foldConstantCalls(ConstantEvaluator &evaluator) {
+  index->foldConstantCalls(evaluator);
+}
+
+inline void Expression::foldConstantCalls(ConstantEvaluator &evaluator, bool valueUsed) {
+  std::visit([&evaluator](auto &node) { node.foldConstantCalls(evaluator); }, expr);
+  registerNeed = std::visit([](const auto &node) { return node.getRegisterNeed(); }, expr);
+
+  if (const auto *variable = asVariable(); variable && variable->getVariableDescription()->isGlobal()) {
+    if (auto value = evaluator.constantValue(*variable)) replaceByConstant(*value);
+    return;
+  }
+
+  // Literals left by folded operands or specialized parameters: the operation runs once here instead of at every call
+  if (const auto *operation = asBinaryOperation();
+      operation && operation->getLhs().asNumberLiteral() && operation->getRhs().asNumberLiteral()) {
+    if (auto value = evaluator.evaluateInitializer(*this)) replaceByConstant(*value);
+    return;
+  }
+
+  const auto *call = asFunctionCall();
+  if (!call) return;
+  if (auto value = valueUsed ? evaluator.tryEvaluate(*call) : std::nullopt) replaceByConstant(*value);
+  else evaluator.keep(*call);
+}
+
+inline void Declaration::foldConstantCalls(ConstantEvaluator &evaluator) {
+  if (assignment) assignment->foldConstantCalls(evaluator);
+}
+
+inline void ReturnStatement::foldConstantCalls(ConstantEvaluator &evaluator) {
+  expression.foldConstantCalls(evaluator);
+}
+
+inline void BreakStatement::foldConstantCalls(ConstantEvaluator &evaluator) {
+  (void)evaluator;
+}
+
+inline void InlineAsmStatement::foldConstantCalls(ConstantEvaluator &evaluator) {
+  (void)evaluator;
+}
+
+inline void Instruction::foldConstantCalls(ConstantEvaluator &evaluator) {
+  std::visit([&evaluator](auto &node) {
+    using T = std::decay_t<decltype(node)>;
+    if constexpr (std::is_same_v<T, Expression>) node.foldConstantCalls(evaluator, false);
+    else node.foldConstantCalls(evaluator);
+  }, instr);
+}
+
+inline void CodeBlock::foldConstantCalls(ConstantEvaluator &evaluator) {
+  for (auto &statement : statements) {
+    statement.foldConstantCalls(evaluator);
+  }
+}
+
+inline void ConditionalStatement::foldConstantCalls(ConstantEvaluator &evaluator) {
+  condition.foldConstantCalls(evaluator);
+  ifBody.foldConstantCalls(evaluator);
+  if (elseBody) elseBody->foldConstantCalls(evaluator);
+}
+
+inline void WhileStatement::foldConstantCalls(ConstantEvaluator &evaluator) {
+  condition.foldConstantCalls(evaluator);
+  body.foldConstantCalls(evaluator);
+}
+
+inline void DoStatement::foldConstantCalls(ConstantEvaluator &evaluator) {
+  body.foldConstantCalls(evaluator);
+  expr.foldConstantCalls(evaluator);
+}
+
+inline void ForStatement::foldConstantCalls(ConstantEvaluator &evaluator) {
+  init.foldConstantCalls(evaluator);
+  if (condition) condition->foldConstantCalls(evaluator);
+  body.foldConstantCalls(evaluator);
+  if (expr) expr->foldConstantCalls(evaluator);
+}
+
+inline void SwitchStatement::foldConstantCalls(ConstantEvaluator &evaluator) {
+  condition.foldConstantCalls(evaluator);
+  body.foldConstantCalls(evaluator);
+}
+
+inline void InlinedCall::foldConstantCalls(ConstantEvaluator &evaluator) {
+  for (auto &parameter : parameters) {
+    parameter.foldConstantCalls(evaluator);
+  }
+  body.foldConstantCalls(evaluator);
+}
+
+inline void Statement::foldConstantCalls(ConstantEvaluator &evaluator) {
+  std::visit([&evaluator](auto &node) { node.foldConstantCalls(evaluator); }, statement);
+}
+
+/** Evaluation **/
+
+inline std::optional<int32_t> Variable::evaluate(ConstantEvaluator &evaluator) const {
+  return evaluator.read(*this);
+}
+
+inline std::optional<int32_t> NumberLiteral::evaluate(ConstantEvaluator &evaluator) const {
+  (void)evaluator;
+  return ConstantEvaluator::toInt32(number);
+}
+
+inline std::optional<int32_t> StringLiteral::evaluate(ConstantEvaluator &evaluator) const {
+  return evaluator.fail("takes the address of a string literal");
+}
+
+inline std::optional<int32_t> FunctionCall::evaluate(ConstantEvaluator &evaluator) const {
+  std::vector<int32_t> values;
+  for (const auto &argument : arguments) {
+    auto value = argument.evaluate(evaluator);
+    if (!value) return std::nullopt;
+    values.push_back(*value);
+  }
+  return evaluator.evaluateCall(*this, std::move(values));
+}
+
+inline std::optional<int32_t> BinaryOperation::evaluate(ConstantEvaluator &evaluator) const {
+  auto left = lhs->evaluate(evaluator);
+  if (!left) return std::nullopt;
+
+  // The rhs is only evaluated when the lhs does not decide
+  if (isLogical()) {
+    bool decidedByLhs = op == Operation::LOGICAL_OR ? *left != 0 : *left == 0;
+    if (decidedByLhs) return op == Operation::LOGICAL_OR;
+    auto right = rhs->evaluate(evaluator);
+    if (!right) return std::nullopt;
+    return *right != 0;
+  }
+
+  auto right = rhs->evaluate(evaluator);
+  if (!right) return std::nullopt;
+  if (isComparison()) return codegen::evaluateCondition(static_cast<codegen::CMP_OPERATION>(op), *left, *right);
+
+  uint32_t a = static_cast<uint32_t>(*left);
+  uint32_t b = static_cast<uint32_t>(*right);
+  switch (op) {
+    case Operation::ADD: return static_cast<int32_t>(a + b);
+    case Operation::SUBSTRACT: return static_cast<int32_t>(a - b);
+    case Operation::MULTIPLY: return static_cast<int32_t>(a * b);
+    case Operation::DIVIDE:
+    case Operation::MODULO:
+      // idiv faults on both
+      if (*right == 0) return evaluator.fail("divides by zero");
+      if (*left == std::numeric_limits<int32_t>::min() && *right == -1) return evaluator.fail("division overflows");
+      return op == Operation::DIVIDE ? *left / *right : *left % *right;
+    default:
+      THROW("Unrecognised operation " << static_cast<char>(op));
+  }
+}
+
+inline std::optional<int32_t> UnaryOperation::evaluate(ConstantEvaluator &evaluator) const {
+  auto value = operand->evaluate(evaluator);
+  if (!value) return std::nullopt;
+  return *value == 0;
+}
+
+// Arrays are not tracked by the evaluation
+inline std::optional<int32_t> Subscript::evaluate(ConstantEvaluator &evaluator) const {
+  return evaluator.fail("reads an array element");
+}
+
+inline std::optional<int32_t> Assign::evaluate(ConstantEvaluator &evaluator) const {
+  if (index) return evaluator.fail("writes an array element");
+  auto value = rhs->evaluate(evaluator);
+  if (!value) return std::nullopt;
+  return evaluator.write(*lhs, *value);
+}
+
+inline std::optional<int32_t> Expression::evaluate(ConstantEvaluator &evaluator) const {
+  if (!evaluator.step()) return std::nullopt;
+  return std::visit([&evaluator](const auto &node) { return node.evaluate(evaluator); }, expr);
+}
+
+inline Completion Declaration::evaluate(ConstantEvaluator &evaluator) const {
+  if (!assignment) {
+    evaluator.forget(variable);
+    return Completion::NORMAL;
+  }
+  auto value = assignment->evaluate(evaluator);
+  if (!value) return Completion::FAILED;
+  evaluator.write(variable, *value);
+  return Completion::NORMAL;
+}
+
+inline Completion ReturnStatement::evaluate(ConstantEvaluator &evaluator) const {
+  auto value = expression.evaluate(evaluator);
+  if (!value) return Completion::FAILED;
+  evaluator.setReturnValue(*value);
+  return Completion::RETURN;
+}
+
+inline Completion BreakStatement::evaluate(ConstantEvaluator &evaluator) const {
+  (void)evaluator;
+  return Completion::BREAK;
+}
+
+inline Completion InlineAsmStatement::evaluate(ConstantEvaluator &evaluator) const {
+  evaluator.fail("runs inline asm");
+  return Completion::FAILED;
+}
+
+inline Completion Instruction::evaluate(ConstantEvaluator &evaluator) const {
+  return std::visit([&evaluator](const auto &node) {
+    using T = std::decay_t<decltype(node)>;
+    if constexpr (std::is_same_v<T, Expression>) return node.evaluate(evaluator) ? Completion::NORMAL : Completion::FAILED;
+    else return node.evaluate(evaluator);
+  }, instr);
+}
+
+inline Completion CodeBlock::evaluate(ConstantEvaluator &evaluator) const {
+  for (const auto &statement : statements) {
+    auto completion = statement.evaluate(evaluator);
+    if (completion != Completion::NORMAL) return completion;
+  }
+  return Completion::NORMAL;
+}
+
+inline Completion ConditionalStatement::evaluate(ConstantEvaluator &evaluator) const {
+  auto value = condition.evaluate(evaluator);
+  if (!value) return Completion::FAILED;
+  if (*value) return ifBody.evaluate(evaluator);
+  return elseBody ? elseBody->evaluate(evaluator) : Completion::NORMAL;
+}
+
+// An iteration ending on a break leaves the loop normally, returns and failures leave it as they are
+static inline std::optional<Completion> leavesLoop(Completion completion) {
+  if (completion == Completion::BREAK) return Completion::NORMAL;
+  if (completion != Completion::NORMAL) return completion;
+  return std::nullopt;
+}
+
+static inline Completion evaluateDeclarations(ConstantEvaluator &evaluator, const std::vector<Declaration> &preheader) {
+  for (const auto &declaration : preheader) {
+    if (declaration.evaluate(evaluator) == Completion::FAILED) return Completion::FAILED;
+  }
+  return Completion::NORMAL;
+}
+
+inline Completion WhileStatement::evaluate(ConstantEvaluator &evaluator) const {
+  if (evaluateDeclarations(evaluator, preheader) == Completion::FAILED) return Completion::FAILED;
+  while (evaluator.step()) {
+    auto value = condition.evaluate(evaluator);
+    if (!value) return Completion::FAILED;
+    if (!*value) return Completion::NORMAL;
+    if (auto completion = leavesLoop(body.evaluate(evaluator))) return *completion;
+  }
+  return Completion::FAILED;
+}
+
+inline Completion DoStatement::evaluate(ConstantEvaluator &evaluator) const {
+  if (evaluateDeclarations(evaluator, preheader) == Completion::FAILED) return Completion::FAILED;
+  while (evaluator.step()) {
+    if (auto completion = leavesLoop(body.evaluate(evaluator))) return *completion;
+    auto value = expr.evaluate(evaluator);
+    if (!value) return Completion::FAILED;
+    if (!*value) return Completion::NORMAL;
+  }
+  return Completion::FAILED;
+}
+
+inline Completion ForStatement::evaluate(ConstantEvaluator &evaluator) const {
+  if (init.evaluate(evaluator) == Completion::FAILED) return Completion::FAILED;
+  if (evaluateDeclarations(evaluator, preheader) == Completion::FAILED) return Completion::FAILED;
+  while (evaluator.step()) {
+    if (condition) {
+      auto value = condition->evaluate(evaluator);
+      if (!value) return Completion::FAILED;
+      if (!*value) return Completion::NORMAL;
+    }
+    if (auto completion = leavesLoop(body.evaluate(evaluator))) return *completion;
+    if (expr && !expr->evaluate(evaluator)) return Completion::FAILED;
+  }
+  return Completion::FAILED;
+}
+
+// Runs the body from the matching label: later cases fall through until a break
+inline Completion SwitchStatement::evaluate(ConstantEvaluator &evaluator) const {
+  auto value = condition.evaluate(evaluator);
+  if (!value) return Completion::FAILED;
+
+  auto label = std::ranges::find_if(labels, [&value](const CaseLabel &label) { return label.value == *value; });
+  if (label == labels.end()) label = std::ranges::find_if(labels, [](const CaseLabel &label) { return !label.value; });
+  if (label == labels.end()) return Completion::NORMAL;
+
+  const auto &statements = body.getStatements();
+  for (size_t i = label->statementIndex; i < statements.size(); i++) {
+    auto completion = statements[i].evaluate(evaluator);
+    if (completion == Completion::BREAK) return Completion::NORMAL;
+    if (completion != Completion::NORMAL) return completion;
+  }
+  return Completion::NORMAL;
+}
+
+// Returns of the expanded body only leave the body: the value of a call statement is dropped
+inline Completion InlinedCall::evaluate(ConstantEvaluator &evaluator) const {
+  if (evaluateDeclarations(evaluator, parameters) == Completion::FAILED) return Completion::FAILED;
+  auto completion = body.evaluate(evaluator);
+  return completion == Completion::RETURN ? Completion::NORMAL : completion;
+}
+
+inline Completion Statement::evaluate(ConstantEvaluator &evaluator) const {
+  if (!evaluator.step()) return Completion::FAILED;
+  return std::visit([&evaluator](const auto &node) { return node.evaluate(evaluator); }, statement);
+}
+
+} /* namespace ast */
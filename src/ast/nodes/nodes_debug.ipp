@@ -1,6 +1,7 @@
 #include <cstddef>
 #include <ostream>
 #include <ranges>
+#include <sstream>
 #include <variant>
 #include <vector>
 
@@ -21,7 +22,10 @@ inline void Type::debug(size_t depth) const {
 }
 
 inline void Variable::debug(size_t depth) const {
-  logNode(depth, name);
+  std::stringstream path;
+  path << name;
+  for (auto member : members) path << "." << member;
+  logNode(depth, path.str());
   if (description)
     logDecoration(depth + 1,
                   "VariableDescription: Id: ", description->variableId);
@@ -33,6 +37,7 @@ inline void StringLiteral::debug(size_t depth) const { logNode(depth, content);
 
 inline void Expression::debug(size_t depth) const {
   std::visit([depth](const auto &node) { node.debug(depth); }, expr);
+  if (type) logDecoration(depth + 1, "ExpressionType: ", type->name, " ; RegisterNeed: ", registerNeed);
 }
 
 inline void FunctionCall::debug(size_t depth) const {
@@ -48,6 +53,17 @@ inline void BinaryOperation::debug(size_t depth) const {
   rhs->debug(depth+1);
 }
 
+inline void UnaryOperation::debug(size_t depth) const {
+  logNode(depth, static_cast<char>(op));
+  operand->debug(depth+1);
+}
+
+inline void Subscript::debug(size_t depth) const {
+  logNode(depth);
+  array.debug(depth+1);
+  index->debug(depth+1);
+}
+
 inline void Declaration::debug(size_t depth) const {
   logNode(depth, "Type: ", type.fullName(),
           " ; Assignment: ", assignment.has_value());
@@ -62,11 +78,24 @@ inline void ReturnStatement::debug(size_t depth) const {
   expression.debug(depth);
 }
 
+inline void BreakStatement::debug(size_t depth) const {
+  logNode(depth);
+}
+
 inline void InlineAsmStatement::debug(size_t depth) const {
   logNode(depth, "Register binding request count: ", requests.size());
+  static constexpr const char *constraintPrefixes[] = {"", "=", "+"};
   for (auto &request : requests) {
-    LOG_DEBUG(INDENT_D(depth) << "[Request] " << request.registerTo << "("
-                              << request.varIdentifier << ")");
+    LOG_DEBUG(INDENT_D(depth) << "[Request] " << constraintPrefixes[static_cast<size_t>(request.constraint)]
+                              << request.registerTo << "(" << request.variable.getName() << ")");
+  }
+  if (clobbers) {
+    std::stringstream names;
+    auto clobbered = clobberedRegisters();
+    for (size_t reg = 0; reg < clobbered.size(); reg++) {
+      if (clobbered.test(reg)) names << " " << scopes::regToStr(static_cast<scopes::GeneralPurposeRegister>(reg));
+    }
+    logDecoration(depth + 1, "Clobbers:", names.str());
   }
   asmBlock.debug(depth + 1);
 }
@@ -179,13 +208,19 @@ inline void ConditionalStatement::debug(size_t depth) const {
 }
 
 inline void WhileStatement::debug(size_t depth) const {
-  logNode(depth);
+  logNode(depth, "Preheader: ", preheader.size());
+  for (const auto &declaration : preheader) {
+    declaration.debug(depth + 1);
+  }
   condition.debug(depth + 1);
   body.debug(depth + 1);
 }
 
 inline void DoStatement::debug(size_t depth) const {
-  logNode(depth);
+  logNode(depth, "Preheader: ", preheader.size());
+  for (const auto &declaration : preheader) {
+    declaration.debug(depth + 1);
+  }
   expr.debug(depth + 1);
   body.debug(depth + 1);
 }
@@ -193,12 +228,46 @@ inline void DoStatement::debug(size_t depth) const {
 inline void ForStatement::debug(size_t depth) const {
   logNode(depth, "HasCondition:", condition.has_value(), "HasExpression:", expr.has_value());
   init.debug(depth + 1);
+  for (const auto &declaration : preheader) {
+    declaration.debug(depth + 1);
+  }
   if (condition) condition->debug(depth + 1);
   if (expr) expr->debug(depth + 1);
   body.debug(depth + 1);
 }
 
+inline void SwitchStatement::debug(size_t depth) const {
+  logNode(depth, "Labels: ", labels.size());
+  condition.debug(depth + 1);
+  for (const auto &label : labels) {
+    if (label.value) logNode(depth + 1, "Case ", *label.value, " ; Statement: ", label.statementIndex);
+    else logNode(depth + 1, "Default ; Statement: ", label.statementIndex);
+  }
+  body.debug(depth + 1);
+}
+
+inline void InlinedCall::debug(size_t depth) const {
+  logNode(depth, "Callee: ", callee, " ; ParamCount: ", parameters.size());
+  for (const auto &parameter : parameters) {
+    parameter.debug(depth + 1);
+  }
+  body.debug(depth + 1);
+}
+
+inline void GlobalVariable::debug(size_t depth) const {
+  logNode(depth, "Type: ", type.fullName(), " ; Initializer: ", initializer.has_value());
+  variable.debug(depth + 1);
+  if (initializer.has_value()) {
+    initializer->debug(depth + 1);
+  }
+}
+
 inline void TranslationUnit::debug(size_t depth) const {
+  logNode(depth, "Global count: ", globals.size());
+  for (const auto &global : globals) {
+    global.debug(depth + 1);
+  }
+
   logNode(depth, "Function count: ", functions.size());
   for (const auto &funcNode : functions) {
     funcNode.debug(depth + 1);
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <string_view>
 #include <variant>
 #include <vector>
@@ -9,13 +10,22 @@
 
 namespace ast {
 inline void Type::decorate(scopes::ScopeStack &scopeStack, scopes::Scope &scope) {
-  (void)scopeStack;
   description = scope.findType(name);
+  if (pointerDepth > 0) description = &scopes::POINTER_TYPE;
+  if (!arrayLength) return;
+  USER_ASSERT(description->id != scopes::IDX_VOID_TYPE && !description->isClass(), "Arrays of " << fullName() << " are not supported: elements are chars, ints or pointers");
+  description = scopeStack.arrayType(description, *arrayLength);
 }
 
 inline void Variable::decorate(scopes::ScopeStack &scopeStack, scopes::Scope &scope) {
   (void)scopeStack;
   description = scope.findVariable(name);
+  for (auto member : members) {
+    const auto &fields = (*description->typeDescription)->fields;
+    auto field = std::ranges::find(fields, member, &scopes::FieldDescription::name);
+    USER_ASSERT(field != fields.end(), "No member " << member << " in " << (*description->typeDescription)->name);
+    description = &description->members[field - fields.begin()];
+  }
 }
 
 inline void NumberLiteral::decorate(scopes::ScopeStack &scopeStack,
@@ -35,11 +45,15 @@ inline void Expression::decorate(scopes::ScopeStack &scopeStack,
   std::visit(
       [&scopeStack, &scope](auto &node) { node.decorate(scopeStack, scope); },
       expr);
+  type = std::visit([](const auto &node) { return node.getType(); }, expr);
+  USER_ASSERT(!type->isClass(), "Objects of class " << type->name << " can only be used through their members");
+  USER_ASSERT(!type->isArray(), "Arrays of type " << type->name << " can only be used through their elements");
+  registerNeed = std::visit([](const auto &node) { return node.getRegisterNeed(); }, expr);
 }
 
 inline void FunctionCall::decorate(scopes::ScopeStack &scopeStack,
                             scopes::Scope &scope) {
-  scope.findFunction(name);
+  description = scope.findFunction(name);
   for (auto &arg : arguments) {
     arg.decorate(scopeStack, scope);
   }
@@ -48,15 +62,43 @@ inline void FunctionCall::decorate(scopes::ScopeStack &scopeStack,
 inline void BinaryOperation::decorate(scopes::ScopeStack &scopeStack, scopes::Scope &scope) {
   lhs->decorate(scopeStack, scope);
   rhs->decorate(scopeStack, scope);
-  // TODO add binary operation return type to decoration based on lhs & rhs
+  operandType = scopes::commonType(lhs->getType(), rhs->getType());
+  registerNeed = computeRegisterNeed();
+}
+
+inline void UnaryOperation::decorate(scopes::ScopeStack &scopeStack, scopes::Scope &scope) {
+  operand->decorate(scopeStack, scope);
+}
+
+inline void Subscript::decorate(scopes::ScopeStack &scopeStack, scopes::Scope &scope) {
+  array.decorate(scopeStack, scope);
+  USER_ASSERT(array.getType()->isArray(), array.getName() << " is not an array");
+  index->decorate(scopeStack, scope);
+  checkIndex(array, *index);
+}
+
+inline void Subscript::checkIndex(const Variable &array, const Expression &index) {
+  const auto *arrayType = array.getType();
+  auto indexType = index.getType()->id;
+  USER_ASSERT(indexType == scopes::IDX_INT_TYPE || indexType == scopes::IDX_CHAR_TYPE, "Index of " << array.getName() << " is not an integer");
+  auto constant = index.asInt32Constant();
+  USER_ASSERT(!constant || (*constant >= 0 && static_cast<scopes::byteSize_t>(*constant) < arrayType->elementCount),
+              "Index " << *constant << " out of the bounds of " << array.getName() << " (" << arrayType->name << ")");
 }
 
 
 inline void Declaration::decorate(scopes::ScopeStack &scopeStack,
                            scopes::Scope &scope) {
+  decorateBinding(scopeStack, scope, scope);
+}
+
+inline void Declaration::decorateBinding(scopes::ScopeStack &scopeStack, scopes::Scope &valueScope, scopes::Scope &scope) {
   type.decorate(scopeStack, scope);
+  if (assignment) assignment->decorate(scopeStack, valueScope);
+  USER_ASSERT(assignment || !type.isReadOnly(), "Uninitialized const variable " << variable.getName());
+  USER_ASSERT(!assignment || !type.getTypeDescription()->isArray(), "Arrays can not be initialized yet");
   scopeStack.addLocalVariable(variable.getName(), type.getTypeDescription(),
-                              scope);
+                              scope, type.isReadOnly());
   variable.decorate(scopeStack, scope);
 }
 
@@ -65,9 +107,21 @@ inline void ReturnStatement::decorate(scopes::ScopeStack &scopeStack,
   expression.decorate(scopeStack, scope);
 }
 
+inline void BreakStatement::decorate(scopes::ScopeStack &scopeStack, scopes::Scope &scope) {
+  (void)scopeStack;
+  (void)scope;
+}
+
 inline void InlineAsmStatement::decorate(scopes::ScopeStack &scopeStack,
                                   scopes::Scope &scope) {
   asmBlock.decorate(scopeStack, scope);
+  for (auto &request : requests) {
+    request.variable.decorate(scopeStack, scope);
+    USER_ASSERT(!request.variable.getType()->isClass(), "Objects can only be bound to a register through their members");
+    USER_ASSERT(!request.variable.getType()->isArray(), "Arrays can not be bound to a register");
+    USER_ASSERT(!request.isWritten() || !request.variable.getVariableDescription()->isReadOnly,
+                "Inline asm output bound to the const variable " << request.variable.getName());
+  }
 }
 
 inline void Instruction::decorate(scopes::ScopeStack &scopeStack,
@@ -77,15 +131,19 @@ inline void Instruction::decorate(scopes::ScopeStack &scopeStack,
       instr);
 }
 
+// Parameters are locals of the body scope. Unnamed ones can not be read: nothing to declare.
 inline void FunctionParameter::decorate(scopes::ScopeStack &scopeStack,
                                  scopes::Scope &scope) {
   type.decorate(scopeStack, scope);
-  // variable.decorate(scopeStack, scope);
+  USER_ASSERT(!type.getTypeDescription()->isClass(), "Objects of class type can not be passed by value yet");
+  if (variable.getName().empty()) return;
+  scopeStack.addLocalVariable(variable.getName(), type.getTypeDescription(), scope, type.isReadOnly());
+  variable.decorate(scopeStack, scope);
 }
 
 inline void Attribute::decorate(scopes::ScopeStack &scopeStack, scopes::Scope &scope) {
   type.decorate(scopeStack, scope);
-  // variable.decorate(scopeStack, scope);
+  USER_ASSERT(type.getTypeDescription()->byteSize > 0, "Field " << variable.getName() << " has an incomplete type");
 }
 
 inline void FunctionParameterList::decorate(scopes::ScopeStack &scopeStack,
@@ -137,8 +195,23 @@ inline void ForStatement::decorate(scopes::ScopeStack &scopeStack, scopes::Scope
   body.decorate(scopeStack, newScope);
 }
 
+inline void SwitchStatement::decorate(scopes::ScopeStack &scopeStack, scopes::Scope &scope) {
+  condition.decorate(scopeStack, scope);
+  body.decorate(scopeStack, scope);
+}
+
+// Arguments only see the variables of the caller, never a parameter bound before them: f(b, a) with parameters a and b
+inline void InlinedCall::decorate(scopes::ScopeStack &scopeStack, scopes::Scope &scope) {
+  scopes::Scope &bodyScope = body.getOrCreateScope(scopeStack, scope);
+  for (auto &parameter : parameters) {
+    parameter.decorateBinding(scopeStack, scope, bodyScope);
+  }
+  body.decorate(scopeStack, scope);
+}
+
 inline void FunctionDeclaration::decorate(scopes::ScopeStack &scopeStack, scopes::Scope &scope) {
   returnType.decorate(scopeStack, scope);
+  USER_ASSERT(!returnType.getTypeDescription()->isClass(), "Objects of class type can not be returned yet");
   params.decorate(scopeStack, scope);
 
   std::vector<const scopes::TypeDescription *> paramTypes;
@@ -154,9 +227,10 @@ inline void Function::decorate(scopes::ScopeStack &scopeStack, scopes::Scope &sc
   // TODO: use FunctionDeclaration here as an attribute. a bit of refactoring probably
   scopes::Scope &newScope = body.getOrCreateScope(scopeStack, scope);
   returnType.decorate(scopeStack, newScope);
+  USER_ASSERT(!returnType.getTypeDescription()->isClass(), "Objects of class type can not be returned yet");
   params.decorate(scopeStack, newScope);
-  body.decorate(scopeStack, newScope);
 
+  // Known before the body, which may call itself
   std::vector<const scopes::TypeDescription *> paramTypes;
   for (auto &param : params) {
     paramTypes.push_back(param.getTypeDescription());
@@ -164,6 +238,8 @@ inline void Function::decorate(scopes::ScopeStack &scopeStack, scopes::Scope &sc
   scopeStack.addFunction(name, paramTypes, returnType.getTypeDescription(),
                          scope);
   description = scope.findFunction(name);
+
+  body.decorate(scopeStack, newScope);
 }
 
 inline void Method::decorate(scopes::ScopeStack &scopeStack, scopes::Scope &scope) {
@@ -179,16 +255,51 @@ inline void AccessSpecifier::decorate(scopes::ScopeStack &scopeStack,
 }
 
 inline void Class::decorate(scopes::ScopeStack &scopeStack, scopes::Scope &scope) {
+  std::vector<scopes::FieldDescription> fields;
   for (auto &attr : attributes) {
     attr.first.decorate(scopeStack, scope);
+    USER_ASSERT(std::ranges::find(fields, attr.first.getName(), &scopes::FieldDescription::name) == fields.end(),
+                "Duplicate member " << attr.first.getName() << " in class " << name);
+    fields.push_back({attr.first.getName(), attr.first.getTypeDescription(), 0});
   }
+
+  alternativeSize = layoutClass(fields, !reorder).byteSize;
+  auto layout = layoutClass(std::move(fields), reorder);
+  description = scopeStack.addClassType(name, layout.byteSize, layout.alignment, std::move(layout.fields), scope);
+
   for (auto &method : methods) {
     method.first.decorate(scopeStack, scope);
   }
 }
 
+// Globals live in the root scope: a local of the same name hides them
+inline void GlobalVariable::decorate(scopes::ScopeStack &scopeStack, scopes::Scope &scope) {
+  type.decorate(scopeStack, scope);
+  const auto *typeDescription = type.getTypeDescription();
+  auto name = variable.getName();
+  USER_ASSERT(typeDescription->byteSize > 0, "Global " << name << " has an incomplete type");
+  USER_ASSERT(initializer || !type.isReadOnly(), "Uninitialized const global " << name);
+  if (initializer) {
+    USER_ASSERT(!typeDescription->isClass(), "Objects of class type can not be initialized yet");
+    USER_ASSERT(!typeDescription->isArray(), "Arrays can not be initialized yet");
+    initializer->decorate(scopeStack, scope);
+    USER_ASSERT(!initializer->asStringLiteral() || typeDescription->id == scopes::IDX_POINTER_TYPE,
+                "Global " << name << " of type " << type.fullName() << " initialized with a string literal");
+  }
+  scopeStack.addGlobalVariable(name, typeDescription, scope, type.isReadOnly());
+  variable.decorate(scopeStack, scope);
+}
+
 inline void TranslationUnit::decorate(scopes::ScopeStack &scopeStack,
                                scopes::Scope &scope) {
+  for (auto &classNode : classes) {
+    classNode.decorate(scopeStack, scope);
+  }
+
+  for (auto &global : globals) {
+    global.decorate(scopeStack, scope);
+  }
+
   for (auto &funcDecl : functionDeclarations) {
     funcDecl.decorate(scopeStack, scope);
   }
@@ -196,9 +307,14 @@ inline void TranslationUnit::decorate(scopes::ScopeStack &scopeStack,
   for (auto &func : functions) {
     func.decorate(scopeStack, scope);
   }
-  for (auto &classNode : classes) {
-    classNode.decorate(scopeStack, scope);
+}
+
+inline ClassLayoutReport TranslationUnit::classLayouts() const {
+  ClassLayoutReport report;
+  for (const auto &classNode : classes) {
+    report.classes.push_back(classNode.layoutEntry());
   }
+  return report;
 }
 
 } /* namespace ast */
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <format>
 #include <sstream>
 #include <variant>
@@ -9,11 +10,6 @@
 #include "nodes.h"
 
 namespace ast {
-namespace {
-static constexpr auto ENDL = codegen::NasmGenerator_x86_64::ENDL;
-static constexpr auto INDENT = codegen::NasmGenerator_x86_64::INDENT;
-} // namespace
-
 inline void Instruction::genAsm_x86_64(
     codegen::NasmGenerator_x86_64 &generator) const {
   std::visit([&generator](const auto &node) { node.genAsm_x86_64(generator); },
@@ -29,26 +25,145 @@ inline void CodeBlock::genAsm_x86_64(
 
 inline void FunctionCall::genAsm_x86_64(
     codegen::NasmGenerator_x86_64 &generator) const {
+  emitCall(generator, std::nullopt);
+}
+
+inline void FunctionCall::loadValueInRegister(codegen::NasmGenerator_x86_64 &generator,
+                                              scopes::GeneralPurposeRegister targetRegister) const {
+  emitCall(generator, targetRegister);
+}
+
+inline std::vector<scopes::GPRegisterSet::RegisterGuard> FunctionCall::loadArguments(
+    codegen::NasmGenerator_x86_64 &generator, std::optional<scopes::GeneralPurposeRegister> resultRegister) const {
   size_t maxArgumentsStoredInRegisters = std::min(arguments.size(), scopes::FUNCTION_ARGUMENT_REGISTERS.size());
+  std::vector<scopes::GPRegisterSet::RegisterGuard> argumentGuards;
+  argumentGuards.reserve(maxArgumentsStoredInRegisters);
   for (size_t i = 0; i < maxArgumentsStoredInRegisters; i++) {
-    arguments[i].loadValueInRegister(generator, scopes::FUNCTION_ARGUMENT_REGISTERS[i]);
+    auto reg = scopes::FUNCTION_ARGUMENT_REGISTERS[i];
+    if (reg != resultRegister) argumentGuards.push_back(generator.regSet().borrowGuard(reg));
+    arguments[i].loadValueInRegister(generator, reg);
+  }
+  return argumentGuards;
+}
+
+inline scopes::byteSize_t FunctionCall::storeStackArguments(codegen::NasmGenerator_x86_64 &generator) const {
+  const size_t registerCount = scopes::FUNCTION_ARGUMENT_REGISTERS.size();
+  if (arguments.size() <= registerCount) return generator.emitAlignStackForCall();
+
+  auto bytes = generator.emitReserveStackArguments(arguments.size() - registerCount);
+  auto areaDepth = generator.stackDepth();
+  for (size_t i = registerCount; i < arguments.size(); i++) {
+    auto regGuard = generator.regSet().acquireGuard();
+    arguments[i].loadValueInRegister(generator, regGuard.reg);
+    generator.emitStoreStackArgument(i - registerCount, regGuard.reg, areaDepth);
   }
-  for (size_t i = maxArgumentsStoredInRegisters; i < arguments.size(); i++) {
-    TODO("Implement pushing arguments on the stack");
+  return bytes;
+}
+
+inline void FunctionCall::emitCall(codegen::NasmGenerator_x86_64 &generator,
+                                   std::optional<scopes::GeneralPurposeRegister> resultRegister) const {
+  const scopes::RegisterMask liveBefore = generator.regSet().asBistet();
+  auto argumentGuards = loadArguments(generator, resultRegister);
+
+  // Caller-saved registers still needed after the call: variables living across it and enclosing temporaries.
+  // Borrowed argument registers are reloaded by their guard.
+  scopes::RegisterMask preserved = liveBefore;
+  if (generator.allocation()) preserved |= generator.allocation()->callerSavedLiveAcross(callPoint);
+  for (auto reg : scopes::CALLEE_SAVED_REGISTERS) preserved.reset(static_cast<size_t>(reg));
+  for (const auto &guard : argumentGuards) {
+    if (guard.spilled) preserved.reset(static_cast<size_t>(guard.reg));
   }
+  if (resultRegister) preserved.reset(static_cast<size_t>(*resultRegister));
+
+  for (auto reg : codegen::CALLER_SAVED_ALLOCATABLE_REGISTERS) {
+    if (preserved.test(static_cast<size_t>(reg))) generator.emitPush(reg);
+  }
+  auto stackBytes = storeStackArguments(generator);
   generator.emitCall(name);
+  generator.emitReleaseStackPadding(stackBytes);
+
+  // Taken out of rax before it is restored
+  if (resultRegister) generator.emitLoadReturnValue(*resultRegister, getType()->byteSize);
+
+  for (auto reg = codegen::CALLER_SAVED_ALLOCATABLE_REGISTERS.rbegin(); reg != codegen::CALLER_SAVED_ALLOCATABLE_REGISTERS.rend(); ++reg) {
+    if (preserved.test(static_cast<size_t>(*reg))) generator.emitPop(*reg);
+  }
+  while (!argumentGuards.empty()) argumentGuards.pop_back();
+}
+
+inline bool FunctionCall::isTailCallable() const {
+  DEBUG_ASSERT(description, "FunctionCall " << name << " is not decorated");
+  // A char result would still need its sign extension in the caller
+  return arguments.size() <= scopes::FUNCTION_ARGUMENT_REGISTERS.size() && getType()->byteSize != 1;
+}
+
+inline void FunctionCall::genTailCall_x86_64(codegen::NasmGenerator_x86_64 &generator) const {
+  {
+    auto argumentGuards = loadArguments(generator, std::nullopt);
+    while (!argumentGuards.empty()) argumentGuards.pop_back();
+  }
+  generator.emitTailCall(name);
+}
+
+inline void Expression::emitBranch(codegen::NasmGenerator_x86_64 &generator, std::string_view label, bool jumpIfTrue) const {
+  auto pinGuard = generator.pinLiveRegisters(programRange);
+
+  // !x branches where x would not, && and || become jump chains: no 0/1 is ever materialized
+  if (const auto *negation = std::get_if<UnaryOperation>(&expr)) {
+    return negation->getOperand().emitBranch(generator, label, !jumpIfTrue);
+  }
+  if (const auto *logical = std::get_if<BinaryOperation>(&expr); logical && logical->isLogical()) {
+    return logical->emitLogicalBranch(generator, label, jumpIfTrue);
+  }
+
+  // cmp + jcc, adjacent so that they macro-fuse. A spilled temporary is reloaded in between, on both paths: pop leaves
+  // the flags alone
+  codegen::CMP_OPERATION condition;
+  {
+    auto condRegGuard = generator.regSet().acquireGuard();
+    condition = emitFlags(generator, condRegGuard.reg);
+  }
+  generator.emitJumpCC(label, jumpIfTrue ? condition : codegen::invertCondition(condition));
+}
+
+inline codegen::CMP_OPERATION Expression::emitFlags(codegen::NasmGenerator_x86_64 &generator, scopes::GeneralPurposeRegister reg) const {
+  const auto *comparison = std::get_if<BinaryOperation>(&expr);
+  if (comparison && comparison->isComparison()) return comparison->emitCompare(generator, reg);
+  if (const auto *negation = std::get_if<UnaryOperation>(&expr)) {
+    return codegen::invertCondition(negation->getOperand().emitFlags(generator, reg));
+  }
+
+  loadValueInRegister(generator, reg);
+  generator.emitTest(scopes::getProperRegisterFromID64(reg));
+  return codegen::CMP_OPERATION::NEQ;
+}
+
+// Jumping when a && b holds: a failing skips the test of b. Jumping when it fails: a and b both jump on failure.
+// || is the mirror image.
+inline void BinaryOperation::emitLogicalBranch(codegen::NasmGenerator_x86_64 &generator, std::string_view label, bool jumpIfTrue) const {
+  DEBUG_ASSERT(isLogical(), "Operation " << static_cast<char>(op) << " is not a logical operation");
+  bool decidedByLhs = op == Operation::LOGICAL_OR;
+
+  if (jumpIfTrue == decidedByLhs) {
+    lhs->emitBranch(generator, label, jumpIfTrue);
+    rhs->emitBranch(generator, label, jumpIfTrue);
+    return;
+  }
+
+  auto skipLabel = generator.generateUniqueLabel("logical.skip");
+  lhs->emitBranch(generator, skipLabel, decidedByLhs);
+  rhs->emitBranch(generator, label, jumpIfTrue);
+  generator.emitLabel(skipLabel);
 }
 
 inline void ConditionalStatement::genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const {
+  if (isSelect()) return genSelect_x86_64(generator);
+
   auto elseLabel = generator.generateUniqueLabel("else");
   auto endIfLabel = generator.generateUniqueLabel("end_if");
   std::string_view conditionFailLabel = elseBody.has_value() ? elseLabel : endIfLabel;
 
-  {
-    auto condRegGuard = generator.regSet().acquireGuard();
-    condition.loadValueInRegister(generator, condRegGuard->reg);
-    generator.emitConditionalJump(conditionFailLabel, scopes::getProperRegisterFromID64(condRegGuard->reg));
-  }
+  condition.emitBranch(generator, conditionFailLabel, false);
 
   ifBody.genAsm_x86_64(generator);
 
@@ -61,62 +176,310 @@ inline void ConditionalStatement::genAsm_x86_64(codegen::NasmGenerator_x86_64 &g
   generator.emitLabel(endIfLabel);
 }
 
+// Rotated into a guarded do-while: the condition is tested once on entry, then at the bottom of each iteration, whose
+// only branch is the taken jump back to the body
 inline void WhileStatement::genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const {
-  auto condLabel = generator.generateUniqueLabel("while");
+  auto bodyLabel = generator.generateUniqueLabel("while");
   auto endLabel = generator.generateUniqueLabel("while.end");
 
-  generator.emitLabel(condLabel);
-
-  {
-    auto condRegGuard = generator.regSet().acquireGuard();
-    condition.loadValueInRegister(generator, condRegGuard->reg);
-    generator.emitConditionalJump(endLabel, scopes::getProperRegisterFromID64(condRegGuard->reg));
+  for (const auto &declaration : preheader) {
+    declaration.genAsm_x86_64(generator);
   }
 
+  condition.emitBranch(generator, endLabel, false);
+  generator.emitLabel(bodyLabel);
+
+  generator.pushBreakLabel(endLabel);
   body.genAsm_x86_64(generator);
+  generator.popBreakLabel();
 
-  generator.emitJump(condLabel);
+  condition.emitBranch(generator, bodyLabel, true);
   generator.emitLabel(endLabel);
 }
 
 inline void DoStatement::genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const {
-  auto startLabel = generator.generateUniqueLabel("do-while");
+  auto startLabel = generator.generateUniqueLabel("do_while");
+  auto endLabel = generator.generateUniqueLabel("do_while.end");
+
+  for (const auto &declaration : preheader) {
+    declaration.genAsm_x86_64(generator);
+  }
 
   generator.emitLabel(startLabel);
+  generator.pushBreakLabel(endLabel);
   body.genAsm_x86_64(generator);
+  generator.popBreakLabel();
 
   // no need for cond label
-  {
-    auto condRegGuard = generator.regSet().acquireGuard();
-    expr.loadValueInRegister(generator, condRegGuard->reg);
-    generator.emitConditionalJumpNonZero(startLabel, scopes::getProperRegisterFromID64(condRegGuard->reg));
-  }
+  expr.emitBranch(generator, startLabel, true);
+  generator.emitLabel(endLabel);
 }
 
 inline void ForStatement::genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const {
-  auto condLabel = generator.generateUniqueLabel("for");
+  if (auto loop = analyzeCountedLoop()) {
+    InlineSummary summary;
+    body.summarize(summary);
+    expr->summarize(summary);
+
+    std::optional<uint64_t> trips;
+    if (loop->start && loop->bound->asInt32Constant()) {
+      trips = codegen::tripCount(*loop->start, *loop->bound->asInt32Constant(), loop->step, loop->op);
+    }
+    if (!unrollCount && genVectorized_x86_64(generator, *loop, trips)) return;
+    auto plan = codegen::planUnroll(trips, summary.size, unrollCount, generator.codegenOptions().unrollLoops);
+    if (plan.full || plan.factor > 1) return genUnrolled_x86_64(generator, *loop, plan);
+  }
+
   auto endLabel = generator.generateUniqueLabel("for.end");
 
   init.genAsm_x86_64(generator);
+  for (const auto &declaration : preheader) {
+    declaration.genAsm_x86_64(generator);
+  }
 
-  generator.emitLabel(condLabel);
+  genRotatedLoop_x86_64(generator, endLabel, !entryTestPasses());
+  generator.emitLabel(endLabel);
+}
 
-  if (condition) {
-    auto condRegGuard = generator.regSet().acquireGuard();
-    condition->loadValueInRegister(generator, condRegGuard->reg);
-    generator.emitConditionalJump(endLabel, scopes::getProperRegisterFromID64(condRegGuard->reg));
-  }
+inline void ForStatement::genRotatedLoop_x86_64(codegen::NasmGenerator_x86_64 &generator, std::string_view endLabel, bool guarded) const {
+  auto bodyLabel = generator.generateUniqueLabel("for");
+
+  if (condition && guarded) condition->emitBranch(generator, endLabel, false);
+  generator.emitLabel(bodyLabel);
 
+  generator.pushBreakLabel(std::string(endLabel));
   body.genAsm_x86_64(generator);
+  generator.popBreakLabel();
 
   if (expr) {
     expr->genAsm_x86_64(generator);
   }
 
-  generator.emitJump(condLabel);
+  if (condition) condition->emitBranch(generator, bodyLabel, true);
+  else generator.emitJump(bodyLabel);
+}
+
+inline bool ForStatement::entryTestPasses() const {
+  if (!condition) return true;
+  const auto &initialValue = init.getAssignment();
+  const auto *comparison = condition->asBinaryOperation();
+  if (!initialValue || !comparison || !comparison->isComparison()) return false;
+
+  const auto *variable = comparison->getLhs().asVariable();
+  if (!variable || variable->getVariableDescription() != init.getVariable().getVariableDescription()) return false;
+  auto start = initialValue->asInt32Constant();
+  auto bound = comparison->getRhs().asInt32Constant();
+  // The literal must survive the conversion to the type of the variable
+  if (!start || !bound || variable->getType()->byteSize < 4) return false;
+  return codegen::evaluateCondition(static_cast<codegen::CMP_OPERATION>(comparison->getOperation()), *start, *bound);
+}
+
+inline std::optional<ForStatement::CountedLoop> ForStatement::analyzeCountedLoop() const {
+  if (!condition || !expr) return std::nullopt;
+  const auto *induction = init.getVariable().getVariableDescription();
+  if ((*induction->typeDescription)->id != scopes::IDX_INT_TYPE) return std::nullopt;
+  auto isInduction = [induction](const Expression &expression) {
+    return expression.asVariable() && expression.asVariable()->getVariableDescription() == induction;
+  };
+
+  // i = i + step or i = i - step
+  const auto *increment = expr->asAssign();
+  if (!increment || increment->getVariable().getVariableDescription() != induction) return std::nullopt;
+  const auto *update = increment->getValue().asBinaryOperation();
+  if (!update || !isInduction(update->getLhs())) return std::nullopt;
+  auto step = update->getRhs().asInt32Constant();
+  if (!step || *step == 0) return std::nullopt;
+  if (update->getOperation() == BinaryOperation::Operation::SUBSTRACT) step = -*step;
+  else if (update->getOperation() != BinaryOperation::Operation::ADD) return std::nullopt;
+
+  // i < bound, i <= bound counting up, i > bound, i >= bound counting down
+  const auto *comparison = condition->asBinaryOperation();
+  if (!comparison || !comparison->isComparison() || !isInduction(comparison->getLhs())) return std::nullopt;
+  auto op = static_cast<codegen::CMP_OPERATION>(comparison->getOperation());
+  bool increasing = op == codegen::CMP_OPERATION::LT || op == codegen::CMP_OPERATION::LEQ;
+  bool decreasing = op == codegen::CMP_OPERATION::GT || op == codegen::CMP_OPERATION::GEQ;
+  if (!(increasing && *step > 0) && !(decreasing && *step < 0)) return std::nullopt;
+
+  // The tests skipped between copies must give the same results: nothing but the increment may change them
+  const Expression &bound = comparison->getRhs();
+  LoopEffects effects;
+  body.collectLoopEffects(effects);
+  if (effects.containsInlineAsm || effects.written.contains(induction)) return std::nullopt;
+  effects.written.insert(induction);
+  if (bound.getType()->byteSize > 4 || !bound.speculationCost() || !bound.isLoopInvariant(effects)) return std::nullopt;
+
+  std::optional<int32_t> start;
+  if (const auto &initialValue = init.getAssignment()) start = initialValue->asInt32Constant();
+  return CountedLoop{induction, start, op, &bound, *step};
+}
+
+// Fully unrolled: the copies follow each other, breaks still leave through the end label.
+// Partially unrolled: factor copies run while the last of them would still pass the test, computed on 64 bits so that
+// neither the induction variable nor the bound can overflow; the rolled loop then runs the remaining iterations.
+inline void ForStatement::genUnrolled_x86_64(codegen::NasmGenerator_x86_64 &generator, const CountedLoop &loop, const codegen::UnrollPlan &plan) const {
+  auto unrolledLabel = generator.generateUniqueLabel("for.unrolled");
+  auto remainderLabel = generator.generateUniqueLabel("for.remainder");
+  auto endLabel = generator.generateUniqueLabel("for.end");
+
+  init.genAsm_x86_64(generator);
+  for (const auto &declaration : preheader) {
+    declaration.genAsm_x86_64(generator);
+  }
+
+  if (!plan.full) {
+    generator.emitLabel(unrolledLabel);
+    auto pinGuard = generator.pinLiveRegisters(condition->getProgramRange());
+    auto lastGuard = generator.regSet().acquireGuard();
+    auto last = scopes::getProperRegisterFromID64(lastGuard.reg, 8);
+    generator.emitLoadSignExtended(last, loop.induction->location, 4);
+    generator.emitBinaryOp(codegen::Opcode::ADD, last, codegen::Immediate{static_cast<int64_t>(loop.step) * (plan.factor - 1)});
+
+    if (auto constantBound = loop.bound->asInt32Constant()) {
+      generator.emitBinaryOp(codegen::Opcode::CMP, last, codegen::Immediate{*constantBound});
+    }
+    else {
+      auto boundGuard = generator.regSet().acquireGuard();
+      auto bound = scopes::getProperRegisterFromID64(boundGuard.reg, 8);
+      if (const auto *variable = loop.bound->asVariable()) {
+        generator.emitLoadSignExtended(bound, variable->getVariableDescription()->location, variable->getType()->byteSize);
+      }
+      else {
+        loop.bound->loadValueInRegister(generator, boundGuard.reg);
+        generator.emitBinaryOp(codegen::Opcode::MOVSXD, bound, scopes::getProperRegisterFromID64(boundGuard.reg, 4));
+      }
+      generator.emitCmp(last, bound);
+    }
+    generator.emitJumpCC(remainderLabel, codegen::invertCondition(loop.op));
+  }
+
+  generator.pushBreakLabel(endLabel);
+  for (uint32_t copy = 0; copy < plan.factor; copy++) {
+    body.genAsm_x86_64(generator);
+    expr->genAsm_x86_64(generator);
+  }
+  generator.popBreakLabel();
+
+  if (!plan.full) {
+    generator.emitJump(unrolledLabel);
+
+    generator.emitLabel(remainderLabel);
+    genRotatedLoop_x86_64(generator, endLabel, true);
+  }
   generator.emitLabel(endLabel);
 }
 
+inline void SwitchStatement::genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const {
+  auto endLabel = generator.generateUniqueLabel("switch.end");
+  std::string defaultLabel = endLabel;
+  std::vector<std::string> labelNames;
+  std::vector<codegen::SwitchCase> cases;
+  for (const auto &label : labels) {
+    labelNames.push_back(generator.generateUniqueLabel(label.value ? "case" : "default"));
+    if (label.value) cases.push_back({*label.value, labelNames.back()});
+    else defaultLabel = labelNames.back();
+  }
+  std::sort(cases.begin(), cases.end(), [](const auto &lhs, const auto &rhs) { return lhs.value < rhs.value; });
+
+  {
+    // Variables used by the cases are live across the dispatch
+    auto pinGuard = generator.pinLiveRegisters(condition.getProgramRange());
+    auto gValue = generator.regSet().acquireGuard();
+    condition.loadValueInRegister(generator, gValue.reg);
+    generator.emitSwitchDispatch(gValue.reg, cases, defaultLabel);
+  }
+
+  // Cases fall through to the next ones, in source order
+  generator.pushBreakLabel(endLabel);
+  const auto &statements = body.getStatements();
+  size_t nextLabel = 0;
+  for (size_t i = 0; i <= statements.size(); i++) {
+    for (; nextLabel < labels.size() && labels[nextLabel].statementIndex == i; nextLabel++) {
+      generator.emitLabel(labelNames[nextLabel]);
+    }
+    if (i < statements.size()) statements[i].genAsm_x86_64(generator);
+  }
+  generator.popBreakLabel();
+
+  generator.emitLabel(endLabel);
+}
+
+inline bool ConditionalStatement::isEarlyExit() const {
+  const auto &statements = ifBody.getStatements();
+  return !elseBody && statements.size() == 1 && statements.front().isReturn();
+}
+
+inline const Expression *ConditionalStatement::singleAssignment(const CodeBlock &block) {
+  const auto &statements = block.getStatements();
+  if (statements.size() != 1) return nullptr;
+  const auto *expression = statements.front().asExpression();
+  // An element store may write memory the condition was guarding
+  return expression && expression->asAssign() && !expression->asAssign()->isElementStore() ? expression : nullptr;
+}
+
+inline bool ConditionalStatement::isSelect() const {
+  const auto *ifArm = singleAssignment(ifBody);
+  if (!ifArm) return false;
+  const auto &variable = ifArm->asAssign()->getVariable();
+  auto cost = ifArm->asAssign()->getValue().speculationCost();
+  if (!cost) return false;
+
+  if (elseBody) {
+    const auto *elseArm = singleAssignment(*elseBody);
+    if (!elseArm || elseArm->asAssign()->getVariable().getVariableDescription() != variable.getVariableDescription()) return false;
+    auto elseCost = elseArm->asAssign()->getValue().speculationCost();
+    if (!elseCost) return false;
+    *cost += *elseCost;
+  }
+  else {
+    // The current value is kept
+    *cost += 1;
+  }
+  return *cost <= MAX_SELECT_COST;
+}
+
+inline void ConditionalStatement::genSelect_x86_64(codegen::NasmGenerator_x86_64 &generator) const {
+  const auto *ifArm = singleAssignment(ifBody);
+  const auto *elseArm = elseBody ? singleAssignment(*elseBody) : nullptr;
+  const auto &variable = ifArm->asAssign()->getVariable();
+  const auto &location = variable.getVariableDescription()->location;
+  const auto &selected = ifArm->asAssign()->getValue();
+  auto size = variable.getType()->byteSize;
+  auto valueSize = std::max<scopes::byteSize_t>(size, 4);
+
+  // Everything is evaluated before the compare: variables read by the condition or by either arm are live until the cmov
+  auto pinGuard = generator.pinLiveRegisters({condition.getProgramRange().begin, (elseArm ? elseArm : ifArm)->getProgramRange().end});
+
+  // Without an else, a variable in a register is updated in place
+  const auto *variableRegister = std::get_if<scopes::Register>(&location);
+  bool inPlace = !elseArm && variableRegister && size >= 4;
+
+  scopes::RegisterMask busy;
+  std::optional<scopes::GPRegisterSet::RegisterGuard> gResult;
+  if (!inPlace) {
+    gResult.emplace(generator.regSet().acquireGuard());
+    busy |= scopes::toMask(gResult->reg);
+    if (elseArm) elseArm->asAssign()->getValue().loadValueInRegister(generator, gResult->reg);
+    else variable.loadValueInRegister(generator, gResult->reg);
+  }
+
+  // cmov reads its source from memory as well, but not from an immediate
+  std::optional<scopes::GPRegisterSet::RegisterGuard> gSelected;
+  bool foldSelected = selected.asVariable() && selected.isFoldableOperand(valueSize);
+  if (!foldSelected) {
+    gSelected.emplace(generator.regSet().acquireGuard(busy));
+    busy |= scopes::toMask(gSelected->reg);
+    selected.loadValueInRegister(generator, gSelected->reg);
+  }
+
+  auto gCondition = generator.regSet().acquireGuard(busy);
+  auto selectCondition = condition.emitFlags(generator, gCondition.reg);
+
+  auto resultRegister = inPlace ? scopes::getGPRegisterID(*variableRegister) : gResult->reg;
+  codegen::MachineOperand source = foldSelected ? selected.asFoldedOperand(generator, valueSize) : codegen::MachineOperand{scopes::getProperRegisterFromID64(gSelected->reg, valueSize)};
+  generator.emitCmovCC(scopes::getProperRegisterFromID64(resultRegister, valueSize), source, selectCondition);
+  if (!inPlace) generator.emitStoreInMemory(location, scopes::getProperRegisterFromID64(resultRegister, size));
+}
+
 inline void Statement::genAsm_x86_64(
     codegen::NasmGenerator_x86_64 &generator) const {
   std::visit([&generator](const auto &node) { node.genAsm_x86_64(generator); },
@@ -125,36 +488,106 @@ inline void Statement::genAsm_x86_64(
 
 inline void ReturnStatement::genAsm_x86_64(
     codegen::NasmGenerator_x86_64 &generator) const {
-  expression.loadValueInRegister(generator, scopes::returnRegister);
-}
+  // Inlined calls are statements: the value is dropped, only its side effects are kept
+  if (const auto *inlinedReturnLabel = generator.inlinedReturnLabel()) {
+    if (!expression.speculationCost()) {
+      auto regGuard = generator.regSet().acquireGuard();
+      expression.loadValueInRegister(generator, regGuard.reg);
+    }
+    generator.emitJump(*inlinedReturnLabel);
+    return;
+  }
 
-inline void InlineAsmStatement::genAsm_x86_64(
-    codegen::NasmGenerator_x86_64 &generator) const {
-  generator << ";-- START -- asm binding requests" << ENDL;
-  // TODO: not assume that every variable is always in rdx
+  // The callee returns straight to our caller, in constant stack space
+  if (const auto *call = expression.asFunctionCall(); call && call->isTailCallable()) {
+    auto pinGuard = generator.pinLiveRegisters(expression.getProgramRange());
+    return call->genTailCall_x86_64(generator);
+  }
 
-  for (auto &request : requests) {
-    generator << INDENT
-              << std::format("mov {}, {}", regToStr(request.registerTo),
-                             regToStr(scopes::Register::REG_RAX))
-              << ENDL;
+  {
+    auto returnGuard = generator.regSet().acquireGuard(scopes::returnRegister);
+    expression.loadValueInRegister(generator, scopes::returnRegister);
   }
+  generator.emitFunctionReturn();
+}
 
-  generator << ";-- START -- user defined" << ENDL;
-  generator << asmBlock.getContent() << ENDL;
-  generator << ";-- END -- user defined" << ENDL;
+inline void InlinedCall::genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const {
+  for (const auto &parameter : parameters) {
+    parameter.genAsm_x86_64(generator);
+  }
+
+  auto returnLabel = generator.generateUniqueLabel("inlined_return");
+  generator.pushInlinedReturnLabel(returnLabel);
+  body.genAsm_x86_64(generator);
+  generator.popInlinedReturnLabel();
+  generator.emitLabel(returnLabel);
+}
+
+inline void BreakStatement::genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const {
+  generator.emitJump(generator.breakLabel());
+}
+
+// Operands go straight between their register and wherever the variable lives. The allocator kept every value live
+// across the block out of the clobbered registers, so nothing has to be saved around it.
+inline void InlineAsmStatement::genAsm_x86_64(
+    codegen::NasmGenerator_x86_64 &generator) const {
+  auto operandMoves = [this](bool written) {
+    std::vector<codegen::LocationMove> moves;
+    for (const auto &request : requests) {
+      if (written ? !request.isWritten() : !request.isRead()) continue;
+      const auto &location = request.variable.getVariableDescription()->location;
+      auto size = request.variable.getType()->byteSize;
+      auto reg = scopes::getProperRegisterFromID64(scopes::getGPRegisterID(request.registerTo));
+      if (written) moves.push_back({location, reg, size});
+      else moves.push_back({reg, location, size});
+    }
+    return moves;
+  };
+
+  generator.emitComment("START -- asm binding requests");
+  generator.emitParallelMoves(operandMoves(false));
+
+  // The callee-saved registers the block writes must be preserved
+  generator.markInlineAsm(clobberedRegisters());
+
+  generator.emitComment("START -- user defined");
+  generator.emitRaw(std::string(asmBlock.getContent()));
+  generator.emitComment("END -- user defined");
+
+  generator.emitParallelMoves(operandMoves(true));
 }
 
 inline void Declaration::genAsm_x86_64(
     codegen::NasmGenerator_x86_64 &generator) const {
-  generator.emitDeclaration(variable.getVariableDescription()->location);
-  if (assignment.has_value()) {
-    // TODO: Take an available register
-    assignment->loadValueInRegister(generator, scopes::GeneralPurposeRegister::REG_RAX);
-    scopes::byteSize_t size = (*variable.getVariableDescription()->typeDescription)->byteSize;
-    generator.emitStoreInMemory(variable.getVariableDescription()->location,
-                                 scopes::getProperRegisterFromID64(scopes::GeneralPurposeRegister::REG_RAX, size));
+  const auto *description = variable.getVariableDescription();
+  generator.emitDeclaration(description->location);
+  if (!assignment.has_value()) return;
+
+  auto pinGuard = generator.pinLiveRegisters(programRange);
+  scopes::byteSize_t size = (*description->typeDescription)->byteSize;
+
+  // Copy straight from the register holding the source (nothing to do once coalesced). Narrower sources need the
+  // sign extension of a load.
+  const Variable *source = assignment->asVariable();
+  if (source && std::holds_alternative<scopes::Register>(source->getVariableDescription()->location)
+      && source->getType()->byteSize == size) {
+    auto sourceRegister = scopes::getGPRegisterID(std::get<scopes::Register>(source->getVariableDescription()->location));
+    generator.emitStoreInMemory(description->location, scopes::getProperRegisterFromID64(sourceRegister, size));
+    return;
+  }
+
+  // Evaluate in place when no other variable shares the destination register
+  if (const auto *destination = std::get_if<scopes::Register>(&description->location)) {
+    auto destinationRegister = scopes::getGPRegisterID(*destination);
+    if (generator.allocation() && generator.allocation()->isExclusiveIn(destinationRegister, programRange, description)) {
+      assignment->loadValueInRegister(generator, destinationRegister);
+      return;
+    }
   }
+
+  auto regGuard = generator.regSet().acquireGuard();
+  assignment->loadValueInRegister(generator, regGuard.reg);
+  generator.emitStoreInMemory(description->location, scopes::getProperRegisterFromID64(regGuard.reg, size));
 }
 
 inline void FunctionDeclaration::genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const {
@@ -163,24 +596,98 @@ inline void FunctionDeclaration::genAsm_x86_64(codegen::NasmGenerator_x86_64 &ge
 }
 
 inline void Function::genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const {
-  generator.emitGlobalDirective(name);
+  if (exported) generator.emitGlobalDirective(name);
   generator.emitFunctionLabel(name);
 
-  generator.emitSaveBasePointer();
-  generator.emitSetBasePointerToCurrentStackPointer();
-  body.genAsm_x86_64(generator);
-  generator.emitRestoreStackPointer();
-  generator.emitRestoreBasePointer();
+  const auto &statements = body.getStatements();
+
+  // Shrink-wrapping: leading early exits that need neither the frame nor saved registers run before the prologue, as
+  // long as every parameter is still where the caller left it
+  size_t framelessCount = 0;
+  while (!allocation.movesArguments() && framelessCount < statements.size() && statements[framelessCount].isEarlyExit()) framelessCount++;
+
+  codegen::MachineInstructionList framelessCode;
+  if (framelessCount) {
+    generator.beginFunctionBody(allocation, {}, std::nullopt);
+    for (size_t i = 0; i < framelessCount; i++) statements[i].genAsm_x86_64(generator);
+    auto earlyExits = generator.endFunctionBody();
+    if (earlyExits.needsNoFrame()) {
+      framelessCode = std::move(earlyExits.code);
+      generator.emitReadOnlyData(earlyExits);
+    }
+    else framelessCount = 0;
+  }
+
+  codegen::FunctionFrame frame{
+    .framePointer = !generator.codegenOptions().omitFramePointer && !(allocation.isLeaf && allocation.frameSize == 0),
+    .redZone = allocation.isLeaf && allocation.frameSize <= codegen::RED_ZONE_SIZE,
+    .size = allocation.frameSize,
+  };
+  auto returnLabel = generator.generateUniqueLabel("return");
+
+  codegen::FunctionBody code;
+  while (true) {
+    generator.beginFunctionBody(allocation, frame, returnLabel);
+    for (size_t i = framelessCount; i < statements.size(); i++) statements[i].genAsm_x86_64(generator);
+    code = generator.endFunctionBody();
+
+    // Pushes and inline asm write below rsp, over the red zone
+    if (!frame.redZone || (!code.pushes && !code.containsInlineAsm)) break;
+    frame.redZone = false;
+  }
+  generator.emitReadOnlyData(code);
 
+  // Calls need rsp 16-byte aligned: pad the frame, on top of the return address and the saved registers
+  scopes::byteSize_t reservedBytes = frame.redZone ? 0 : frame.size;
+  if (!allocation.isLeaf) {
+    scopes::byteSize_t pushed = 8 * (1 + code.calleeSaved.count() + (frame.framePointer ? 1 : 0));
+    reservedBytes += (16 - (pushed + reservedBytes) % 16) % 16;
+  }
+
+  generator.expandTailCalls(framelessCode, {}, {}, 0);
+  generator.expandTailCalls(code.code, frame, code, reservedBytes);
+
+  generator.emitInstructions(framelessCode);
+  generator.emitFramePrologue(frame, code, reservedBytes);
+  generator.emitIncomingArguments(allocation, frame, code, reservedBytes);
+  generator.emitInstructions(code.code);
+  generator.emitLabel(returnLabel);
+  generator.emitFrameEpilogue(frame, code, reservedBytes);
   generator.emitReturnInstruction();
 }
 
 inline void Expression::genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const {
+  auto pinGuard = generator.pinLiveRegisters(programRange);
   std::visit([&generator](const auto &node) { node.genAsm_x86_64(generator); }, expr);
 }
 
+// A class only describes the layout of its objects
+inline void Class::genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const {
+  (void)generator;
+  if (!methods.empty()) TODO("Implement class methods");
+}
+
+// The initializer was evaluated at compile time (see evaluateInitializer): a string literal is the address of its contents
+inline void GlobalVariable::genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const {
+  const auto *description = variable.getVariableDescription();
+  const auto *typeDescription = *description->typeDescription;
+  std::optional<std::string> value;
+  if (initializer && initializer->asStringLiteral()) value = generator.internString(initializer->asStringLiteral()->getContent());
+  else if (initialValue) value = std::to_string(*initialValue);
+
+  const auto &slot = std::get<scopes::GlobalStackOffset>(description->location);
+  auto alignment = typeDescription->isArray() ? codegen::arrayAlignment(typeDescription->byteSize, typeDescription->alignment)
+                                             : typeDescription->alignment;
+  generator.emitGlobalVariable(getName(), slot._symbol, typeDescription->byteSize, alignment,
+                               description->isReadOnly, std::move(value));
+}
+
 inline std::string
 TranslationUnit::genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const {
+  for (auto &global : globals) {
+    global.genAsm_x86_64(generator);
+  }
+
   for (auto &funcDecl : functionDeclarations) {
     funcDecl.genAsm_x86_64(generator);
   }
@@ -190,8 +697,7 @@ TranslationUnit::genAsm_x86_64(codegen::NasmGenerator_x86_64 &generator) const {
   }
 
   for (auto &classNode : classes) {
-    (void)classNode;
-    TODO("Implement classNodes");
+    classNode.genAsm_x86_64(generator);
   }
 
   std::stringstream asmCode;
@@ -0,0 +1,266 @@
+#include <algorithm>
+#include <map>
+
+#include "ast/inlining.hpp"
+#include "nodes.h"
+
+namespace ast {
+
+// Expands small calls in place, before decoration: the copied bodies are then decorated, allocated and generated like
+// any other block of their caller. Functions are processed bottom-up along the call graph, so that a callee is copied
+// with its own calls already expanded. A function has to be defined before it is called: source order is such an
+// order, and only a function calling itself forms a cycle.
+class Inliner {
+public:
+  Inliner(std::vector<Function> &functions, std::set<std::string_view> &&globalNames)
+    : functions(functions), globalNames(std::move(globalNames)) {
+    for (auto &function : functions) callGraph.emplace(function.getName(), CallGraphNode{.function = &function});
+  }
+
+  InlineReport run() {
+    for (auto &function : functions) visit(callGraph.at(function.getName()));
+    return std::move(report);
+  }
+
+  // The body replacing the `call;` statement, when the cost model accepts it. Calls to functions without a body here
+  // (extern) are never candidates.
+  std::optional<InlinedCall> expand(const FunctionCall &call, uint32_t loopDepth) {
+    auto calleeNode = callGraph.find(call.getName());
+    if (calleeNode == callGraph.end()) return std::nullopt;
+    auto &callee = calleeNode->second;
+    // Calls to later definitions are left for decoration to report
+    if (callee.state == VisitState::PENDING) return std::nullopt;
+    const auto &arguments = call.getArguments();
+
+    auto hint = callee.function->getInlineHint();
+    auto constantArguments = std::count_if(arguments.begin(), arguments.end(), [](const Expression &argument) {
+      return argument.asNumberLiteral() != nullptr;
+    });
+    uint32_t threshold = inlineThreshold(hint, loopDepth, constantArguments);
+
+    bool inlined = false;
+    const char *reason = nullptr;
+    if (callee.state == VisitState::IN_PROGRESS) reason = "recursive";
+    else if (hint == InlineHint::NEVER) reason = "noinline";
+    else if (arguments.size() != callee.function->getParams().size()) reason = "argument count mismatch";
+    else if (hidesGlobal(callee.summary)) reason = "global hidden at the call site";
+    else if (hint == InlineHint::ALWAYS) { inlined = true; reason = "always_inline"; }
+    else if (callee.summary.containsInlineAsm) reason = "inline asm";
+    else if (callee.summary.size > threshold) reason = "too large";
+    else if (caller->summary.size + callee.summary.size > INLINE_MAX_CALLER_SIZE) reason = "caller too large";
+    else { inlined = true; reason = hint == InlineHint::INLINE ? "inline" : "small"; }
+
+    report.decisions.push_back({caller->function->getName(), call.getName(), callee.summary.size, threshold, inlined, reason});
+    if (!inlined) return std::nullopt;
+    caller->summary.size += callee.summary.size;
+
+    // Unnamed parameters still get their argument evaluated, into a variable nothing reads
+    std::vector<Declaration> parameters;
+    auto argument = arguments.begin();
+    for (const auto &parameter : callee.function->getParams()) {
+      parameters.emplace_back(Type(parameter.getType()), Variable(parameter.getVariable()), Expression(*argument++));
+    }
+    return InlinedCall(call.getName(), std::move(parameters), CodeBlock(callee.function->getBody()));
+  }
+
+private:
+  enum class VisitState { PENDING, IN_PROGRESS, DONE };
+
+  // A global used by the callee and declared by the caller as a local or parameter (anywhere, conservatively)
+  bool hidesGlobal(const InlineSummary &callee) const {
+    return std::ranges::any_of(callee.usedNames, [this](std::string_view name) {
+      return globalNames.contains(name) && caller->summary.declaredNames.contains(name);
+    });
+  }
+
+  struct CallGraphNode {
+    Function *function;
+    InlineSummary summary = {};
+    VisitState state = VisitState::PENDING;
+  };
+
+  void visit(CallGraphNode &node) {
+    if (node.state != VisitState::PENDING) return;
+    node.state = VisitState::IN_PROGRESS;
+
+    node.function->summarize(node.summary);
+    caller = &node;
+    node.function->inlineCalls(*this);
+    node.summary = {};
+    node.function->summarize(node.summary);
+    node.state = VisitState::DONE;
+  }
+
+private:
+  std::vector<Function> &functions;
+  std::set<std::string_view> globalNames;
+  std::map<std::string_view, CallGraphNode> callGraph;
+  CallGraphNode *caller = nullptr;
+  InlineReport report;
+};
+
+inline InlineReport TranslationUnit::inlineCalls() {
+  std::set<std::string_view> globalNames;
+  for (const auto &global : globals) globalNames.insert(global.getName());
+  return Inliner(functions, std::move(globalNames)).run();
+}
+
+inline void CodeBlock::inlineCalls(Inliner &inliner, uint32_t loopDepth) {
+  for (auto &statement : statements) {
+    statement.inlineCalls(inliner, loopDepth);
+  }
+}
+
+inline void Statement::inlineCalls(Inliner &inliner, uint32_t loopDepth) {
+  if (const auto *call = asFunctionCall()) {
+    if (auto expanded = inliner.expand(*call, loopDepth)) statement = std::move(*expanded);
+    return;
+  }
+
+  std::visit([&inliner, loopDepth](auto &node) {
+    using T = std::decay_t<decltype(node)>;
+    // Any other call is part of an expression, whose value is needed
+    if constexpr (!std::is_same_v<T, Instruction>) node.inlineCalls(inliner, loopDepth);
+  }, statement);
+}
+
+inline void ConditionalStatement::inlineCalls(Inliner &inliner, uint32_t loopDepth) {
+  ifBody.inlineCalls(inliner, loopDepth);
+  if (elseBody) elseBody->inlineCalls(inliner, loopDepth);
+}
+
+inline void WhileStatement::inlineCalls(Inliner &inliner, uint32_t loopDepth) {
+  body.inlineCalls(inliner, loopDepth + 1);
+}
+
+inline void DoStatement::inlineCalls(Inliner &inliner, uint32_t loopDepth) {
+  body.inlineCalls(inliner, loopDepth + 1);
+}
+
+inline void ForStatement::inlineCalls(Inliner &inliner, uint32_t loopDepth) {
+  body.inlineCalls(inliner, loopDepth + 1);
+}
+
+inline void SwitchStatement::inlineCalls(Inliner &inliner, uint32_t loopDepth) {
+  body.inlineCalls(inliner, loopDepth);
+}
+
+// Size estimate: one per operation, operand and statement
+inline void Variable::summarize(InlineSummary &summary) const {
+  summary.size++;
+  summary.usedNames.insert(name);
+}
+
+inline void NumberLiteral::summarize(InlineSummary &summary) const { summary.size++; }
+
+inline void StringLiteral::summarize(InlineSummary &summary) const { summary.size++; }
+
+inline void FunctionCall::summarize(InlineSummary &summary) const {
+  summary.size++;
+  for (const auto &argument : arguments) {
+    argument.summarize(summary);
+  }
+}
+
+inline void BinaryOperation::summarize(InlineSummary &summary) const {
+  summary.size++;
+  lhs->summarize(summary);
+  rhs->summarize(summary);
+}
+
+inline void UnaryOperation::summarize(InlineSummary &summary) const {
+  summary.size++;
+  operand->summarize(summary);
+}
+
+inline void Assign::summarize(InlineSummary &summary) const {
+  summary.size++;
+  summary.usedNames.insert(lhs->getName());
+  if (index) index->summarize(summary);
+  rhs->summarize(summary);
+}
+
+inline void Subscript::summarize(InlineSummary &summary) const {
+  summary.size++;
+  array.summarize(summary);
+  index->summarize(summary);
+}
+
+inline void Expression::summarize(InlineSummary &summary) const {
+  std::visit([&summary](const auto &node) { node.summarize(summary); }, expr);
+}
+
+inline void Declaration::summarize(InlineSummary &summary) const {
+  summary.size++;
+  summary.declaredNames.insert(variable.getName());
+  if (assignment) assignment->summarize(summary);
+}
+
+inline void ReturnStatement::summarize(InlineSummary &summary) const {
+  summary.size++;
+  expression.summarize(summary);
+}
+
+inline void BreakStatement::summarize(InlineSummary &summary) const { summary.size++; }
+
+inline void InlineAsmStatement::summarize(InlineSummary &summary) const {
+  summary.size++;
+  summary.containsInlineAsm = true;
+  for (const auto &request : requests) summary.usedNames.insert(request.variable.getName());
+}
+
+inline void Instruction::summarize(InlineSummary &summary) const {
+  std::visit([&summary](const auto &node) { node.summarize(summary); }, instr);
+}
+
+inline void CodeBlock::summarize(InlineSummary &summary) const {
+  for (const auto &statement : statements) {
+    statement.summarize(summary);
+  }
+}
+
+inline void ConditionalStatement::summarize(InlineSummary &summary) const {
+  summary.size++;
+  condition.summarize(summary);
+  ifBody.summarize(summary);
+  if (elseBody) elseBody->summarize(summary);
+}
+
+inline void WhileStatement::summarize(InlineSummary &summary) const {
+  summary.size++;
+  condition.summarize(summary);
+  body.summarize(summary);
+}
+
+inline void DoStatement::summarize(InlineSummary &summary) const {
+  summary.size++;
+  expr.summarize(summary);
+  body.summarize(summary);
+}
+
+inline void ForStatement::summarize(InlineSummary &summary) const {
+  summary.size++;
+  init.summarize(summary);
+  if (condition) condition->summarize(summary);
+  if (expr) expr->summarize(summary);
+  body.summarize(summary);
+}
+
+inline void SwitchStatement::summarize(InlineSummary &summary) const {
+  summary.size += 1 + labels.size();
+  condition.summarize(summary);
+  body.summarize(summary);
+}
+
+inline void InlinedCall::summarize(InlineSummary &summary) const {
+  for (const auto &parameter : parameters) {
+    parameter.summarize(summary);
+  }
+  body.summarize(summary);
+}
+
+inline void Statement::summarize(InlineSummary &summary) const {
+  std::visit([&summary](const auto &node) { node.summarize(summary); }, statement);
+}
+
+} /* namespace ast */
@@ -0,0 +1,350 @@
+#include "ast/loopInvariants.hpp"
+#include "nodes.h"
+
+namespace ast {
+
+// Moves the computations of a loop that give the same value on every iteration before it: each one is evaluated once
+// into a new variable of the enclosing scope, that the loop reads instead. Only expressions that can be evaluated
+// unconditionally are moved, as the loop may not run at all.
+class LoopInvariantHoister {
+public:
+  LoopInvariantHoister(scopes::ScopeStack &scopeStack, scopes::Scope &preheaderScope, LoopEffects &&effects)
+    : scopeStack(scopeStack), preheaderScope(preheaderScope), effects(std::move(effects)) {
+    // Declarations are decorated in place, they must not move afterwards
+    declarations.reserve(MAX_HOISTED_PER_LOOP);
+  }
+
+  // Replaces the expression by a read of the hoisted value when it is a loop invariant operation
+  bool tryHoist(Expression &expression) {
+    if (declarations.size() >= MAX_HOISTED_PER_LOOP) return false;
+    if (expression.asVariable() || expression.asNumberLiteral() || expression.asStringLiteral()) return false;
+    if (!expression.speculationCost() || !expression.isLoopInvariant(effects)) return false;
+
+    // Copies lose their decoration: the declaration decorates the value again, from the enclosing scope where every
+    // variable it reads is visible (variables declared in the loop are written by it)
+    auto name = scopeStack.generateVariableName("licm");
+    Type type(expression.getType()->name, 0);
+    auto &declaration = declarations.emplace_back(std::move(type), Variable(std::string_view(name)), Expression(expression));
+    declaration.decorate(scopeStack, preheaderScope);
+
+    expression.replaceByVariable(Variable(std::string_view(name)));
+    expression.decorate(scopeStack, preheaderScope);
+    return true;
+  }
+
+  std::vector<Declaration> takeDeclarations() { return std::move(declarations); }
+
+private:
+  scopes::ScopeStack &scopeStack;
+  scopes::Scope &preheaderScope;
+  LoopEffects effects;
+  std::vector<Declaration> declarations;
+};
+
+inline void TranslationUnit::hoistLoopInvariants(scopes::ScopeStack &scopeStack) {
+  for (auto &function : functions) {
+    function.hoistLoopInvariants(scopeStack);
+  }
+}
+
+inline void CodeBlock::hoistLoopInvariants(scopes::ScopeStack &scopeStack, scopes::Scope &enclosingScope) {
+  (void)enclosingScope;
+  DEBUG_ASSERT(scope, "CodeBlock is not decorated");
+  for (auto &statement : statements) {
+    statement.hoistLoopInvariants(scopeStack, *scope);
+  }
+}
+
+inline void Statement::hoistLoopInvariants(scopes::ScopeStack &scopeStack, scopes::Scope &scope) {
+  std::visit([&scopeStack, &scope](auto &node) { node.hoistLoopInvariants(scopeStack, scope); }, statement);
+}
+
+inline void Instruction::hoistLoopInvariants(scopes::ScopeStack &scopeStack, scopes::Scope &scope) {
+  (void)scopeStack;
+  (void)scope;
+}
+
+inline void ConditionalStatement::hoistLoopInvariants(scopes::ScopeStack &scopeStack, scopes::Scope &scope) {
+  ifBody.hoistLoopInvariants(scopeStack, scope);
+  if (elseBody) elseBody->hoistLoopInvariants(scopeStack, scope);
+}
+
+inline void SwitchStatement::hoistLoopInvariants(scopes::ScopeStack &scopeStack, scopes::Scope &scope) {
+  body.hoistLoopInvariants(scopeStack, scope);
+}
+
+inline void InlinedCall::hoistLoopInvariants(scopes::ScopeStack &scopeStack, scopes::Scope &scope) {
+  body.hoistLoopInvariants(scopeStack, scope);
+}
+
+// The whole loop is handled first, so that a value invariant in nested loops leaves all of them. Nested loops then
+// hoist what only they leave unchanged, into the body.
+inline void WhileStatement::hoistLoopInvariants(scopes::ScopeStack &scopeStack, scopes::Scope &scope) {
+  LoopEffects effects;
+  collectLoopEffects(effects);
+  if (!effects.containsInlineAsm) {
+    LoopInvariantHoister hoister(scopeStack, scope, std::move(effects));
+    condition.replaceInvariants(hoister);
+    body.replaceInvariants(hoister);
+    preheader = hoister.takeDeclarations();
+  }
+  body.hoistLoopInvariants(scopeStack, scope);
+}
+
+inline void DoStatement::hoistLoopInvariants(scopes::ScopeStack &scopeStack, scopes::Scope &scope) {
+  LoopEffects effects;
+  collectLoopEffects(effects);
+  if (!effects.containsInlineAsm) {
+    LoopInvariantHoister hoister(scopeStack, scope, std::move(effects));
+    body.replaceInvariants(hoister);
+    expr.replaceInvariants(hoister);
+    preheader = hoister.takeDeclarations();
+  }
+  body.hoistLoopInvariants(scopeStack, scope);
+}
+
+// The init statement runs once already: nothing is taken from it
+inline void ForStatement::hoistLoopInvariants(scopes::ScopeStack &scopeStack, scopes::Scope &scope) {
+  LoopEffects effects;
+  collectLoopEffects(effects);
+  if (!effects.containsInlineAsm) {
+    LoopInvariantHoister hoister(scopeStack, scope, std::move(effects));
+    if (condition) condition->replaceInvariants(hoister);
+    body.replaceInvariants(hoister);
+    if (expr) expr->replaceInvariants(hoister);
+    preheader = hoister.takeDeclarations();
+  }
+  body.hoistLoopInvariants(scopeStack, scope);
+}
+
+inline bool Expression::isLoopInvariant(const LoopEffects &effects) const {
+  return std::visit([&effects](const auto &node) {
+    using T = std::decay_t<decltype(node)>;
+    if constexpr (std::is_same_v<T, Variable>) {
+      const auto *description = node.getVariableDescription();
+      if (effects.containsCall && description->isGlobal() && !description->isReadOnly) return false;
+      return !effects.written.contains(description);
+    }
+    else if constexpr (std::is_same_v<T, NumberLiteral> || std::is_same_v<T, StringLiteral>) {
+      return true;
+    }
+    else if constexpr (std::is_same_v<T, BinaryOperation> || std::is_same_v<T, UnaryOperation>) {
+      return node.isLoopInvariant(effects);
+    }
+    else {
+      return false;
+    }
+  }, expr);
+}
+
+inline bool BinaryOperation::isLoopInvariant(const LoopEffects &effects) const {
+  return lhs->isLoopInvariant(effects) && rhs->isLoopInvariant(effects);
+}
+
+inline bool UnaryOperation::isLoopInvariant(const LoopEffects &effects) const {
+  return operand->isLoopInvariant(effects);
+}
+
+// Largest invariant subexpressions first: an operation is only split when it is not invariant as a whole
+inline void Expression::replaceInvariants(LoopInvariantHoister &hoister) {
+  if (hoister.tryHoist(*this)) return;
+  std::visit([&hoister](auto &node) { node.replaceInvariants(hoister); }, expr);
+}
+
+inline void Variable::replaceInvariants(LoopInvariantHoister &hoister) { (void)hoister; }
+
+inline void NumberLiteral::replaceInvariants(LoopInvariantHoister &hoister) { (void)hoister; }
+
+inline void StringLiteral::replaceInvariants(LoopInvariantHoister &hoister) { (void)hoister; }
+
+inline void FunctionCall::replaceInvariants(LoopInvariantHoister &hoister) {
+  for (auto &argument : arguments) {
+    argument.replaceInvariants(hoister);
+  }
+}
+
+inline void BinaryOperation::replaceInvariants(LoopInvariantHoister &hoister) {
+  lhs->replaceInvariants(hoister);
+  rhs->replaceInvariants(hoister);
+}
+
+inline void UnaryOperation::replaceInvariants(LoopInvariantHoister &hoister) {
+  operand->replaceInvariants(hoister);
+}
+
+inline void Assign::replaceInvariants(LoopInvariantHoister &hoister) {
+  if (index) index->replaceInvariants(hoister);
+  rhs->replaceInvariants(hoister);
+}
+
+inline void Subscript::replaceInvariants(LoopInvariantHoister &hoister) {
+  index->replaceInvariants(hoister);
+}
+
+inline void Declaration::replaceInvariants(LoopInvariantHoister &hoister) {
+  if (assignment) assignment->replaceInvariants(hoister);
+}
+
+inline void ReturnStatement::replaceInvariants(LoopInvariantHoister &hoister) {
+  expression.replaceInvariants(hoister);
+}
+
+inline void BreakStatement::replaceInvariants(LoopInvariantHoister &hoister) { (void)hoister; }
+
+inline void InlineAsmStatement::replaceInvariants(LoopInvariantHoister &hoister) { (void)hoister; }
+
+inline void Instruction::replaceInvariants(LoopInvariantHoister &hoister) {
+  std::visit([&hoister](auto &node) { node.replaceInvariants(hoister); }, instr);
+}
+
+inline void CodeBlock::replaceInvariants(LoopInvariantHoister &hoister) {
+  for (auto &statement : statements) {
+    statement.replaceInvariants(hoister);
+  }
+}
+
+inline void ConditionalStatement::replaceInvariants(LoopInvariantHoister &hoister) {
+  condition.replaceInvariants(hoister);
+  ifBody.replaceInvariants(hoister);
+  if (elseBody) elseBody->replaceInvariants(hoister);
+}
+
+inline void WhileStatement::replaceInvariants(LoopInvariantHoister &hoister) {
+  condition.replaceInvariants(hoister);
+  body.replaceInvariants(hoister);
+}
+
+inline void DoStatement::replaceInvariants(LoopInvariantHoister &hoister) {
+  body.replaceInvariants(hoister);
+  expr.replaceInvariants(hoister);
+}
+
+inline void ForStatement::replaceInvariants(LoopInvariantHoister &hoister) {
+  init.replaceInvariants(hoister);
+  if (condition) condition->replaceInvariants(hoister);
+  body.replaceInvariants(hoister);
+  if (expr) expr->replaceInvariants(hoister);
+}
+
+inline void SwitchStatement::replaceInvariants(LoopInvariantHoister &hoister) {
+  condition.replaceInvariants(hoister);
+  body.replaceInvariants(hoister);
+}
+
+inline void InlinedCall::replaceInvariants(LoopInvariantHoister &hoister) {
+  for (auto &parameter : parameters) {
+    parameter.replaceInvariants(hoister);
+  }
+  body.replaceInvariants(hoister);
+}
+
+inline void Statement::replaceInvariants(LoopInvariantHoister &hoister) {
+  std::visit([&hoister](auto &node) { node.replaceInvariants(hoister); }, statement);
+}
+
+inline void Variable::collectLoopEffects(LoopEffects &effects) const { (void)effects; }
+
+inline void NumberLiteral::collectLoopEffects(LoopEffects &effects) const { (void)effects; }
+
+inline void StringLiteral::collectLoopEffects(LoopEffects &effects) const { (void)effects; }
+
+inline void FunctionCall::collectLoopEffects(LoopEffects &effects) const {
+  effects.containsCall = true;
+  for (const auto &argument : arguments) {
+    argument.collectLoopEffects(effects);
+  }
+}
+
+inline void BinaryOperation::collectLoopEffects(LoopEffects &effects) const {
+  lhs->collectLoopEffects(effects);
+  rhs->collectLoopEffects(effects);
+}
+
+inline void UnaryOperation::collectLoopEffects(LoopEffects &effects) const {
+  operand->collectLoopEffects(effects);
+}
+
+// Writing an element writes the array
+inline void Assign::collectLoopEffects(LoopEffects &effects) const {
+  effects.written.insert(lhs->getVariableDescription());
+  if (index) {
+    effects.accessesArrays = true;
+    index->collectLoopEffects(effects);
+  }
+  rhs->collectLoopEffects(effects);
+}
+
+inline void Subscript::collectLoopEffects(LoopEffects &effects) const {
+  effects.accessesArrays = true;
+  index->collectLoopEffects(effects);
+}
+
+inline void Expression::collectLoopEffects(LoopEffects &effects) const {
+  std::visit([&effects](const auto &node) { node.collectLoopEffects(effects); }, expr);
+}
+
+inline void Declaration::collectLoopEffects(LoopEffects &effects) const {
+  effects.written.insert(variable.getVariableDescription());
+  if (assignment) assignment->collectLoopEffects(effects);
+}
+
+inline void ReturnStatement::collectLoopEffects(LoopEffects &effects) const {
+  expression.collectLoopEffects(effects);
+}
+
+inline void BreakStatement::collectLoopEffects(LoopEffects &effects) const { (void)effects; }
+
+inline void InlineAsmStatement::collectLoopEffects(LoopEffects &effects) const {
+  effects.containsInlineAsm = true;
+}
+
+inline void Instruction::collectLoopEffects(LoopEffects &effects) const {
+  std::visit([&effects](const auto &node) { node.collectLoopEffects(effects); }, instr);
+}
+
+inline void CodeBlock::collectLoopEffects(LoopEffects &effects) const {
+  for (const auto &statement : statements) {
+    statement.collectLoopEffects(effects);
+  }
+}
+
+inline void ConditionalStatement::collectLoopEffects(LoopEffects &effects) const {
+  condition.collectLoopEffects(effects);
+  ifBody.collectLoopEffects(effects);
+  if (elseBody) elseBody->collectLoopEffects(effects);
+}
+
+inline void WhileStatement::collectLoopEffects(LoopEffects &effects) const {
+  condition.collectLoopEffects(effects);
+  body.collectLoopEffects(effects);
+}
+
+inline void DoStatement::collectLoopEffects(LoopEffects &effects) const {
+  body.collectLoopEffects(effects);
+  expr.collectLoopEffects(effects);
+}
+
+inline void ForStatement::collectLoopEffects(LoopEffects &effects) const {
+  init.collectLoopEffects(effects);
+  if (condition) condition->collectLoopEffects(effects);
+  body.collectLoopEffects(effects);
+  if (expr) expr->collectLoopEffects(effects);
+}
+
+inline void SwitchStatement::collectLoopEffects(LoopEffects &effects) const {
+  condition.collectLoopEffects(effects);
+  body.collectLoopEffects(effects);
+}
+
+inline void InlinedCall::collectLoopEffects(LoopEffects &effects) const {
+  for (const auto &parameter : parameters) {
+    parameter.collectLoopEffects(effects);
+  }
+  body.collectLoopEffects(effects);
+}
+
+inline void Statement::collectLoopEffects(LoopEffects &effects) const {
+  std::visit([&effects](const auto &node) { node.collectLoopEffects(effects); }, statement);
+}
+
+} /* namespace ast */
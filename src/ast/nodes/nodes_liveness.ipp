@@ -0,0 +1,227 @@
+#include <variant>
+
+#include "ast/scopes/registers.hpp"
+#include "codegen/liveness.hpp"
+#include "codegen/RegisterAllocator.hpp"
+
+#include "nodes.h"
+
+namespace ast {
+
+inline void Variable::computeLiveness(codegen::LivenessBuilder &liveness) {
+  DEBUG_ASSERT(description, "Liveness computed on an undecorated variable " << name);
+  // Objects stay in their frame slot
+  if (!description->isRegisterCandidate()) return;
+  liveness.reference(*description);
+}
+
+inline void Variable::defineParameter(codegen::LivenessBuilder &liveness, const scopes::LocationDescription &incoming,
+                                      codegen::programPoint_t entry) {
+  DEBUG_ASSERT(description, "Parameter " << name << " is not decorated");
+  liveness.parameter(*description, incoming, entry);
+}
+
+inline void NumberLiteral::computeLiveness(codegen::LivenessBuilder &liveness) {
+  (void)liveness;
+}
+
+inline void StringLiteral::computeLiveness(codegen::LivenessBuilder &liveness) {
+  (void)liveness;
+}
+
+inline void FunctionCall::computeLiveness(codegen::LivenessBuilder &liveness) {
+  for (size_t i = 0; i < arguments.size(); i++) {
+    // The argument register is written before the next arguments are evaluated
+    if (i < scopes::FUNCTION_ARGUMENT_REGISTERS.size()) liveness.clobber(scopes::FUNCTION_ARGUMENT_REGISTERS[i]);
+    arguments[i].computeLiveness(liveness);
+  }
+  callPoint = liveness.call();
+}
+
+inline bool containsCall(const Expression &expression) {
+  LoopEffects effects;
+  expression.collectLoopEffects(effects);
+  return effects.containsCall;
+}
+
+// Program points follow the order operands are evaluated in. A call in one operand clobbers the registers of the
+// variables the other one reads after it: a folded lhs is only read once the rhs is computed, so the operand without a
+// call is numbered last, which keeps its variables live across the call.
+inline void BinaryOperation::computeLiveness(codegen::LivenessBuilder &liveness) {
+  bool lhsCalls = containsCall(*lhs);
+  bool rhsCalls = containsCall(*rhs);
+  bool rhsFirst = rhsCalls && (!lhsCalls || evaluatesRhsFirst());
+  if (rhsFirst) rhs->computeLiveness(liveness);
+  lhs->computeLiveness(liveness);
+  if (!rhsFirst) rhs->computeLiveness(liveness);
+  if (usesHardwareDivide()) {
+    liveness.clobber(scopes::GeneralPurposeRegister::REG_RAX);
+    liveness.clobber(scopes::GeneralPurposeRegister::REG_RDX);
+  }
+}
+
+inline void UnaryOperation::computeLiveness(codegen::LivenessBuilder &liveness) {
+  operand->computeLiveness(liveness);
+}
+
+inline void Assign::computeLiveness(codegen::LivenessBuilder &liveness) {
+  rhs->computeLiveness(liveness);
+  if (index) index->computeLiveness(liveness);
+  lhs->computeLiveness(liveness);
+}
+
+// Arrays stay in memory, like objects
+inline void Subscript::computeLiveness(codegen::LivenessBuilder &liveness) {
+  index->computeLiveness(liveness);
+}
+
+inline void Expression::computeLiveness(codegen::LivenessBuilder &liveness) {
+  liveness.requireTemporaries(getRegisterNeed());
+  programRange.begin = liveness.tick();
+  std::visit([&liveness](auto &node) { node.computeLiveness(liveness); }, expr);
+  programRange.end = liveness.tick();
+}
+
+// An initializer is evaluated in the register of the variable when it is free: with a call inside, the partial value
+// held there has to survive the call, so the variable is live from the start of its initializer
+inline void Declaration::computeLiveness(codegen::LivenessBuilder &liveness) {
+  programRange.begin = liveness.tick();
+  if (assignment && containsCall(*assignment)) variable.computeLiveness(liveness);
+  if (assignment) assignment->computeLiveness(liveness);
+  variable.computeLiveness(liveness);
+  if (assignment && assignment->asVariable()) {
+    liveness.copy(*variable.getVariableDescription(), *assignment->asVariable()->getVariableDescription());
+  }
+  programRange.end = liveness.tick();
+}
+
+inline void ReturnStatement::computeLiveness(codegen::LivenessBuilder &liveness) {
+  liveness.clobber(scopes::returnRegister);
+  expression.computeLiveness(liveness);
+}
+
+inline void BreakStatement::computeLiveness(codegen::LivenessBuilder &liveness) {
+  (void)liveness;
+}
+
+inline scopes::RegisterMask InlineAsmStatement::clobberedRegisters() const {
+  // Nothing is known about basic asm: every register may be overwritten
+  if (!clobbers) return codegen::allocatableRegisters();
+  scopes::RegisterMask clobbered = *clobbers;
+  for (const auto &request : requests) clobbered |= scopes::toMask(scopes::getGPRegisterID(request.registerTo));
+  return clobbered;
+}
+
+// Inputs are read before the block and outputs defined after it: only values live across it avoid the clobbers
+inline void InlineAsmStatement::computeLiveness(codegen::LivenessBuilder &liveness) {
+  for (auto &request : requests) {
+    if (request.isRead()) request.variable.computeLiveness(liveness);
+  }
+  liveness.clobber(clobberedRegisters());
+  for (auto &request : requests) {
+    if (request.isWritten()) request.variable.computeLiveness(liveness);
+  }
+}
+
+inline void Instruction::computeLiveness(codegen::LivenessBuilder &liveness) {
+  std::visit([&liveness](auto &node) { node.computeLiveness(liveness); }, instr);
+}
+
+inline void CodeBlock::computeLiveness(codegen::LivenessBuilder &liveness) {
+  for (auto &statement : statements) {
+    statement.computeLiveness(liveness);
+  }
+}
+
+inline void ConditionalStatement::computeLiveness(codegen::LivenessBuilder &liveness) {
+  condition.computeLiveness(liveness);
+  ifBody.computeLiveness(liveness);
+  if (elseBody) elseBody->computeLiveness(liveness);
+}
+
+inline void WhileStatement::computeLiveness(codegen::LivenessBuilder &liveness) {
+  for (auto &declaration : preheader) {
+    declaration.computeLiveness(liveness);
+  }
+  auto header = liveness.beginLoop();
+  condition.computeLiveness(liveness);
+  body.computeLiveness(liveness);
+  liveness.endLoop(header);
+}
+
+inline void DoStatement::computeLiveness(codegen::LivenessBuilder &liveness) {
+  for (auto &declaration : preheader) {
+    declaration.computeLiveness(liveness);
+  }
+  auto header = liveness.beginLoop();
+  body.computeLiveness(liveness);
+  expr.computeLiveness(liveness);
+  liveness.endLoop(header);
+}
+
+inline void ForStatement::computeLiveness(codegen::LivenessBuilder &liveness) {
+  init.computeLiveness(liveness);
+  for (auto &declaration : preheader) {
+    declaration.computeLiveness(liveness);
+  }
+  auto header = liveness.beginLoop();
+  if (condition) condition->computeLiveness(liveness);
+  body.computeLiveness(liveness);
+  if (expr) expr->computeLiveness(liveness);
+  liveness.endLoop(header);
+}
+
+// Cases are laid out in order: entering one directly only skips code, every jump is forward
+inline void SwitchStatement::computeLiveness(codegen::LivenessBuilder &liveness) {
+  condition.computeLiveness(liveness);
+  body.computeLiveness(liveness);
+}
+
+inline void InlinedCall::computeLiveness(codegen::LivenessBuilder &liveness) {
+  for (auto &parameter : parameters) {
+    parameter.computeLiveness(liveness);
+  }
+  body.computeLiveness(liveness);
+}
+
+inline void Statement::computeLiveness(codegen::LivenessBuilder &liveness) {
+  std::visit([&liveness](auto &node) { node.computeLiveness(liveness); }, statement);
+}
+
+inline void FunctionParameter::computeLiveness(codegen::LivenessBuilder &liveness, size_t index, codegen::programPoint_t entry) {
+  if (variable.getName().empty()) return;
+  variable.defineParameter(liveness, scopes::incomingArgumentLocation(index, getTypeDescription()->byteSize), entry);
+}
+
+inline void Function::allocateRegisters() {
+  codegen::LivenessBuilder liveness;
+  auto entry = liveness.tick();
+  body.computeLiveness(liveness);
+  size_t index = 0;
+  for (auto &param : params) {
+    param.computeLiveness(liveness, index++, entry);
+  }
+  allocation = codegen::LinearScanAllocator(liveness).run();
+
+  DEBUG_ASSERT(body.getScope(), "Function " << name << " is not decorated");
+  allocation.frameSize = body.getScope()->layoutFrame(0);
+}
+
+inline void Function::debugRegisterAllocation() const {
+  LOG_DEBUG("[Function] name=" << name);
+  allocation.logDebug();
+}
+
+inline void TranslationUnit::allocateRegisters() {
+  for (auto &func : functions) {
+    func.allocateRegisters();
+  }
+}
+
+inline void TranslationUnit::debugRegisterAllocation() const {
+  for (auto &func : functions) {
+    func.debugRegisterAllocation();
+  }
+}
+
+} /* namespace ast */
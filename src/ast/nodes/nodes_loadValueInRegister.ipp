@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "ast/scopes/registers.hpp"
 #include "codegen/generate.hpp"
 #include "dbg/logger.hpp"
@@ -5,56 +7,343 @@
 
 namespace ast {
 
+inline bool BinaryOperation::isComparison() const {
+  switch (op) {
+    case Operation::CMP_EQ:
+    case Operation::CMP_NEQ:
+    case Operation::CMP_LEQ:
+    case Operation::CMP_GEQ:
+    case Operation::CMP_LT:
+    case Operation::CMP_GT:
+      return true;
+    default:
+      return false;
+  }
+}
+
+inline bool BinaryOperation::usesHardwareDivide() const {
+  if (op != Operation::DIVIDE && op != Operation::MODULO) return false;
+  auto divisor = rhs->asInt32Constant();
+  return !divisor || *divisor == 0;
+}
+
+inline bool Expression::isFoldableOperand(scopes::byteSize_t size) const {
+  if (asInt32Constant()) return true;
+  const auto *variable = asVariable();
+  return variable && variable->isFoldableOperand(size);
+}
+
+inline codegen::MachineOperand Expression::asFoldedOperand(codegen::NasmGenerator_x86_64 &generator, scopes::byteSize_t size) const {
+  if (auto constant = asInt32Constant()) return codegen::Immediate{*constant};
+  DEBUG_ASSERT(asVariable(), "Expression can not be folded in an instruction");
+  return asVariable()->asOperand(generator, size);
+}
+
+inline std::optional<uint32_t> Expression::speculationCost() const {
+  return std::visit([](const auto &node) -> std::optional<uint32_t> {
+    using T = std::decay_t<decltype(node)>;
+    if constexpr (std::is_same_v<T, NumberLiteral> || std::is_same_v<T, StringLiteral> || std::is_same_v<T, Variable>) {
+      return 1;
+    }
+    else if constexpr (std::is_same_v<T, BinaryOperation> || std::is_same_v<T, UnaryOperation> || std::is_same_v<T, Subscript>) {
+      return node.speculationCost();
+    }
+    else {
+      // Calls and assignments have side effects
+      return std::nullopt;
+    }
+  }, expr);
+}
+
+inline std::optional<uint32_t> BinaryOperation::speculationCost() const {
+  // idiv faults on a zero divisor (or INT_MIN / -1) that the branch may have been guarding against
+  if (usesHardwareDivide()) return std::nullopt;
+  auto lhsCost = lhs->speculationCost();
+  auto rhsCost = rhs->speculationCost();
+  if (!lhsCost || !rhsCost) return std::nullopt;
+
+  uint32_t cost = 1;
+  // Evaluated without its jump chain: both operands are tested and combined
+  if (isLogical()) cost = 2;
+  else if (op == Operation::MULTIPLY) cost = 3;
+  else if (op == Operation::DIVIDE || op == Operation::MODULO) cost = 6;
+  return *lhsCost + *rhsCost + cost;
+}
+
+// Registers needed to evaluate the tree without spilling. Folded constants and variables cost nothing beyond their
+// operand.
+inline uint32_t BinaryOperation::computeRegisterNeed() const {
+  uint32_t lhsNeed = lhs->getRegisterNeed();
+  uint32_t rhsNeed = rhs->getRegisterNeed();
+  auto size = operandType->byteSize;
+
+  // Each operand is tested on its own, nothing is held across the jump
+  if (isLogical()) return std::max(lhsNeed, rhsNeed);
+
+  if (op == Operation::MULTIPLY) {
+    if (rhs->asInt32Constant()) return lhsNeed;
+    if (lhs->asInt32Constant()) return rhsNeed;
+  }
+  if (op == Operation::DIVIDE || op == Operation::MODULO) {
+    // Magic-number division needs the dividend, the quotient and, for the remainder, the sign
+    if (!usesHardwareDivide()) return std::max(lhsNeed, op == Operation::MODULO ? 3u : 2u);
+  }
+  else {
+    if (rhs->isFoldableOperand(size)) return lhsNeed;
+    if ((op == Operation::ADD || op == Operation::MULTIPLY) && lhs->isFoldableOperand(size)) return rhsNeed;
+  }
+
+  return lhsNeed == rhsNeed ? lhsNeed + 1 : std::max(lhsNeed, rhsNeed);
+}
+
+inline std::optional<uint32_t> UnaryOperation::speculationCost() const {
+  auto operandCost = operand->speculationCost();
+  if (!operandCost) return std::nullopt;
+  return *operandCost + 1;
+}
+
+inline uint32_t UnaryOperation::getRegisterNeed() const { return operand->getRegisterNeed(); }
+
+inline bool BinaryOperation::evaluatesRhsFirst() const {
+  return rhs->getRegisterNeed() > lhs->getRegisterNeed();
+}
+
+inline BinaryOperation::SourceOperand BinaryOperation::loadOperands(codegen::NasmGenerator_x86_64 &generator, scopes::GeneralPurposeRegister targetRegister, scopes::RegisterMask exclude, Folding folding) const {
+  auto size = operandType->byteSize;
+
+  // Folded operands are read after the loaded one: frame slots addressed from rsp move with its pushes
+  if (folding != Folding::NONE && rhs->isFoldableOperand(size)) {
+    lhs->loadValueInRegister(generator, targetRegister);
+    return {std::nullopt, rhs->asFoldedOperand(generator, size)};
+  }
+  if (folding == Folding::COMMUTATIVE && lhs->isFoldableOperand(size)) {
+    rhs->loadValueInRegister(generator, targetRegister);
+    return {std::nullopt, lhs->asFoldedOperand(generator, size)};
+  }
+
+  exclude |= scopes::toMask(targetRegister);
+  std::optional<scopes::GPRegisterSet::RegisterGuard> gRhsRegister;
+  if (evaluatesRhsFirst()) {
+    gRhsRegister.emplace(generator.regSet().acquireGuard(exclude));
+    rhs->loadValueInRegister(generator, gRhsRegister->reg);
+    lhs->loadValueInRegister(generator, targetRegister);
+  }
+  else {
+    lhs->loadValueInRegister(generator, targetRegister);
+    // Only taken once the lhs is done: left-leaning chains need a single extra register. The target holds the lhs, it
+    // can not be borrowed for the rhs.
+    gRhsRegister.emplace(generator.regSet().acquireGuard(exclude));
+    rhs->loadValueInRegister(generator, gRhsRegister->reg);
+  }
+
+  auto rhsRegister = scopes::getProperRegisterFromID64(gRhsRegister->reg, size);
+  return {std::move(gRhsRegister), rhsRegister};
+}
+
+inline bool BinaryOperation::tryEmitLea(codegen::NasmGenerator_x86_64 &generator, scopes::GeneralPurposeRegister targetRegister) const {
+  if (op != Operation::ADD && op != Operation::SUBSTRACT) return false;
+  auto size = operandType->byteSize;
+
+  auto registerOf = [size](const Expression &operand) -> std::optional<scopes::Register> {
+    const auto *variable = operand.asVariable();
+    if (!variable || !variable->isFoldableOperand(size)) return std::nullopt;
+    const auto *reg = std::get_if<scopes::Register>(&variable->getVariableDescription()->location);
+    if (!reg) return std::nullopt;
+    return scopes::getProperRegisterFromID64(scopes::getGPRegisterID(*reg));
+  };
+  auto lhsRegister = registerOf(*lhs);
+  auto rhsRegister = registerOf(*rhs);
+
+  std::optional<codegen::MemoryOperand> address;
+  if (lhsRegister && rhsRegister && op == Operation::ADD) {
+    address = codegen::MemoryOperand{*lhsRegister, 0, *rhsRegister};
+  }
+  else if (auto constant = rhs->asInt32Constant(); lhsRegister && constant) {
+    address = codegen::MemoryOperand{*lhsRegister, op == Operation::SUBSTRACT ? -int64_t{*constant} : *constant};
+  }
+  else if (auto constant = lhs->asInt32Constant(); rhsRegister && constant && op == Operation::ADD) {
+    address = codegen::MemoryOperand{*rhsRegister, *constant};
+  }
+  if (!address) return false;
+
+  generator.emitLea(scopes::getProperRegisterFromID64(targetRegister, size), *address);
+  return true;
+}
+
+inline codegen::CMP_OPERATION BinaryOperation::emitCompare(codegen::NasmGenerator_x86_64 &generator, scopes::GeneralPurposeRegister lhsRegister) const {
+  DEBUG_ASSERT(isComparison(), "Operation " << static_cast<char>(op) << " does not set comparison flags");
+  auto condition = static_cast<codegen::CMP_OPERATION>(op);
+  auto size = operandType->byteSize;
+
+  // cmp dword [rbp-4], 5: a variable compared with a constant or a variable in a register is not loaded at all
+  if (lhs->asVariable() && lhs->isFoldableOperand(size) && rhs->isFoldableOperand(size)) {
+    auto lhsOperand = lhs->asFoldedOperand(generator, size);
+    auto rhsOperand = rhs->asFoldedOperand(generator, size);
+    if (!std::holds_alternative<codegen::MemoryOperand>(lhsOperand) || !std::holds_alternative<codegen::MemoryOperand>(rhsOperand)) {
+      generator.emitBinaryOp(codegen::Opcode::CMP, lhsOperand, rhsOperand);
+      return condition;
+    }
+  }
+
+  auto source = loadOperands(generator, lhsRegister, {}, Folding::RHS);
+  generator.emitBinaryOp(codegen::Opcode::CMP, scopes::getProperRegisterFromID64(lhsRegister, size), source.operand);
+  return condition;
+}
+
 inline void BinaryOperation::loadValueInRegister(codegen::NasmGenerator_x86_64 &generator, scopes::GeneralPurposeRegister targetRegister) const {
-  auto gRhsRegister = generator.regSet().acquireGuard();
-  if (!gRhsRegister) TODO("Not enough registers, memory fallback not implemented");
+  // The value of a comparison is only materialized when it is stored: conditions branch on the flags (Expression::emitBranch)
+  if (isComparison()) {
+    auto condition = emitCompare(generator, targetRegister);
+    generator.emitSetCC(scopes::getProperRegisterFromID64(targetRegister, 1), condition);
+    generator.emitMovzx(scopes::getProperRegisterFromID64(targetRegister, 4), scopes::getProperRegisterFromID64(targetRegister, 1));
+    return;
+  }
 
-  auto tmpRegister = gRhsRegister->reg;
+  if (isLogical()) return loadLogicalValue(generator, targetRegister);
 
-  lhs->loadValueInRegister(generator, targetRegister);
-  rhs->loadValueInRegister(generator, tmpRegister);
+  switch (op) {
+    case Operation::MULTIPLY:
+      return loadProduct(generator, targetRegister);
+    case Operation::DIVIDE:
+    case Operation::MODULO:
+      return loadQuotient(generator, targetRegister);
+    default:
+      break;
+  }
 
-  constexpr auto size = 8; // TODO get size from decoration step
+  if (tryEmitLea(generator, targetRegister)) return;
 
-  auto properTargetReg = scopes::getProperRegisterFromID64(targetRegister, size);
-  auto properTmpReg = scopes::getProperRegisterFromID64(tmpRegister, size);
-  auto tgtRegByte = scopes::getProperRegisterFromID64(targetRegister, 1);
+  auto source = loadOperands(generator, targetRegister, {}, op == Operation::ADD ? Folding::COMMUTATIVE : Folding::RHS);
+  auto properTargetReg = scopes::getProperRegisterFromID64(targetRegister, operandType->byteSize);
 
   switch (op) {
     case Operation::ADD:
-      generator.emitAdd(properTargetReg, properTmpReg);
+      generator.emitBinaryOp(codegen::Opcode::ADD, properTargetReg, source.operand);
       break;
     case Operation::SUBSTRACT:
-      generator.emitSub(properTargetReg, properTmpReg);
-      break;
-    case Operation::CMP_EQ:
-      generator.emitCmp(properTargetReg, properTmpReg);
-      generator.emitSetCC(tgtRegByte, codegen::CMP_OPERATION::EQ);
-      break;
-    case Operation::CMP_NEQ:
-      generator.emitCmp(properTargetReg, properTmpReg);
-      generator.emitSetCC(tgtRegByte, codegen::CMP_OPERATION::NEQ);
-      break;
-    case Operation::CMP_LEQ:
-      generator.emitCmp(properTargetReg, properTmpReg);
-      LOG_DEBUG("LEQ is seen here");
-      generator.emitSetCC(tgtRegByte, codegen::CMP_OPERATION::LEQ);
-      break;
-    case Operation::CMP_GEQ:
-      generator.emitCmp(properTargetReg, properTmpReg);
-      generator.emitSetCC(tgtRegByte, codegen::CMP_OPERATION::GEQ);
-      break;
-    case Operation::CMP_LT:
-      generator.emitCmp(properTargetReg, properTmpReg);
-      generator.emitSetCC(tgtRegByte, codegen::CMP_OPERATION::LT);
-      break;
-    case Operation::CMP_GT:
-      generator.emitCmp(properTargetReg, properTmpReg);
-      generator.emitSetCC(tgtRegByte, codegen::CMP_OPERATION::GT);
+      generator.emitBinaryOp(codegen::Opcode::SUB, properTargetReg, source.operand);
       break;
     default:
       THROW("Unrecognised operation " << static_cast<char>(op));
   }
 }
 
+// a && b: the last operand reached decides the value, a shortcut out of the chain decides it alone.
+//   (lhs branch to shortcut) ; cmp/test rhs ; setcc ; movzx ; jmp end ; shortcut: mov target, 0 (1 for ||) ; end:
+inline void BinaryOperation::loadLogicalValue(codegen::NasmGenerator_x86_64 &generator, scopes::GeneralPurposeRegister targetRegister) const {
+  bool shortcutValue = op == Operation::LOGICAL_OR;
+  auto shortcutLabel = generator.generateUniqueLabel("logical.shortcut");
+  auto endLabel = generator.generateUniqueLabel("logical.end");
+
+  lhs->emitBranch(generator, shortcutLabel, shortcutValue);
+  auto condition = rhs->emitFlags(generator, targetRegister);
+  generator.emitSetCC(scopes::getProperRegisterFromID64(targetRegister, 1), condition);
+  generator.emitMovzx(scopes::getProperRegisterFromID64(targetRegister, 4), scopes::getProperRegisterFromID64(targetRegister, 1));
+  generator.emitJump(endLabel);
+  generator.emitLabel(shortcutLabel);
+  generator.emitLoadNumberLiteral(scopes::getProperRegisterFromID64(targetRegister, 4), shortcutValue ? 1 : 0);
+  generator.emitLabel(endLabel);
+}
+
+inline void UnaryOperation::loadValueInRegister(codegen::NasmGenerator_x86_64 &generator, scopes::GeneralPurposeRegister targetRegister) const {
+  auto condition = codegen::invertCondition(operand->emitFlags(generator, targetRegister));
+  generator.emitSetCC(scopes::getProperRegisterFromID64(targetRegister, 1), condition);
+  generator.emitMovzx(scopes::getProperRegisterFromID64(targetRegister, 4), scopes::getProperRegisterFromID64(targetRegister, 1));
+}
+
+inline void BinaryOperation::loadProduct(codegen::NasmGenerator_x86_64 &generator, scopes::GeneralPurposeRegister targetRegister) const {
+  // Constant factors, on either side, become shift/lea sequences
+  if (auto factor = rhs->asInt32Constant()) {
+    lhs->loadValueInRegister(generator, targetRegister);
+    generator.emitMultiplyByConstant(targetRegister, *factor);
+    return;
+  }
+  if (auto factor = lhs->asInt32Constant()) {
+    rhs->loadValueInRegister(generator, targetRegister);
+    generator.emitMultiplyByConstant(targetRegister, *factor);
+    return;
+  }
+
+  auto source = loadOperands(generator, targetRegister, {}, Folding::COMMUTATIVE);
+  generator.emitBinaryOp(codegen::Opcode::IMUL, scopes::getProperRegisterFromID64(targetRegister, operandType->byteSize), source.operand);
+}
+
+inline void BinaryOperation::loadQuotient(codegen::NasmGenerator_x86_64 &generator, scopes::GeneralPurposeRegister targetRegister) const {
+  bool remainder = op == Operation::MODULO;
+
+  if (!usesHardwareDivide()) {
+    lhs->loadValueInRegister(generator, targetRegister);
+    generator.emitSignedDivideByConstant(targetRegister, *rhs->asInt32Constant(), remainder);
+    return;
+  }
+
+  // idiv reads edx:eax, the divisor has to live elsewhere
+  auto fixedRegisters = scopes::toMask(scopes::GeneralPurposeRegister::REG_RAX) | scopes::toMask(scopes::GeneralPurposeRegister::REG_RDX);
+  auto divisor = loadOperands(generator, targetRegister, fixedRegisters, Folding::NONE);
+  generator.emitSignedDivide(targetRegister, divisor.guard->reg, remainder);
+}
+
+// Only literal indices are known to be within the array: any other one may be what the branch was checking
+inline std::optional<uint32_t> Subscript::speculationCost() const {
+  if (!index->asInt32Constant()) return std::nullopt;
+  return 1;
+}
+
+inline uint32_t Subscript::addressRegisterNeed(const Variable &array, const Expression &index) {
+  if (index.asInt32Constant()) return 0;
+  return std::max<uint32_t>(index.getRegisterNeed(), array.getVariableDescription()->isGlobal() ? 2 : 1);
+}
+
+// The index is evaluated in the target, which then receives the element
+inline uint32_t Subscript::getRegisterNeed() const { return std::max<uint32_t>(addressRegisterNeed(array, *index), 1); }
+
+inline Subscript::ElementAddress Subscript::emitElementAddress(codegen::NasmGenerator_x86_64 &generator, const Variable &array,
+                                                               const Expression &index,
+                                                               std::optional<scopes::GeneralPurposeRegister> indexRegister,
+                                                               scopes::RegisterMask exclude) {
+  ElementAddress address;
+  auto elementSize = array.getType()->elementType->byteSize;
+  int64_t displacement = 0;
+  std::optional<scopes::Register> scaledIndex;
+  if (auto constant = index.asInt32Constant()) {
+    displacement = static_cast<int64_t>(*constant) * elementSize;
+  }
+  else {
+    if (!indexRegister) {
+      address.index.emplace(generator.regSet().acquireGuard(exclude));
+      indexRegister = address.index->reg;
+    }
+    index.loadValueInRegister(generator, *indexRegister);
+    // Ints are written through 32-bit registers, which clears the upper half: an index within the array can be used as is
+    scaledIndex = scopes::getProperRegisterFromID64(*indexRegister);
+    exclude |= scopes::toMask(*indexRegister);
+  }
+
+  const auto &location = array.getVariableDescription()->location;
+  if (const auto *global = std::get_if<scopes::GlobalStackOffset>(&location)) {
+    address.operand = codegen::NasmGenerator_x86_64::globalSlot(*global);
+    if (scaledIndex) {
+      address.base.emplace(generator.regSet().acquireGuard(exclude));
+      auto base = scopes::getProperRegisterFromID64(address.base->reg);
+      generator.emitLea(base, address.operand);
+      address.operand = codegen::MemoryOperand{base};
+    }
+  }
+  else {
+    address.operand = generator.frameSlot(std::get<scopes::LocalStackOffset>(location));
+  }
+  address.operand.displacement += displacement;
+  address.operand.index = scaledIndex;
+  address.operand.scale = static_cast<uint8_t>(elementSize);
+  address.operand.byteSize = static_cast<uint8_t>(elementSize);
+  return address;
+}
+
+inline void Subscript::loadValueInRegister(codegen::NasmGenerator_x86_64 &generator, scopes::GeneralPurposeRegister targetRegister) const {
+  auto element = emitElementAddress(generator, array, *index, targetRegister);
+  auto size = getType()->byteSize;
+  if (size < 4) generator.emitBinaryOp(codegen::Opcode::MOVSX, generator.int32(targetRegister), element.operand);
+  else generator.emitBinaryOp(codegen::Opcode::MOV, scopes::getProperRegisterFromID64(targetRegister, size), element.operand);
+}
+
 } /* namespace ast */
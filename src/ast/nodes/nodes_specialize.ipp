@@ -0,0 +1,370 @@
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <utility>
+
+#include "ast/specialization.hpp"
+#include "nodes.h"
+
+namespace ast {
+
+// Interprocedural constant propagation over the calls left after inlining. A first walk meets the arguments of every
+// call site of each function (a parameter is constant when all of its sites pass the same literal) and records the
+// names each body reads or writes. A second walk redirects each call to a clone of its callee where constant parameters
+// are read as literals and unused ones are gone: an int parameter the body never writes is bound to its literal when it
+// is constant, or at any site inside a loop, and any parameter is dropped when the body never names it and its argument
+// has no side effects. Every function is a global symbol, so callers outside the translation unit may exist: the
+// original is always kept, clones are local and only emitted while a call to them is left after constant evaluation.
+class CallSpecializer {
+public:
+  CallSpecializer(std::vector<Function> &functions, std::deque<std::string> &cloneNames)
+      : functions(functions), cloneNames(cloneNames), clones(functions.size()) {
+    for (size_t index = 0; index < functions.size(); index++) {
+      auto &function = functions[index];
+      auto &summary = summaries.emplace(function.getName(), FunctionSummary{.index = index}).first->second;
+      summary.arguments.resize(function.getParams().size());
+      function.summarize(summary.size);
+    }
+  }
+
+  SpecializationReport run() {
+    phase = Phase::COLLECT;
+    for (auto &function : functions) {
+      current = &summaries.at(function.getName());
+      function.specializeCalls(*this);
+    }
+
+    // Source order: a callee is rewritten before it is cloned for its callers
+    phase = Phase::REWRITE;
+    for (auto &function : functions) {
+      current = &summaries.at(function.getName());
+      function.specializeCalls(*this);
+    }
+
+    // Each clone follows its original: callees stay defined before their callers
+    std::vector<Function> specialized;
+    for (size_t index = 0; index < functions.size(); index++) {
+      specialized.push_back(std::move(functions[index]));
+      for (auto &clone : clones[index]) specialized.push_back(std::move(clone));
+    }
+    functions = std::move(specialized);
+    return std::move(report);
+  }
+
+  // Name read or written by the function being walked
+  void use(std::string_view name) {
+    if (phase == Phase::COLLECT) current->usedNames.insert(name);
+  }
+
+  // Name assigned, declared or handed to inline asm by the function being walked: never replaced by a literal
+  void write(std::string_view name) {
+    if (phase == Phase::COLLECT) current->writtenNames.insert(name);
+  }
+
+  // Literal read instead of the variable while a clone body is walked
+  std::optional<NumberLiteralUnderlyingType> boundValue(std::string_view name) const {
+    if (phase != Phase::SUBSTITUTE) return std::nullopt;
+    auto bound = boundValues.find(name);
+    if (bound == boundValues.end()) return std::nullopt;
+    return bound->second;
+  }
+
+  // Visited after its arguments
+  void visit(FunctionCall &call, uint32_t loopDepth) {
+    if (phase == Phase::COLLECT) collect(call);
+    else if (phase == Phase::REWRITE) rewrite(call, loopDepth);
+  }
+
+private:
+  enum class Phase { COLLECT, REWRITE, SUBSTITUTE };
+
+  // Lattice of the values a parameter receives over all call sites
+  struct ArgumentValue {
+    enum class State { UNSEEN, CONSTANT, VARYING };
+
+    State state = State::UNSEEN;
+    NumberLiteralUnderlyingType value = 0;
+
+    void meet(const Expression &argument) {
+      const auto *literal = argument.asNumberLiteral();
+      if (!literal) state = State::VARYING;
+      else if (state == State::UNSEEN) { state = State::CONSTANT; value = literal->getValue(); }
+      else if (state == State::CONSTANT && value != literal->getValue()) state = State::VARYING;
+    }
+  };
+
+  struct FunctionSummary {
+    size_t index;
+    InlineSummary size = {};
+    std::vector<ArgumentValue> arguments;
+    std::set<std::string_view> usedNames;
+    std::set<std::string_view> writtenNames;
+    std::map<std::vector<ParameterBinding>, std::string_view> clones;
+  };
+
+  FunctionSummary *findCallee(const FunctionCall &call) {
+    auto callee = summaries.find(call.getName());
+    if (callee == summaries.end()) return nullptr;
+    // Left for decoration to report
+    if (call.getArguments().size() != callee->second.arguments.size()) return nullptr;
+    return &callee->second;
+  }
+
+  void collect(const FunctionCall &call) {
+    auto *callee = findCallee(call);
+    if (!callee) return;
+    auto argument = call.getArguments().begin();
+    for (auto &value : callee->arguments) value.meet(*argument++);
+  }
+
+  std::vector<ParameterBinding> bind(const FunctionSummary &callee, const FunctionCall &call, uint32_t loopDepth) const {
+    std::vector<ParameterBinding> bindings;
+    auto argument = call.getArguments().begin();
+    auto value = callee.arguments.begin();
+    for (const auto &parameter : functions[callee.index].getParams()) {
+      auto name = parameter.getVariable().getName();
+      const auto *literal = argument->asNumberLiteral();
+      if ((name.empty() || !callee.usedNames.contains(name)) && argument->speculationCost()) {
+        bindings.push_back({ParameterBinding::Kind::DROP, 0});
+      }
+      else if (literal && (value->state == ArgumentValue::State::CONSTANT || loopDepth > 0) && parameter.getType().isInt()
+               && !callee.writtenNames.contains(name) && literal->getValue() <= std::numeric_limits<int32_t>::max()) {
+        bindings.push_back({ParameterBinding::Kind::CONSTANT, literal->getValue()});
+      }
+      else {
+        bindings.push_back({});
+      }
+      argument++;
+      value++;
+    }
+    return bindings;
+  }
+
+  void rewrite(FunctionCall &call, uint32_t loopDepth) {
+    auto *callee = findCallee(call);
+    if (!callee || call.getArguments().empty()) return;
+    auto bindings = bind(*callee, call, loopDepth);
+
+    std::string_view clone;
+    const char *reason = nullptr;
+    auto existing = callee->clones.find(bindings);
+    if (callee == current) reason = "recursive";
+    else if (std::all_of(bindings.begin(), bindings.end(), [](const auto &binding) { return binding.kind == ParameterBinding::Kind::KEEP; })) {
+      reason = "no constant or unused argument";
+    }
+    else if (existing != callee->clones.end()) { clone = existing->second; reason = "existing clone"; }
+    else if (callee->size.containsInlineAsm) reason = "inline asm";
+    else if (callee->size.size > SPECIALIZE_MAX_SIZE) reason = "too large";
+    else if (callee->clones.size() >= SPECIALIZE_MAX_CLONES) reason = "too many clones";
+    else {
+      clone = cloneNames.emplace_back(cloneName(call.getName(), bindings));
+      auto &specialized = clones[callee->index].emplace_back(functions[callee->index].cloneSpecialized(clone, bindings));
+      substitute(specialized, functions[callee->index], bindings);
+      callee->clones.emplace(bindings, clone);
+      reason = "new clone";
+    }
+
+    report.decisions.push_back({functions[current->index].getName(), call.getName(), clone, reason});
+    if (clone.empty()) return;
+
+    std::vector<bool> removed;
+    for (const auto &binding : bindings) removed.push_back(binding.kind != ParameterBinding::Kind::KEEP);
+    call.redirect(clone, removed);
+  }
+
+  // Bound parameters are read as literals, so that constant evaluation and folding see their value
+  void substitute(Function &clone, const Function &original, const std::vector<ParameterBinding> &bindings) {
+    auto binding = bindings.begin();
+    for (const auto &parameter : original.getParams()) {
+      if (binding->kind == ParameterBinding::Kind::CONSTANT) boundValues.emplace(parameter.getVariable().getName(), binding->value);
+      binding++;
+    }
+    phase = Phase::SUBSTITUTE;
+    clone.specializeCalls(*this);
+    phase = Phase::REWRITE;
+    boundValues.clear();
+  }
+
+  // helper.k4 for helper(4), helper._.d for a second parameter dropped: never a C++ identifier
+  static std::string cloneName(std::string_view callee, const std::vector<ParameterBinding> &bindings) {
+    auto last = bindings.size();
+    while (last && bindings[last - 1].kind == ParameterBinding::Kind::KEEP) last--;
+
+    std::string name(callee);
+    for (size_t i = 0; i < last; i++) {
+      switch (bindings[i].kind) {
+      case ParameterBinding::Kind::KEEP: name += "._"; break;
+      case ParameterBinding::Kind::CONSTANT: name += ".k" + std::to_string(bindings[i].value); break;
+      case ParameterBinding::Kind::DROP: name += ".d"; break;
+      }
+    }
+    return name;
+  }
+
+private:
+  std::vector<Function> &functions;
+  std::deque<std::string> &cloneNames;
+  std::vector<std::vector<Function>> clones;
+  std::map<std::string_view, FunctionSummary> summaries;
+  std::map<std::string_view, NumberLiteralUnderlyingType> boundValues;
+  FunctionSummary *current = nullptr;
+  Phase phase = Phase::COLLECT;
+  SpecializationReport report;
+};
+
+inline SpecializationReport TranslationUnit::specializeCalls() {
+  return CallSpecializer(functions, cloneNames).run();
+}
+
+inline void FunctionCall::redirect(std::string_view target, const std::vector<bool> &removedArguments) {
+  DEBUG_ASSERT(removedArguments.size() == arguments.size(), "FunctionCall " << name << " redirected with another arity");
+  std::vector<Expression> kept;
+  for (size_t i = 0; i < arguments.size(); i++) {
+    if (!removedArguments[i]) kept.push_back(std::move(arguments[i]));
+  }
+  name = target;
+  arguments = std::move(kept);
+}
+
+inline Function Function::cloneSpecialized(std::string_view cloneName, const std::vector<ParameterBinding> &bindings) const {
+  std::vector<FunctionParameter> keptParameters;
+  auto binding = bindings.begin();
+  for (const auto &parameter : params) {
+    if ((binding++)->kind == ParameterBinding::Kind::KEEP) keptParameters.push_back(parameter);
+  }
+
+  Function clone(Type(returnType), cloneName, FunctionParameterList(std::move(keptParameters)), CodeBlock(body),
+                 inlineHint, constexprSpecified);
+  clone.exported = false;
+  return clone;
+}
+
+/** Walk: arguments before their call, loop bodies one level deeper **/
+
+inline void Variable::specializeCalls(CallSpecializer &specializer, uint32_t loopDepth) {
+  (void)loopDepth;
+  specializer.use(name);
+}
+
+inline void NumberLiteral::specializeCalls(CallSpecializer &specializer, uint32_t loopDepth) {
+  (void)specializer;
+  (void)loopDepth;
+}
+
+inline void StringLiteral::specializeCalls(CallSpecializer &specializer, uint32_t loopDepth) {
+  (void)specializer;
+  (void)loopDepth;
+}
+
+inline void FunctionCall::specializeCalls(CallSpecializer &specializer, uint32_t loopDepth) {
+  for (auto &argument : arguments) {
+    argument.specializeCalls(specializer, loopDepth);
+  }
+  specializer.visit(*this, loopDepth);
+}
+
+inline void BinaryOperation::specializeCalls(CallSpecializer &specializer, uint32_t loopDepth) {
+  lhs->specializeCalls(specializer, loopDepth);
+  rhs->specializeCalls(specializer, loopDepth);
+}
+
+inline void UnaryOperation::specializeCalls(CallSpecializer &specializer, uint32_t loopDepth) {
+  operand->specializeCalls(specializer, loopDepth);
+}
+
+inline void Assign::specializeCalls(CallSpecializer &specializer, uint32_t loopDepth) {
+  specializer.write(lhs->getName());
+  lhs->specializeCalls(specializer, loopDepth);
+  if (index) index->specializeCalls(specializer, loopDepth);
+  rhs->specializeCalls(specializer, loopDepth);
+}
+
+inline void Subscript::specializeCalls(CallSpecializer &specializer, uint32_t loopDepth) {
+  array.specializeCalls(specializer, loopDepth);
+  index->specializeCalls(specializer, loopDepth);
+}
+
+inline void Expression::specializeCalls(CallSpecializer &specializer, uint32_t loopDepth) {
+  std::visit([&specializer, loopDepth](auto &node) { node.specializeCalls(specializer, loopDepth); }, expr);
+  if (const auto *variable = asVariable()) {
+    if (auto value = specializer.boundValue(variable->getName())) expr = NumberLiteral(*value);
+  }
+}
+
+// A local shadowing a parameter counts as a use of it, and keeps its reads from being replaced
+inline void Declaration::specializeCalls(CallSpecializer &specializer, uint32_t loopDepth) {
+  specializer.write(variable.getName());
+  variable.specializeCalls(specializer, loopDepth);
+  if (assignment) assignment->specializeCalls(specializer, loopDepth);
+}
+
+inline void ReturnStatement::specializeCalls(CallSpecializer &specializer, uint32_t loopDepth) {
+  expression.specializeCalls(specializer, loopDepth);
+}
+
+inline void BreakStatement::specializeCalls(CallSpecializer &specializer, uint32_t loopDepth) {
+  (void)specializer;
+  (void)loopDepth;
+}
+
+inline void InlineAsmStatement::specializeCalls(CallSpecializer &specializer, uint32_t loopDepth) {
+  for (auto &request : requests) {
+    specializer.write(request.variable.getName());
+    request.variable.specializeCalls(specializer, loopDepth);
+  }
+}
+
+inline void Instruction::specializeCalls(CallSpecializer &specializer, uint32_t loopDepth) {
+  std::visit([&specializer, loopDepth](auto &node) { node.specializeCalls(specializer, loopDepth); }, instr);
+}
+
+inline void CodeBlock::specializeCalls(CallSpecializer &specializer, uint32_t loopDepth) {
+  for (auto &statement : statements) {
+    statement.specializeCalls(specializer, loopDepth);
+  }
+}
+
+inline void ConditionalStatement::specializeCalls(CallSpecializer &specializer, uint32_t loopDepth) {
+  condition.specializeCalls(specializer, loopDepth);
+  ifBody.specializeCalls(specializer, loopDepth);
+  if (elseBody) elseBody->specializeCalls(specializer, loopDepth);
+}
+
+inline void WhileStatement::specializeCalls(CallSpecializer &specializer, uint32_t loopDepth) {
+  condition.specializeCalls(specializer, loopDepth + 1);
+  body.specializeCalls(specializer, loopDepth + 1);
+}
+
+inline void DoStatement::specializeCalls(CallSpecializer &specializer, uint32_t loopDepth) {
+  body.specializeCalls(specializer, loopDepth + 1);
+  expr.specializeCalls(specializer, loopDepth + 1);
+}
+
+inline void ForStatement::specializeCalls(CallSpecializer &specializer, uint32_t loopDepth) {
+  init.specializeCalls(specializer, loopDepth);
+  if (condition) condition->specializeCalls(specializer, loopDepth + 1);
+  body.specializeCalls(specializer, loopDepth + 1);
+  if (expr) expr->specializeCalls(specializer, loopDepth + 1);
+}
+
+inline void SwitchStatement::specializeCalls(CallSpecializer &specializer, uint32_t loopDepth) {
+  condition.specializeCalls(specializer, loopDepth);
+  body.specializeCalls(specializer, loopDepth);
+}
+
+inline void InlinedCall::specializeCalls(CallSpecializer &specializer, uint32_t loopDepth) {
+  for (auto &parameter : parameters) {
+    parameter.specializeCalls(specializer, loopDepth);
+  }
+  body.specializeCalls(specializer, loopDepth);
+}
+
+inline void Statement::specializeCalls(CallSpecializer &specializer, uint32_t loopDepth) {
+  std::visit([&specializer, loopDepth](auto &node) { node.specializeCalls(specializer, loopDepth); }, statement);
+}
+
+} /* namespace ast */
@@ -0,0 +1,770 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <optional>
+#include <set>
+#include <vector>
+
+#include "codegen/generate.hpp"
+#include "codegen/vectorize.hpp"
+#include "nodes.h"
+
+namespace ast
+{
+
+// Runs lanes iterations of a counted loop `for (...; i < n; i = i + 1)` at once, when its body is made of:
+//   x[i + c] = E;                                     element stores
+//   if (C) x[i + c] = A; [else x[i + c] = B;]         selects, both sides computed and blended by the mask of C
+//   s = s + E;  s = s - E;                            int sums
+//   if (E > m) m = E;  if (E < m) m = E;              min/max, and the other ways of writing them
+// where the expressions combine elements at i + constant, loop-invariant variables and literals with + - * and the
+// comparisons. Every array has the same element type, which gives the lanes: 4 ints or 16 chars per SSE2 register.
+//
+// Arrays are distinct objects that nothing points to: two of them never overlap, and a written array only has to be read
+// at the offset it is written at for the iterations to stay independent. Every lane accesses the elements the scalar loop
+// only accesses under a condition: an access done by every iteration, or the constant bounds, must prove them in their
+// array.
+class LoopVectorizer {
+public:
+  LoopVectorizer(const scopes::VariableDescription *induction, std::optional<int32_t> start, std::optional<uint64_t> trips, bool avx2)
+    : induction(induction), start(start), trips(trips), avx2(avx2) {}
+
+  // Null when the body can be vectorized, the reason it can not otherwise
+  const char *analyze(const CodeBlock &body) {
+    for (const auto &statement : body.getStatements()) {
+      addStatement(statement);
+      if (failure) return failure;
+    }
+    if (!elementType) return reject("reads no array");
+    lanes = codegen::vectorBytes(avx2) / elementType->byteSize;
+    if (elementType->byteSize == 1) {
+      if (multiplies) return reject("multiplies chars");
+      for (const auto *expression : narrowOperands) {
+        if (!isNarrow(*expression)) return reject("compares ints in char lanes");
+      }
+    }
+    if (trips && *trips < lanes) return reject("fewer iterations than lanes");
+
+    for (const auto &access : accesses) {
+      if (access.write) {
+        for (const auto &other : accesses) {
+          if (other.array == access.array && other.offset != access.offset) return reject("reads a written array at another offset");
+        }
+      }
+      if (access.conditional && !isCovered(access) && !isInBounds(access)) return reject("accesses an element the loop may not");
+    }
+    for (const auto &statement : statements) {
+      if (statement.kind == VectorStatement::Kind::STORE) continue;
+      if (readScalars.contains(statement.scalar->getVariableDescription())) return reject("reads a reduction variable");
+      if (statement.kind == VectorStatement::Kind::SUM && elementType->byteSize != 4) return reject("sums chars");
+      if (statement.kind != VectorStatement::Kind::SUM && statement.scalar->getType()->byteSize != elementType->byteSize) {
+        return reject("mixes int and char lanes");
+      }
+    }
+
+    uint8_t reserved = static_cast<uint8_t>(broadcasts.size());
+    uint32_t need = 0;
+    for (auto &statement : statements) {
+      if (statement.kind != VectorStatement::Kind::STORE) statement.accumulator = reserved++;
+      need = std::max(need, statementNeed(statement));
+    }
+    if (reserved + need > codegen::VECTOR_REGISTER_COUNT) return reject("needs more vector registers than there are");
+    firstTemporary = reserved;
+    return nullptr;
+  }
+
+  uint32_t getLanes() const { return lanes; }
+
+  // General purpose registers held by the vector loop: the index, the limit and the global array bases, plus one for the
+  // setup and the reductions
+  size_t registerNeed(const Expression &bound) const {
+    std::set<const scopes::VariableDescription *> globals;
+    for (const auto &access : accesses) {
+      if (std::holds_alternative<scopes::GlobalStackOffset>(access.array->location)) globals.insert(access.array);
+    }
+    return 2 + (immediateLimit(bound) ? 0 : 1) + globals.size();
+  }
+
+  // The vector loop runs while i + lanes - 1 passes the test, then stores the next i back for the scalar loop to finish
+  void emit(codegen::NasmGenerator_x86_64 &generator, const Expression &bound, codegen::CMP_OPERATION op) {
+    auto loopLabel = generator.generateUniqueLabel("for.vector");
+    auto endLabel = generator.generateUniqueLabel("for.vector.end");
+
+    std::optional<scopes::GPRegisterSet::RegisterGuard> indexGuard(generator.regSet().acquireGuard());
+    index = scopes::getProperRegisterFromID64(indexGuard->reg, 8);
+    generator.emitLoadSignExtended(*index, induction->location, 4);
+
+    // 64-bit, neither can overflow
+    std::optional<scopes::GPRegisterSet::RegisterGuard> limitGuard;
+    codegen::MachineOperand limit;
+    int64_t lastLane = lanes - 1;
+    if (immediateLimit(bound)) {
+      limit = codegen::Immediate{*bound.asInt32Constant() - lastLane};
+    }
+    else {
+      limitGuard.emplace(generator.regSet().acquireGuard());
+      auto reg = scopes::getProperRegisterFromID64(limitGuard->reg, 8);
+      if (const auto *variable = bound.asVariable()) {
+        generator.emitLoadSignExtended(reg, variable->getVariableDescription()->location, variable->getType()->byteSize);
+      }
+      else {
+        bound.loadValueInRegister(generator, limitGuard->reg);
+        generator.emitBinaryOp(codegen::Opcode::MOVSXD, reg, scopes::getProperRegisterFromID64(limitGuard->reg, 4));
+      }
+      generator.emitBinaryOp(codegen::Opcode::SUB, reg, codegen::Immediate{lastLane});
+      limit = reg;
+    }
+
+    std::vector<scopes::GPRegisterSet::RegisterGuard> baseGuards;
+    for (const auto &access : accesses) {
+      const auto *global = std::get_if<scopes::GlobalStackOffset>(&access.array->location);
+      if (!global || bases.contains(access.array)) continue;
+      baseGuards.push_back(generator.regSet().acquireGuard());
+      auto base = scopes::getProperRegisterFromID64(baseGuards.back().reg, 8);
+      generator.emitLea(base, codegen::NasmGenerator_x86_64::globalSlot(*global));
+      bases.emplace(access.array, base);
+    }
+
+    emitSetup(generator);
+
+    generator.emitBinaryOp(codegen::Opcode::CMP, *index, limit);
+    generator.emitJumpCC(endLabel, codegen::invertCondition(op));
+    generator.emitLabel(loopLabel);
+    for (const auto &statement : statements) {
+      emitStatement(generator, statement);
+    }
+    generator.emitBinaryOp(codegen::Opcode::ADD, *index, codegen::Immediate{static_cast<int64_t>(lanes)});
+    generator.emitBinaryOp(codegen::Opcode::CMP, *index, limit);
+    generator.emitJumpCC(loopLabel, op);
+    generator.emitLabel(endLabel);
+    generator.emitStoreInMemory(induction->location, scopes::getProperRegisterFromID64(indexGuard->reg, 4));
+
+    while (!baseGuards.empty()) baseGuards.pop_back();
+    limitGuard.reset();
+    indexGuard.reset();
+
+    for (const auto &statement : statements) {
+      if (statement.kind != VectorStatement::Kind::STORE) emitReduction(generator, statement);
+    }
+    generator.emitVzeroupper();
+  }
+
+private:
+  // The limit fits the sign-extended 32-bit immediate of cmp
+  bool immediateLimit(const Expression &bound) const {
+    auto constant = bound.asInt32Constant();
+    return constant && *constant - static_cast<int64_t>(lanes - 1) >= std::numeric_limits<int32_t>::min();
+  }
+
+  struct Node {
+    enum class Kind : uint8_t {
+      LOAD, BROADCAST, ADD, SUBSTRACT, MULTIPLY, CMP_EQ, CMP_GT, AND, OR, XOR, SELECT,
+    };
+
+    Kind kind;
+    // LOAD only
+    const scopes::VariableDescription *array = nullptr;
+    int32_t offset = 0;
+    // BROADCAST only: the register holding it
+    uint8_t broadcast = 0;
+    // SELECT: mask, value where set, value where clear
+    std::vector<Node> operands = {};
+  };
+
+  struct VectorStatement {
+    enum class Kind : uint8_t { STORE, SUM, MIN, MAX };
+
+    Kind kind;
+    Node value;
+    // STORE only
+    const scopes::VariableDescription *array = nullptr;
+    int32_t offset = 0;
+    // Reductions only: s - E sums are subtracted once, at the end
+    const Variable *scalar = nullptr;
+    bool subtract = false;
+    uint8_t accumulator = 0;
+  };
+
+  struct Access {
+    const scopes::VariableDescription *array;
+    int32_t offset;
+    bool write;
+    // Under a condition or on the right of && and ||
+    bool conditional;
+  };
+
+  // A loop-invariant variable or a literal, in every lane
+  struct Broadcast {
+    const Variable *variable;
+    int32_t constant;
+  };
+
+  std::nullopt_t fail(const char *reason) {
+    if (!failure) failure = reason;
+    return std::nullopt;
+  }
+
+  const char *reject(const char *reason) {
+    fail(reason);
+    return failure;
+  }
+
+  void addStatement(const Statement &statement) {
+    if (const auto *conditional = statement.asConditionalStatement()) return addConditional(*conditional);
+    const auto *expression = statement.asExpression();
+    const auto *assign = expression ? expression->asAssign() : nullptr;
+    if (!assign) return (void)fail("has a statement other than an assignment or an if");
+
+    if (assign->isElementStore()) {
+      if (!addAccess(assign->getVariable(), assign->getIndex(), true, false)) return;
+      auto value = valueNode(assign->getValue(), false);
+      if (!value) return;
+      statements.push_back({VectorStatement::Kind::STORE, std::move(*value), assign->getVariable().getVariableDescription(),
+                            *inductionOffset(assign->getIndex())});
+      return;
+    }
+
+    // s = s + E, s = E + s, s = s - E
+    const auto *scalar = &assign->getVariable();
+    const auto *operation = assign->getValue().asBinaryOperation();
+    if (!operation || scalar->getType()->id != scopes::IDX_INT_TYPE) return (void)fail("writes a scalar");
+    const Expression *term = nullptr;
+    bool subtract = operation->getOperation() == BinaryOperation::Operation::SUBSTRACT;
+    if (isScalar(operation->getLhs(), *scalar)) term = &operation->getRhs();
+    else if (!subtract && isScalar(operation->getRhs(), *scalar)) term = &operation->getLhs();
+    if (!term || (!subtract && operation->getOperation() != BinaryOperation::Operation::ADD)) return (void)fail("writes a scalar");
+
+    auto value = valueNode(*term, false);
+    if (!value) return;
+    addReduction({VectorStatement::Kind::SUM, std::move(*value), nullptr, 0, scalar, subtract});
+  }
+
+  void addConditional(const ConditionalStatement &conditional) {
+    const auto *ifAssign = singleAssign(conditional.getIfBody());
+    if (!ifAssign) return (void)fail("has an if other than a select or a min/max");
+
+    if (!ifAssign->isElementStore()) {
+      if (conditional.getElseBody()) return (void)fail("has an if other than a select or a min/max");
+      return addMinMax(conditional.getCondition(), *ifAssign);
+    }
+
+    const auto *elseAssign = conditional.getElseBody() ? singleAssign(*conditional.getElseBody()) : nullptr;
+    if (conditional.getElseBody() && (!elseAssign || !elseAssign->isElementStore())) return (void)fail("has an if other than a select or a min/max");
+    const auto *array = ifAssign->getVariable().getVariableDescription();
+    if (elseAssign && (elseAssign->getVariable().getVariableDescription() != array
+                       || inductionOffset(elseAssign->getIndex()) != inductionOffset(ifAssign->getIndex()))) {
+      return (void)fail("selects between different elements");
+    }
+
+    auto mask = maskNode(conditional.getCondition(), false);
+    if (!mask) return;
+    // Without an else, every element is still written back: unchanged where the condition is false
+    if (!addAccess(ifAssign->getVariable(), ifAssign->getIndex(), true, !elseAssign)) return;
+    auto whenSet = valueNode(ifAssign->getValue(), true);
+    if (!whenSet) return;
+    // Without an else, the element keeps its value where the condition is false
+    std::optional<Node> whenClear = elseAssign ? valueNode(elseAssign->getValue(), true)
+                                               : Node{Node::Kind::LOAD, array, *inductionOffset(ifAssign->getIndex())};
+    if (!whenClear) return;
+    Node select{Node::Kind::SELECT};
+    select.operands = {std::move(*mask), std::move(*whenSet), std::move(*whenClear)};
+    statements.push_back({VectorStatement::Kind::STORE, std::move(select), array, *inductionOffset(ifAssign->getIndex())});
+  }
+
+  // if (E > m) m = E and the other ways of writing it
+  void addMinMax(const Expression &condition, const Assign &assign) {
+    const auto *scalar = &assign.getVariable();
+    const auto *comparison = condition.asBinaryOperation();
+    if (!comparison || !comparison->isComparison()) return (void)fail("writes a scalar under a condition");
+    auto op = comparison->getOperation();
+    bool greater = op == BinaryOperation::Operation::CMP_GT || op == BinaryOperation::Operation::CMP_GEQ;
+    bool less = op == BinaryOperation::Operation::CMP_LT || op == BinaryOperation::Operation::CMP_LEQ;
+    bool max;
+    if (isScalar(comparison->getRhs(), *scalar) && sameValue(comparison->getLhs(), assign.getValue())) max = greater;
+    else if (isScalar(comparison->getLhs(), *scalar) && sameValue(comparison->getRhs(), assign.getValue())) max = less;
+    else return (void)fail("writes a scalar under a condition");
+    if (!greater && !less) return (void)fail("writes a scalar under a condition");
+
+    auto value = valueNode(assign.getValue(), false);
+    if (!value) return;
+    narrowOperands.push_back(&assign.getValue());
+    addReduction({max ? VectorStatement::Kind::MAX : VectorStatement::Kind::MIN, std::move(*value), nullptr, 0, scalar});
+  }
+
+  void addReduction(VectorStatement &&statement) {
+    for (const auto &other : statements) {
+      if (other.scalar && other.scalar->getVariableDescription() == statement.scalar->getVariableDescription()) {
+        return (void)fail("reduces a variable twice");
+      }
+    }
+    statements.push_back(std::move(statement));
+  }
+
+  std::optional<Node> valueNode(const Expression &expression, bool conditional) {
+    if (auto constant = expression.asInt32Constant()) return Node{Node::Kind::BROADCAST, nullptr, 0, broadcastConstant(*constant)};
+    if (const auto *variable = expression.asVariable()) return broadcastVariable(*variable);
+    if (const auto *subscript = expression.asSubscript()) {
+      if (!addAccess(subscript->getArray(), subscript->getIndex(), false, conditional)) return std::nullopt;
+      return Node{Node::Kind::LOAD, subscript->getArray().getVariableDescription(), *inductionOffset(subscript->getIndex())};
+    }
+    if (const auto *operation = expression.asBinaryOperation()) {
+      Node::Kind kind;
+      switch (operation->getOperation()) {
+        case BinaryOperation::Operation::ADD: kind = Node::Kind::ADD; break;
+        case BinaryOperation::Operation::SUBSTRACT: kind = Node::Kind::SUBSTRACT; break;
+        case BinaryOperation::Operation::MULTIPLY:
+          // pmulld is SSE4.1, and there is no byte multiplication
+          if (!avx2) return fail("multiplies without AVX2");
+          kind = Node::Kind::MULTIPLY;
+          break;
+        case BinaryOperation::Operation::DIVIDE:
+        case BinaryOperation::Operation::MODULO:
+          return fail("divides");
+        default:
+          return maskValue(expression, conditional);
+      }
+      auto lhs = valueNode(operation->getLhs(), conditional);
+      auto rhs = valueNode(operation->getRhs(), conditional);
+      if (!lhs || !rhs) return std::nullopt;
+      multiplies |= kind == Node::Kind::MULTIPLY;
+      Node node{kind};
+      node.operands = {std::move(*lhs), std::move(*rhs)};
+      return node;
+    }
+    if (expression.asUnaryOperation()) return maskValue(expression, conditional);
+    if (expression.asFunctionCall()) return fail("calls a function");
+    if (expression.asAssign()) return fail("assigns inside an expression");
+    return fail("has an expression that can not be vectorized");
+  }
+
+  // A comparison used as a value is 0 or 1, a mask is 0 or -1
+  std::optional<Node> maskValue(const Expression &expression, bool conditional) {
+    auto mask = maskNode(expression, conditional);
+    if (!mask) return std::nullopt;
+    Node node{Node::Kind::SUBSTRACT};
+    node.operands = {Node{Node::Kind::BROADCAST, nullptr, 0, broadcastConstant(0)}, std::move(*mask)};
+    return node;
+  }
+
+  // Every bit of a lane set where the condition holds
+  std::optional<Node> maskNode(const Expression &expression, bool conditional) {
+    if (const auto *unary = expression.asUnaryOperation()) {
+      auto operand = maskNode(unary->getOperand(), conditional);
+      if (!operand) return std::nullopt;
+      return invert(std::move(*operand));
+    }
+
+    const auto *operation = expression.asBinaryOperation();
+    if (operation && (operation->getOperation() == BinaryOperation::Operation::LOGICAL_AND
+                      || operation->getOperation() == BinaryOperation::Operation::LOGICAL_OR)) {
+      // The right operand is not always evaluated: its elements are read conditionally
+      auto lhs = maskNode(operation->getLhs(), conditional);
+      auto rhs = maskNode(operation->getRhs(), true);
+      if (!lhs || !rhs) return std::nullopt;
+      Node node{operation->getOperation() == BinaryOperation::Operation::LOGICAL_AND ? Node::Kind::AND : Node::Kind::OR};
+      node.operands = {std::move(*lhs), std::move(*rhs)};
+      return node;
+    }
+
+    if (operation && operation->isComparison()) {
+      auto lhs = valueNode(operation->getLhs(), conditional);
+      auto rhs = valueNode(operation->getRhs(), conditional);
+      if (!lhs || !rhs) return std::nullopt;
+      narrowOperands.push_back(&operation->getLhs());
+      narrowOperands.push_back(&operation->getRhs());
+      auto compare = [](Node::Kind kind, Node &&a, Node &&b) {
+        Node node{kind};
+        node.operands = {std::move(a), std::move(b)};
+        return node;
+      };
+      // Only == and > exist: a < b is b > a, the others are negations
+      switch (static_cast<codegen::CMP_OPERATION>(operation->getOperation())) {
+        case codegen::CMP_OPERATION::EQ: return compare(Node::Kind::CMP_EQ, std::move(*lhs), std::move(*rhs));
+        case codegen::CMP_OPERATION::NEQ: return invert(compare(Node::Kind::CMP_EQ, std::move(*lhs), std::move(*rhs)));
+        case codegen::CMP_OPERATION::GT: return compare(Node::Kind::CMP_GT, std::move(*lhs), std::move(*rhs));
+        case codegen::CMP_OPERATION::LT: return compare(Node::Kind::CMP_GT, std::move(*rhs), std::move(*lhs));
+        case codegen::CMP_OPERATION::LEQ: return invert(compare(Node::Kind::CMP_GT, std::move(*lhs), std::move(*rhs)));
+        case codegen::CMP_OPERATION::GEQ: return invert(compare(Node::Kind::CMP_GT, std::move(*rhs), std::move(*lhs)));
+        default: return fail("has an unsupported comparison");
+      }
+    }
+
+    // Any other value is true when not zero
+    auto value = valueNode(expression, conditional);
+    if (!value) return std::nullopt;
+    narrowOperands.push_back(&expression);
+    Node equal{Node::Kind::CMP_EQ};
+    equal.operands = {std::move(*value), Node{Node::Kind::BROADCAST, nullptr, 0, broadcastConstant(0)}};
+    return invert(std::move(equal));
+  }
+
+  Node invert(Node &&mask) {
+    Node node{Node::Kind::XOR};
+    node.operands = {std::move(mask), Node{Node::Kind::BROADCAST, nullptr, 0, broadcastConstant(-1)}};
+    return node;
+  }
+
+  std::optional<Node> broadcastVariable(const Variable &variable) {
+    const auto *description = variable.getVariableDescription();
+    if (description == induction) return fail("uses the induction variable outside of an index");
+    auto id = variable.getType()->id;
+    if (id != scopes::IDX_INT_TYPE && id != scopes::IDX_CHAR_TYPE) return fail("reads a pointer");
+    readScalars.insert(description);
+    auto [entry, inserted] = broadcastVariables.try_emplace(description, static_cast<uint8_t>(broadcasts.size()));
+    if (inserted) broadcasts.push_back({&variable, 0});
+    return Node{Node::Kind::BROADCAST, nullptr, 0, entry->second};
+  }
+
+  uint8_t broadcastConstant(int32_t constant) {
+    auto [entry, inserted] = broadcastConstants.try_emplace(constant, static_cast<uint8_t>(broadcasts.size()));
+    if (inserted) broadcasts.push_back({nullptr, constant});
+    return entry->second;
+  }
+
+  bool addAccess(const Variable &array, const Expression &index, bool write, bool conditional) {
+    const auto *type = array.getType();
+    const char *reason = nullptr;
+    auto offset = inductionOffset(index);
+    if (type->elementType->id == scopes::IDX_POINTER_TYPE) reason = "accesses an array of pointers";
+    else if (elementType && elementType != type->elementType) reason = "mixes int and char arrays";
+    else if (!offset) reason = "indexes an array with something else than i + constant";
+    if (reason) {
+      fail(reason);
+      return false;
+    }
+    elementType = type->elementType;
+    accesses.push_back({array.getVariableDescription(), *offset, write, conditional});
+    return true;
+  }
+
+  // c for i + c, i - c and c + i
+  std::optional<int32_t> inductionOffset(const Expression &index) const {
+    if (isInduction(index)) return 0;
+    const auto *operation = index.asBinaryOperation();
+    if (!operation) return std::nullopt;
+    auto rhs = operation->getRhs().asInt32Constant();
+    if (operation->getOperation() == BinaryOperation::Operation::ADD) {
+      if (isInduction(operation->getLhs()) && rhs) return rhs;
+      auto lhs = operation->getLhs().asInt32Constant();
+      if (lhs && isInduction(operation->getRhs())) return lhs;
+    }
+    if (operation->getOperation() == BinaryOperation::Operation::SUBSTRACT && isInduction(operation->getLhs()) && rhs
+        && *rhs != std::numeric_limits<int32_t>::min()) {
+      return -*rhs;
+    }
+    return std::nullopt;
+  }
+
+  bool isInduction(const Expression &expression) const {
+    return expression.asVariable() && expression.asVariable()->getVariableDescription() == induction;
+  }
+
+  static bool isScalar(const Expression &expression, const Variable &scalar) {
+    return expression.asVariable() && expression.asVariable()->getVariableDescription() == scalar.getVariableDescription();
+  }
+
+  // In char lanes, values are compared and tested on 8 bits: they must fit there
+  bool isNarrow(const Expression &expression) const {
+    if (expression.asSubscript()) return true;
+    if (auto constant = expression.asInt32Constant()) return *constant >= -128 && *constant <= 127;
+    return expression.asVariable() && expression.asVariable()->getType()->byteSize == 1;
+  }
+
+  static const Assign *singleAssign(const CodeBlock &block) {
+    if (block.getStatements().size() != 1) return nullptr;
+    const auto *expression = block.getStatements().front().asExpression();
+    return expression ? expression->asAssign() : nullptr;
+  }
+
+  // The same value, read the same way
+  static bool sameValue(const Expression &a, const Expression &b) {
+    if (auto constant = a.asInt32Constant()) return b.asInt32Constant() == constant;
+    if (const auto *variable = a.asVariable()) return isScalar(b, *variable);
+    if (const auto *subscript = a.asSubscript()) {
+      const auto *other = b.asSubscript();
+      return other && other->getArray().getVariableDescription() == subscript->getArray().getVariableDescription()
+             && sameValue(subscript->getIndex(), other->getIndex());
+    }
+    if (const auto *operation = a.asBinaryOperation()) {
+      const auto *other = b.asBinaryOperation();
+      return other && other->getOperation() == operation->getOperation() && sameValue(operation->getLhs(), other->getLhs())
+             && sameValue(operation->getRhs(), other->getRhs());
+    }
+    return false;
+  }
+
+  // An element accessed by every iteration at i + o' is in its array: i + o is then in its own one when the offsets and
+  // lengths leave room for it
+  bool isCovered(const Access &access) const {
+    auto length = [](const scopes::VariableDescription *array) {
+      return static_cast<int64_t>((*array->typeDescription)->elementCount);
+    };
+    for (const auto &other : accesses) {
+      if (other.conditional || access.offset < other.offset) continue;
+      if (length(other.array) + access.offset - other.offset <= length(access.array)) return true;
+    }
+    return false;
+  }
+
+  bool isInBounds(const Access &access) const {
+    if (!start || !trips) return false;
+    int64_t first = static_cast<int64_t>(*start) + access.offset;
+    int64_t last = first + static_cast<int64_t>(*trips) - 1;
+    return first >= 0 && last < static_cast<int64_t>((*access.array->typeDescription)->elementCount);
+  }
+
+  // Broadcasts are in registers, elements folded into the operation under AVX2 (VEX forms accept unaligned operands)
+  bool isFoldable(const Node &node) const { return node.kind == Node::Kind::BROADCAST || (avx2 && node.kind == Node::Kind::LOAD); }
+
+  // Temporary vector registers needed to compute the node, its result included
+  uint32_t need(const Node &node) const {
+    switch (node.kind) {
+      case Node::Kind::LOAD: case Node::Kind::BROADCAST:
+        return 1;
+      case Node::Kind::SELECT:
+        return std::max({need(node.operands[0]), 1 + need(node.operands[1]), 2 + operandNeed(node.operands[2])});
+      default:
+        return std::max(need(node.operands[0]), 1 + operandNeed(node.operands[1]));
+    }
+  }
+
+  uint32_t operandNeed(const Node &node) const { return isFoldable(node) ? 0 : need(node); }
+
+  uint32_t statementNeed(const VectorStatement &statement) const {
+    switch (statement.kind) {
+      case VectorStatement::Kind::STORE: return need(statement.value);
+      // The horizontal reduction needs two registers. SSE2 min/max blend with a mask: the value and that mask.
+      case VectorStatement::Kind::SUM: return std::max<uint32_t>(operandNeed(statement.value), 2);
+      default: return std::max<uint32_t>(need(statement.value), 2);
+    }
+  }
+
+  codegen::VectorRegister vector(codegen::NasmGenerator_x86_64 &generator, uint8_t index) const { return generator.vectorRegister(index); }
+
+  codegen::MemoryOperand elementOperand(codegen::NasmGenerator_x86_64 &generator, const scopes::VariableDescription *array, int32_t offset) const {
+    auto elementSize = elementType->byteSize;
+    codegen::MemoryOperand operand;
+    if (auto base = bases.find(array); base != bases.end()) operand = codegen::MemoryOperand{base->second};
+    else operand = generator.frameSlot(std::get<scopes::LocalStackOffset>(array->location));
+    operand.displacement += static_cast<int64_t>(offset) * elementSize;
+    operand.index = index;
+    operand.scale = static_cast<uint8_t>(elementSize);
+    return operand;
+  }
+
+  void emitSetup(codegen::NasmGenerator_x86_64 &generator) const {
+    auto scratchGuard = generator.regSet().acquireGuard();
+    for (uint8_t i = 0; i < broadcasts.size(); i++) {
+      const auto &broadcast = broadcasts[i];
+      if (!broadcast.variable && broadcast.constant == 0) generator.emitVectorOp(codegen::Opcode::PXOR, vector(generator, i), vector(generator, i));
+      else if (!broadcast.variable && broadcast.constant == -1) generator.emitVectorOp(codegen::Opcode::PCMPEQD, vector(generator, i), vector(generator, i));
+      else {
+        if (broadcast.variable) broadcast.variable->loadValueInRegister(generator, scratchGuard.reg);
+        else generator.emitBinaryOp(codegen::Opcode::MOV, generator.int32(scratchGuard.reg), codegen::Immediate{broadcast.constant});
+        generator.emitVectorBroadcast(vector(generator, i), scratchGuard.reg, elementType->byteSize);
+      }
+    }
+
+    // The identity of the reduction in every lane
+    for (const auto &statement : statements) {
+      auto accumulator = vector(generator, statement.accumulator);
+      if (statement.kind == VectorStatement::Kind::SUM) {
+        generator.emitVectorOp(codegen::Opcode::PXOR, accumulator, accumulator);
+        continue;
+      }
+      if (statement.kind == VectorStatement::Kind::STORE) continue;
+      bool max = statement.kind == VectorStatement::Kind::MAX;
+      int64_t identity = elementType->byteSize == 1 ? (max ? std::numeric_limits<int8_t>::min() : std::numeric_limits<int8_t>::max())
+                                                    : (max ? std::numeric_limits<int32_t>::min() : std::numeric_limits<int32_t>::max());
+      generator.emitBinaryOp(codegen::Opcode::MOV, generator.int32(scratchGuard.reg), codegen::Immediate{identity});
+      generator.emitVectorBroadcast(accumulator, scratchGuard.reg, elementType->byteSize);
+    }
+  }
+
+  void emitStatement(codegen::NasmGenerator_x86_64 &generator, const VectorStatement &statement) const {
+    auto accumulator = vector(generator, statement.accumulator);
+    switch (statement.kind) {
+      case VectorStatement::Kind::STORE:
+        emitNode(generator, statement.value, firstTemporary);
+        generator.emitVectorMove(elementOperand(generator, statement.array, statement.offset), vector(generator, firstTemporary));
+        break;
+      case VectorStatement::Kind::SUM:
+        generator.emitVectorOp(codegen::Opcode::PADDD, accumulator, emitOperand(generator, statement.value, firstTemporary));
+        break;
+      case VectorStatement::Kind::MIN:
+      case VectorStatement::Kind::MAX:
+        emitNode(generator, statement.value, firstTemporary);
+        emitMinMax(generator, statement.kind == VectorStatement::Kind::MAX, accumulator, vector(generator, firstTemporary),
+                   vector(generator, firstTemporary + 1));
+        break;
+    }
+  }
+
+  // Computes the node in the target register, with the ones above it as temporaries
+  void emitNode(codegen::NasmGenerator_x86_64 &generator, const Node &node, uint8_t target) const {
+    auto reg = vector(generator, target);
+    switch (node.kind) {
+      case Node::Kind::LOAD:
+        generator.emitVectorMove(reg, elementOperand(generator, node.array, node.offset));
+        return;
+      case Node::Kind::BROADCAST:
+        generator.emitVectorMove(reg, vector(generator, node.broadcast));
+        return;
+      case Node::Kind::SELECT: {
+        // (mask & set) | (~mask & clear)
+        auto value = vector(generator, target + 1);
+        emitNode(generator, node.operands[0], target);
+        emitNode(generator, node.operands[1], target + 1);
+        generator.emitVectorOp(codegen::Opcode::PAND, value, reg);
+        generator.emitVectorOp(codegen::Opcode::PANDN, reg, emitOperand(generator, node.operands[2], target + 2));
+        generator.emitVectorOp(codegen::Opcode::POR, reg, value);
+        return;
+      }
+      default:
+        emitNode(generator, node.operands[0], target);
+        generator.emitVectorOp(opcode(node.kind), reg, emitOperand(generator, node.operands[1], target + 1));
+    }
+  }
+
+  // The node as the source operand of an operation: computed in the scratch register unless it can be read in place
+  codegen::MachineOperand emitOperand(codegen::NasmGenerator_x86_64 &generator, const Node &node, uint8_t scratch) const {
+    if (node.kind == Node::Kind::BROADCAST) return vector(generator, node.broadcast);
+    if (avx2 && node.kind == Node::Kind::LOAD) return elementOperand(generator, node.array, node.offset);
+    emitNode(generator, node, scratch);
+    return vector(generator, scratch);
+  }
+
+  codegen::Opcode opcode(Node::Kind kind) const {
+    bool bytes = elementType->byteSize == 1;
+    switch (kind) {
+      case Node::Kind::ADD: return bytes ? codegen::Opcode::PADDB : codegen::Opcode::PADDD;
+      case Node::Kind::SUBSTRACT: return bytes ? codegen::Opcode::PSUBB : codegen::Opcode::PSUBD;
+      case Node::Kind::MULTIPLY: return codegen::Opcode::PMULLD;
+      case Node::Kind::CMP_EQ: return bytes ? codegen::Opcode::PCMPEQB : codegen::Opcode::PCMPEQD;
+      case Node::Kind::CMP_GT: return bytes ? codegen::Opcode::PCMPGTB : codegen::Opcode::PCMPGTD;
+      case Node::Kind::AND: return codegen::Opcode::PAND;
+      case Node::Kind::OR: return codegen::Opcode::POR;
+      case Node::Kind::XOR: return codegen::Opcode::PXOR;
+      default: THROW("No vector opcode for node kind " << static_cast<int>(kind));
+    }
+  }
+
+  // accumulator = min or max of accumulator and value. pminsd, pmaxsd and the byte forms are SSE4.1: SSE2 blends with the
+  // mask of a comparison instead.
+  void emitMinMax(codegen::NasmGenerator_x86_64 &generator, bool max, codegen::VectorRegister accumulator,
+                  codegen::VectorRegister value, codegen::VectorRegister scratch) const {
+    bool bytes = elementType->byteSize == 1;
+    if (avx2) {
+      auto opcode = max ? (bytes ? codegen::Opcode::PMAXSB : codegen::Opcode::PMAXSD) : (bytes ? codegen::Opcode::PMINSB : codegen::Opcode::PMINSD);
+      generator.emitVectorOp(opcode, accumulator, value);
+      return;
+    }
+    // mask = the lanes to keep from the accumulator; accumulator = value ^ ((accumulator ^ value) & mask)
+    generator.emitVectorMove(scratch, max ? accumulator : value);
+    generator.emitVectorOp(bytes ? codegen::Opcode::PCMPGTB : codegen::Opcode::PCMPGTD, scratch, max ? value : accumulator);
+    generator.emitVectorOp(codegen::Opcode::PXOR, accumulator, value);
+    generator.emitVectorOp(codegen::Opcode::PAND, accumulator, scratch);
+    generator.emitVectorOp(codegen::Opcode::PXOR, accumulator, value);
+  }
+
+  // Folds the lanes of the accumulator into lane 0, then into the scalar
+  void emitReduction(codegen::NasmGenerator_x86_64 &generator, const VectorStatement &statement) const {
+    bool bytes = elementType->byteSize == 1;
+    bool max = statement.kind == VectorStatement::Kind::MAX;
+    codegen::VectorRegister accumulator{statement.accumulator}, scratch{firstTemporary}, mask{static_cast<uint8_t>(firstTemporary + 1)};
+    auto combine = [&]() {
+      if (statement.kind == VectorStatement::Kind::SUM) generator.emitVectorOp(codegen::Opcode::PADDD, accumulator, scratch);
+      else emitMinMax(generator, max, accumulator, scratch, mask);
+    };
+
+    if (avx2) {
+      auto opcode = statement.kind == VectorStatement::Kind::SUM ? codegen::Opcode::PADDD
+                    : max ? (bytes ? codegen::Opcode::PMAXSB : codegen::Opcode::PMAXSD)
+                          : (bytes ? codegen::Opcode::PMINSB : codegen::Opcode::PMINSD);
+      generator.emitVectorFoldHighHalf(opcode, vector(generator, statement.accumulator), vector(generator, firstTemporary));
+    }
+    for (uint8_t shift = 8; shift >= elementType->byteSize; shift /= 2) {
+      generator.emitVectorImmediateOp(codegen::Opcode::PSRLDQ, scratch, accumulator, shift);
+      combine();
+    }
+
+    auto laneGuard = generator.regSet().acquireGuard();
+    generator.emitVectorExtract(laneGuard.reg, accumulator, elementType->byteSize);
+    const auto &location = statement.scalar->getVariableDescription()->location;
+    if (statement.kind == VectorStatement::Kind::SUM) {
+      generator.emitBinaryOp(statement.subtract ? codegen::Opcode::SUB : codegen::Opcode::ADD, generator.locationOperand(location, 4),
+                             generator.int32(laneGuard.reg));
+      return;
+    }
+    auto scalarGuard = generator.regSet().acquireGuard(scopes::toMask(laneGuard.reg));
+    statement.scalar->loadValueInRegister(generator, scalarGuard.reg);
+    generator.emitCmp(generator.int32(scalarGuard.reg), generator.int32(laneGuard.reg));
+    generator.emitCmovCC(generator.int32(scalarGuard.reg), generator.int32(laneGuard.reg), max ? codegen::CMP_OPERATION::LT : codegen::CMP_OPERATION::GT);
+    generator.emitStoreInMemory(location, scopes::getProperRegisterFromID64(scalarGuard.reg, elementType->byteSize));
+  }
+
+  const scopes::VariableDescription *induction;
+  std::optional<int32_t> start;
+  std::optional<uint64_t> trips;
+  bool avx2;
+
+  const char *failure = nullptr;
+  const scopes::TypeDescription *elementType = nullptr;
+  uint32_t lanes = 0;
+  std::vector<Access> accesses;
+  std::vector<VectorStatement> statements;
+  std::vector<Broadcast> broadcasts;
+  std::map<const scopes::VariableDescription *, uint8_t> broadcastVariables;
+  std::map<int32_t, uint8_t> broadcastConstants;
+  std::set<const scopes::VariableDescription *> readScalars;
+  // Compared or tested: checked once the lanes are known
+  std::vector<const Expression *> narrowOperands;
+  bool multiplies = false;
+  uint8_t firstTemporary = 0;
+
+  // Set while emitting
+  std::optional<scopes::Register> index;
+  std::map<const scopes::VariableDescription *, scopes::Register> bases;
+};
+
+// The scalar loop takes over from the i left by the vector loop, its entry test is no longer known to pass
+inline bool ForStatement::genVectorized_x86_64(codegen::NasmGenerator_x86_64 &generator, const CountedLoop &loop, std::optional<uint64_t> trips) const {
+  bool avx2 = generator.codegenOptions().avx2;
+  // Checked on the whole body: the analysis stops at its first failure, maybe before meeting an element
+  LoopEffects effects;
+  body.collectLoopEffects(effects);
+  if (!effects.accessesArrays) return false;
+
+  LoopVectorizer vectorizer(loop.induction, loop.start, trips, avx2);
+  const char *reason = vectorizer.analyze(body);
+  if (loop.step != 1) reason = "steps by more than one";
+  auto decision = [&generator, &vectorizer](bool vectorized, const char *reason) {
+    generator.recordVectorization({std::string(generator.functionName()), vectorized, vectorizer.getLanes(), reason});
+  };
+  if (reason) {
+    decision(false, reason);
+    return false;
+  }
+
+  auto endLabel = generator.generateUniqueLabel("for.end");
+  init.genAsm_x86_64(generator);
+  for (const auto &declaration : preheader) {
+    declaration.genAsm_x86_64(generator);
+  }
+
+  bool vectorized;
+  {
+    auto pinGuard = generator.pinLiveRegisters(condition->getProgramRange());
+    vectorized = generator.regSet().availableCount() >= vectorizer.registerNeed(*loop.bound);
+    if (vectorized) vectorizer.emit(generator, *loop.bound, loop.op);
+  }
+  decision(vectorized, vectorized ? (avx2 ? "AVX2" : "SSE2") : "needs more general purpose registers than are free");
+
+  genRotatedLoop_x86_64(generator, endLabel, vectorized || !entryTestPasses());
+  generator.emitLabel(endLabel);
+  return true;
+}
+
+} // namespace ast
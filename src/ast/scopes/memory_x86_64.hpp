@@ -3,20 +3,25 @@
 #include <cstddef>
 #include <variant>
 #include <string>
+#include <string_view>
 #include <optional>
+#include <vector>
 
 #include "registers.hpp"
 
 namespace scopes
 {
 
+// Static storage: _byteOffset bytes after the symbol, addressed relative to rip. The symbol is local to the object file
+// even for an exported variable, so that shared libraries need no relocation for it (see ScopeStack::addGlobalVariable).
 struct GlobalStackOffset
 {
   byteSize_t _byteSize;
   byteSize_t _byteOffset;
+  std::string_view _symbol;
 
   inline friend std::ostream& operator<<(std::ostream& os, const GlobalStackOffset& gso) {
-    return os << "GlobalStackOffset: byteSize=" << gso._byteSize << ", byteOffset=" << gso._byteOffset;
+    return os << "GlobalStackOffset: byteSize=" << gso._byteSize << ", byteOffset=" << gso._byteOffset << ", symbol=" << gso._symbol;
   }
 };
 
@@ -30,18 +35,51 @@ struct LocalStackOffset
   }
 };
 
+// Argument passed beyond the sixth one: the index-th eightbyte above the return address, in the caller's frame
+struct IncomingStackOffset
+{
+  byteSize_t _byteSize;
+  uint32_t _index;
+
+  inline friend std::ostream& operator<<(std::ostream& os, const IncomingStackOffset& iso) {
+    return os << "IncomingStackOffset: byteSize=" << iso._byteSize << ", index=" << iso._index;
+  }
+};
+
 using LocationDescription = std::variant<
   Register,
   LocalStackOffset,
-  GlobalStackOffset
+  GlobalStackOffset,
+  IncomingStackOffset
 >;
 
+// Where the System V convention puts the index-th argument on entry
+inline LocationDescription incomingArgumentLocation(size_t index, byteSize_t byteSize)
+{
+  if (index < FUNCTION_ARGUMENT_REGISTERS.size()) return static_cast<Register>(FUNCTION_ARGUMENT_REGISTERS[index]);
+  return IncomingStackOffset{byteSize, static_cast<uint32_t>(index - FUNCTION_ARGUMENT_REGISTERS.size())};
+}
+
 struct VariableDescription
 {
   id_t variableId;
   std::string_view name;
   LocationDescription location;
   std::optional<const TypeDescription*> typeDescription;
+  // Objects of class type: one description per field, in the order of TypeDescription::fields. Fields are read and
+  // written in place, inside the frame slot of their object.
+  std::vector<VariableDescription> members = {};
+  bool isMember = false;
+  // Declared const: never assigned after its initialization
+  bool isReadOnly = false;
+
+  // Read and written by other functions: always accessed in memory
+  bool isGlobal() const { return std::holds_alternative<GlobalStackOffset>(location); }
+
+  // Objects, their fields, arrays and globals are never given a register
+  bool isRegisterCandidate() const {
+    return !isMember && !isGlobal() && !(*typeDescription)->isClass() && !(*typeDescription)->isArray();
+  }
 };
 
 struct FunctionDescription
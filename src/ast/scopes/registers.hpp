@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <string_view>
 #include <unordered_map>
@@ -193,6 +194,22 @@ constexpr std::array<GeneralPurposeRegister, 6> FUNCTION_ARGUMENT_REGISTERS = {
   GeneralPurposeRegister::REG_R9,
 };
 
+// System V: preserved across calls, a callee using them has to save them first
+constexpr std::array<GeneralPurposeRegister, 5> CALLEE_SAVED_REGISTERS = {
+  GeneralPurposeRegister::REG_R12,
+  GeneralPurposeRegister::REG_R13,
+  GeneralPurposeRegister::REG_R14,
+  GeneralPurposeRegister::REG_R15,
+  GeneralPurposeRegister::REG_RBX,
+};
+
+inline constexpr bool isCalleeSaved(GeneralPurposeRegister reg)
+{
+  for (auto calleeSaved: CALLEE_SAVED_REGISTERS)
+    if (calleeSaved == reg) return true;
+  return false;
+}
+
 #define X(reg, str)                                                            \
   static_assert(                                                               \
       static_cast<uint32_t>(Register::reg) ==                                  \
@@ -260,6 +277,24 @@ inline constexpr scopes::Register getProperRegisterFromID64(GeneralPurposeRegist
   }
 }  
 
+// Inverse of getProperRegisterFromID64 for the sized general purpose registers (al..r15b, ax..r15w, eax..r15d, rax..r15)
+inline constexpr GeneralPurposeRegister getGPRegisterID(Register reg)
+{
+  auto raw = static_cast<uint32_t>(reg);
+  if (raw >= 64) THROW("Register is not a sized general purpose register: " << raw);
+  return static_cast<GeneralPurposeRegister>(raw % 16);
+}
+
+inline constexpr byteSize_t getRegisterByteSize(Register reg)
+{
+  auto raw = static_cast<uint32_t>(reg);
+  if (raw < 16) return 8;
+  if (raw < 32) return 4;
+  if (raw < 48) return 2;
+  if (raw < 68) return 1;
+  THROW("Register is not a sized general purpose register: " << raw);
+}
+
 static_assert(static_cast<uint32_t>(Register::REG_RAX) == 0, "rax should be the first register");
 static_assert(getProperRegisterFromID64(GeneralPurposeRegister::REG_RAX, 8) == Register::REG_RAX, "rax should be the first register");
 static_assert(getProperRegisterFromID64(GeneralPurposeRegister::REG_RAX, 4) == Register::REG_EAX, "eax should be the first 32-bit register");
@@ -271,6 +306,8 @@ static_assert(getProperRegisterFromID64(GeneralPurposeRegister::REG_R15, 8) == R
 static_assert(getProperRegisterFromID64(GeneralPurposeRegister::REG_R15, 4) == Register::REG_R15D, "r15d should be the last 32-bit register");
 static_assert(getProperRegisterFromID64(GeneralPurposeRegister::REG_R15, 2) == Register::REG_R15W, "r15w should be the last 16-bit register");
 static_assert(getProperRegisterFromID64(GeneralPurposeRegister::REG_R15, 1, false) == Register::REG_R15B, "r15b should be the last 8-bit register");
+static_assert(getGPRegisterID(Register::REG_R13D) == GeneralPurposeRegister::REG_R13, "r13d should map back to r13");
+static_assert(getRegisterByteSize(Register::REG_SIL) == 1, "sil should be a single byte");
 
 // To change later proably?
 constexpr auto returnRegister = scopes::GeneralPurposeRegister::REG_RAX;
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
+#include <deque>
+#include <format>
 #include <limits>
 #include <vector>
 #include <map>
@@ -21,14 +24,17 @@ class Scope
 private:
 friend class ScopeStack;
 
-  void addLocalVariable(const std::string_view &name, const TypeDescription* type, id_t variableId)
+  // The slot of a local is only known once the frame is laid out (see layoutFrame)
+  void addVariable(const std::string_view &name, const TypeDescription* type, id_t variableId, LocationDescription location,
+                   std::vector<VariableDescription> &&members, bool readOnly)
   {
-    _stackOffset += type->byteSize;
     std::unique_ptr<VariableDescription> description = std::make_unique<VariableDescription>(VariableDescription{
       .variableId=variableId,
       .name=name,
-      .location=LocalStackOffset{type->byteSize, _stackOffset},
+      .location=location,
       .typeDescription=type,
+      .members=std::move(members),
+      .isReadOnly=readOnly,
     });
     _variables.emplace(description->name, std::move(description));
   }
@@ -49,7 +55,7 @@ friend class ScopeStack;
     _functions.emplace(description->name, std::move(description));
   }
 public:
-  Scope(scopeId_t scopeId, Scope *parent): _id{scopeId}, _parent{parent}, _stackOffset{0} {}
+  Scope(scopeId_t scopeId, Scope *parent): _id{scopeId}, _parent{parent} {}
 
   const TypeDescription* findType(std::string_view name)
   {
@@ -59,7 +65,7 @@ public:
     return _parent->findType(name);
   }
 
-  const VariableDescription* findVariable(std::string_view name)
+  VariableDescription* findVariable(std::string_view name)
   {
     auto variableDescription = _variables.find(name);
     if (variableDescription != _variables.end()) return variableDescription->second.get();
@@ -75,6 +81,39 @@ public:
     return _parent->findFunction(name);
   }
 
+  // Gives a frame slot to every variable of this scope left in memory, and returns the end of the frame. Sibling scopes
+  // are never alive at the same time: they all start where their parent ends and share the same slots.
+  byteSize_t layoutFrame(byteSize_t frameBase)
+  {
+    byteSize_t offset = frameBase;
+    for (auto &[name, description]: _variables)
+    {
+      auto *slot = std::get_if<LocalStackOffset>(&description->location);
+      if (!slot) continue;
+      byteSize_t alignment = (*description->typeDescription)->alignment;
+      offset += slot->_byteSize;
+      offset += (alignment - offset % alignment) % alignment; // natural alignment
+      slot->_byteOffset = offset;
+      placeMembers(*description, offset);
+    }
+
+    byteSize_t frameEnd = offset;
+    for (Scope *child: _children) frameEnd = std::max(frameEnd, child->layoutFrame(offset));
+    return frameEnd;
+  }
+
+  // The slot of an object starts at [rbp-N]: a field at offset off of the object is at [rbp-N+off]
+  static void placeMembers(VariableDescription &object, byteSize_t objectOffset)
+  {
+    const auto &fields = (*object.typeDescription)->fields;
+    for (size_t i = 0; i < object.members.size(); i++)
+    {
+      byteSize_t offset = objectOffset - fields[i].offset;
+      object.members[i].location = LocalStackOffset{fields[i].type->byteSize, offset};
+      placeMembers(object.members[i], offset);
+    }
+  }
+
   void logDebug()
   {
     std::stringstream ss;
@@ -102,7 +141,7 @@ public:
 private:
   scopeId_t _id;
   Scope *_parent; // TODO think about relacing this with a scope id
-  byteSize_t _stackOffset;
+  std::vector<Scope*> _children;
   std::map<std::string_view, const std::unique_ptr<TypeDescription>> _types;
   std::map<std::string_view, const std::unique_ptr<VariableDescription>> _variables; // TODO lvalues?
   std::map<std::string_view, const std::unique_ptr<FunctionDescription>> _functions;
@@ -116,6 +155,7 @@ public:
   , _types{generatePrimitiveTypeVector()}
   , _variableId{0}
   , _functionId{0}
+  , _classTypeId{IDX_FIRST_CLASS_TYPE}
   {
     _scopes.push_back(std::make_unique<Scope>(_scopes.size(), nullptr));
     Scope &rootScope = *_scopes.back();
@@ -137,13 +177,69 @@ public:
   Scope &createChildScope(Scope &parent)
   {
     _scopes.push_back(std::make_unique<Scope>(_scopes.size(), &parent));
+    parent._children.push_back(_scopes.back().get());
     return *_scopes.back();
   }
 
-  void addLocalVariable(const std::string_view &name, const TypeDescription* type, Scope &scope)
+  void addLocalVariable(const std::string_view &name, const TypeDescription* type, Scope &scope, bool readOnly = false)
+  {
+    id_t variableId = ++_variableId;
+    scope.addVariable(name, type, variableId, LocalStackOffset{type->byteSize, 0}, describeMembers(type, readOnly), readOnly);
+  }
+
+  // Code reads and writes a global through a local alias of its exported symbol: a shared library can then address it
+  // relative to rip, without going through the GOT (the definition can not be interposed)
+  void addGlobalVariable(const std::string_view &name, const TypeDescription* type, Scope &scope, bool readOnly)
+  {
+    USER_ASSERT(!scope._variables.contains(name), "Redefinition of global " << name);
+    id_t variableId = ++_variableId;
+    std::string_view symbol = _generatedNames.emplace_back(std::format("{}.local", name));
+    auto members = describeMembers(type, readOnly);
+    placeGlobalMembers(members, type, symbol, 0);
+    scope.addVariable(name, type, variableId, GlobalStackOffset{type->byteSize, 0, symbol}, std::move(members), readOnly);
+  }
+
+  // Class types are known to the scope they are declared in, with their layout already computed (see ast::layoutClass)
+  const TypeDescription *addClassType(std::string_view name, byteSize_t byteSize, byteSize_t alignment,
+                                      std::vector<FieldDescription> &&fields, Scope &scope)
+  {
+    USER_ASSERT(!scope._types.contains(name), "Redefinition of type " << name);
+    auto description = std::make_unique<TypeDescription>(TypeDescription{
+      .id=_classTypeId++,
+      .byteSize=byteSize,
+      .name=std::string(name),
+      .alignment=alignment,
+      .fields=std::move(fields),
+    });
+    const TypeDescription *type = description.get();
+    scope._types.emplace(type->name, std::move(description));
+    return type;
+  }
+
+  // Arrays of the same element type and count share their description. Elements are aligned as when they stand alone,
+  // the array is the first of them.
+  const TypeDescription *arrayType(const TypeDescription *elementType, byteSize_t elementCount)
+  {
+    auto &description = _arrayTypes[{elementType, elementCount}];
+    if (!description)
+    {
+      description = std::make_unique<TypeDescription>(TypeDescription{
+        .id=IDX_ARRAY_TYPE,
+        .byteSize=elementType->byteSize * elementCount,
+        .name=std::format("{}[{}]", elementType->name, elementCount),
+        .alignment=elementType->alignment,
+        .elementType=elementType,
+        .elementCount=elementCount,
+      });
+    }
+    return description.get();
+  }
+
+  // Variables introduced by AST rewrites: the names can not be spelled in a source file, and live as long as the
+  // descriptions and nodes keeping views on them
+  std::string_view generateVariableName(std::string_view prefix)
   {
-    _variableId++;
-    scope.addLocalVariable(name, type, _variableId);
+    return _generatedNames.emplace_back(std::format("{}.{}", prefix, _generatedNames.size()));
   }
 
   void addFunction(const std::string_view &name, const std::vector<const TypeDescription*> &parameters, const TypeDescription* returnType, Scope &scope)
@@ -152,11 +248,47 @@ public:
     scope.addFunction(name, parameters, returnType, _functionId);
   }
 
+private:
+  // Nested objects get their own members, down to the scalar fields. The fields of a const object are const.
+  std::vector<VariableDescription> describeMembers(const TypeDescription *type, bool readOnly)
+  {
+    std::vector<VariableDescription> members;
+    for (const auto &field: type->fields)
+    {
+      id_t variableId = ++_variableId;
+      members.push_back(VariableDescription{
+        .variableId=variableId,
+        .name=field.name,
+        .location=LocalStackOffset{field.type->byteSize, 0},
+        .typeDescription=field.type,
+        .members=describeMembers(field.type, readOnly),
+        .isMember=true,
+        .isReadOnly=readOnly,
+      });
+    }
+    return members;
+  }
+
+  // Fields of a global are addressed from its symbol, at their offset in the object
+  static void placeGlobalMembers(std::vector<VariableDescription> &members, const TypeDescription *type,
+                                 std::string_view symbol, byteSize_t objectOffset)
+  {
+    for (size_t i = 0; i < members.size(); i++)
+    {
+      byteSize_t offset = objectOffset + type->fields[i].offset;
+      members[i].location = GlobalStackOffset{type->fields[i].type->byteSize, offset, symbol};
+      placeGlobalMembers(members[i].members, type->fields[i].type, symbol, offset);
+    }
+  }
+
 private:
   std::vector<std::unique_ptr<Scope>> _scopes;
   std::vector<TypeDescription> _types;
   id_t _variableId;
   id_t _functionId;
+  id_t _classTypeId;
+  std::map<std::pair<const TypeDescription*, byteSize_t>, std::unique_ptr<TypeDescription>> _arrayTypes;
+  std::deque<std::string> _generatedNames;
 };
 
 } /* namespace scopes */
@@ -1,8 +1,9 @@
 #pragma once
 
 #include <cstdint>
-#include <vector>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace scopes
 {
@@ -10,11 +11,30 @@ namespace scopes
 using id_t = uint32_t;
 using byteSize_t = uint32_t;
 
+struct TypeDescription;
+
+// Offsets are from the start of the object (see ast::layoutClass)
+struct FieldDescription
+{
+  std::string_view name;
+  const TypeDescription *type;
+  byteSize_t offset;
+};
+
 struct TypeDescription
 {
   id_t id;
   byteSize_t byteSize;
   std::string name;
+  byteSize_t alignment;
+  // Classes only, in memory order
+  std::vector<FieldDescription> fields = {};
+  // Arrays only: elementCount elements of elementType, one after the other
+  const TypeDescription *elementType = nullptr;
+  byteSize_t elementCount = 0;
+
+  bool isClass() const;
+  bool isArray() const;
 };
 
 enum PrimitiveTypeIndex
@@ -22,11 +42,37 @@ enum PrimitiveTypeIndex
   IDX_VOID_TYPE,
   IDX_CHAR_TYPE,
   IDX_INT_TYPE,
+  IDX_POINTER_TYPE,
+  // Every array type, whatever its elements (see ScopeStack::arrayType)
+  IDX_ARRAY_TYPE,
+  // Class types are numbered from here, in declaration order (see ScopeStack::addClassType)
+  IDX_FIRST_CLASS_TYPE,
 };
 
-const static TypeDescription VOID_TYPE = TypeDescription{ IDX_VOID_TYPE, 0, "void" };
-const static TypeDescription CHAR_TYPE = TypeDescription{ IDX_CHAR_TYPE, 1, "char" };
-const static TypeDescription INT_TYPE = TypeDescription{ IDX_INT_TYPE, 4, "int" };
+inline bool TypeDescription::isClass() const { return id >= IDX_FIRST_CLASS_TYPE; }
+
+inline bool TypeDescription::isArray() const { return id == IDX_ARRAY_TYPE; }
+
+const static TypeDescription VOID_TYPE = TypeDescription{ IDX_VOID_TYPE, 0, "void", 1 };
+const static TypeDescription CHAR_TYPE = TypeDescription{ IDX_CHAR_TYPE, 1, "char", 1 };
+const static TypeDescription INT_TYPE = TypeDescription{ IDX_INT_TYPE, 4, "int", 4 };
+// Every pointer type: an address held whole, nothing dereferences it yet
+const static TypeDescription POINTER_TYPE = TypeDescription{ IDX_POINTER_TYPE, 8, "pointer", 8 };
+
+// Integer promotion: arithmetic never happens on anything narrower than int
+inline const TypeDescription *promote(const TypeDescription *type)
+{
+  if (type->id == IDX_CHAR_TYPE) return &INT_TYPE;
+  return type;
+}
+
+// Usual arithmetic conversions between two integer operands
+inline const TypeDescription *commonType(const TypeDescription *lhs, const TypeDescription *rhs)
+{
+  lhs = promote(lhs);
+  rhs = promote(rhs);
+  return lhs->byteSize >= rhs->byteSize ? lhs : rhs;
+}
 
 inline std::vector<TypeDescription> generatePrimitiveTypeVector()
 {
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "ast/literalTypes.hpp"
+#include "dbg/logger.hpp"
+
+namespace ast
+{
+
+// Sizes are counted in AST nodes of the callee body (see summarize). Every clone is a full copy of the body: functions
+// stay externally visible, so the original is kept next to its clones.
+static constexpr uint32_t SPECIALIZE_MAX_SIZE = 64;
+static constexpr size_t SPECIALIZE_MAX_CLONES = 4;
+
+// What a clone does with the argument of one parameter
+struct ParameterBinding {
+  enum class Kind : uint8_t {
+    KEEP,
+    // Read as the literal every redirected call site passes
+    CONSTANT,
+    // Never read by the body: the side-effect-free argument is not evaluated anymore
+    DROP,
+  };
+
+  Kind kind = Kind::KEEP;
+  NumberLiteralUnderlyingType value = 0;
+
+  bool operator==(const ParameterBinding &) const = default;
+  auto operator<=>(const ParameterBinding &) const = default;
+};
+
+struct SpecializationDecision {
+  std::string_view caller;
+  std::string_view callee;
+  std::string_view clone;
+  const char *reason;
+};
+
+struct SpecializationReport {
+  std::vector<SpecializationDecision> decisions;
+
+  void logDebug() const {
+    for (const auto &decision : decisions) {
+      LOG_DEBUG("[Specializer] " << decision.caller << " <- " << decision.callee << " ; "
+                << (decision.clone.empty() ? std::string_view("kept") : decision.clone) << " (" << decision.reason << ")");
+    }
+  }
+};
+
+} // namespace ast
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <bitset>
 #include <optional>
 
@@ -9,30 +11,130 @@
 namespace scopes
 {
 
+static constexpr size_t GP_REGISTER_COUNT = static_cast<size_t>(GeneralPurposeRegister::_COUNT);
+using RegisterMask = std::bitset<GP_REGISTER_COUNT>;
+
+inline RegisterMask toMask(GeneralPurposeRegister reg) {
+  return RegisterMask().set(static_cast<size_t>(reg));
+}
+
 class GPRegisterSet {
 public:
+  // Saves a register somewhere while it is borrowed, and restores it afterwards
+  struct SpillHandler {
+    virtual void spill(GeneralPurposeRegister reg) = 0;
+    virtual void reload(GeneralPurposeRegister reg) = 0;
+    virtual ~SpillHandler() = default;
+  };
+
   struct RegisterGuard {
     RegisterGuard(const RegisterGuard &) = delete;
-    RegisterGuard(RegisterGuard &&other): set(other.set), reg(other.reg) { other.set = nullptr; }
-    RegisterGuard(GPRegisterSet *set, GeneralPurposeRegister reg): set(set), reg(reg) {}
-    ~RegisterGuard() { if (set) set->release(reg); }
+    RegisterGuard(RegisterGuard &&other): set(other.set), reg(other.reg), spilled(other.spilled), fromVariable(other.fromVariable) {
+      other.set = nullptr;
+    }
+    RegisterGuard(GPRegisterSet *set, GeneralPurposeRegister reg, bool spilled = false, bool fromVariable = false)
+        : set(set), reg(reg), spilled(spilled), fromVariable(fromVariable) {}
+    ~RegisterGuard() {
+      if (!set) return;
+      if (spilled) set->spillHandler->reload(reg);
+      if (!spilled || fromVariable) set->release(reg);
+    }
 
     GPRegisterSet *set;
     GeneralPurposeRegister reg;
+    // Borrowed from its owner: given back instead of being released
+    bool spilled;
+    // The owner is a pinned variable, not a temporary: the register is free again once its value is given back
+    bool fromVariable;
   };
 
-  static constexpr size_t GP_REGISTER_COUNT = static_cast<size_t>(GeneralPurposeRegister::_COUNT);
+  // Registers owned by live variables: not handed out as temporaries while pinned
+  struct PinGuard {
+    PinGuard(const PinGuard &) = delete;
+    PinGuard(PinGuard &&other): set(other.set), previous(other.previous), previousReferenced(other.previousReferenced) { other.set = nullptr; }
+    PinGuard(GPRegisterSet *set, RegisterMask previous, RegisterMask previousReferenced)
+        : set(set), previous(previous), previousReferenced(previousReferenced) {}
+    ~PinGuard() {
+      if (!set) return;
+      set->pinnedRegisters = previous;
+      set->referencedRegisters = previousReferenced;
+    }
+
+    GPRegisterSet *set;
+    RegisterMask previous;
+    RegisterMask previousReferenced;
+  };
 
 public:
-  std::optional<RegisterGuard> acquireGuard() {
-    auto reg = acquire();
-    if (!reg) return std::nullopt;
+  // Spills a temporary owned by an enclosing expression when every register is busy. The excluded registers are never
+  // borrowed: the caller still has to write them while the guard lives.
+  RegisterGuard acquireGuard(RegisterMask exclude = {}) {
+    if (auto reg = acquire(exclude)) return RegisterGuard(this, *reg);
 
-    return RegisterGuard(this, *reg);
+    DEBUG_ASSERT(spillHandler, "Out of registers and no spill handler is set");
+    for (GeneralPurposeRegister reg : TEMPORARY_ORDER) {
+      size_t idx = static_cast<size_t>(reg);
+      if (!takenRegisters.test(idx) || exclude.test(idx)) continue;
+      spillHandler->spill(reg);
+      return RegisterGuard(this, reg, true);
+    }
+    // Last resort, a pinned variable that the code being generated neither reads nor writes: it gets its value back
+    // when the guard ends
+    for (GeneralPurposeRegister reg : TEMPORARY_ORDER) {
+      size_t idx = static_cast<size_t>(reg);
+      if (!pinnedRegisters.test(idx) || referencedRegisters.test(idx) || takenRegisters.test(idx) || exclude.test(idx)) continue;
+      spillHandler->spill(reg);
+      takenRegisters.set(idx);
+      everAcquiredRegisters.set(idx);
+      return RegisterGuard(this, reg, true, true);
+    }
+    THROW("Not enough registers, every temporary and variable is excluded from spilling");
   };
 
+  // Fixed register constraints (argument and return registers)
+  RegisterGuard acquireGuard(GeneralPurposeRegister reg) {
+    size_t idx = static_cast<size_t>(reg);
+    DEBUG_ASSERT(!takenRegisters.test(idx), "Tried to acquire general purpose register that is already taken register=" << regToStr(reg));
+    takenRegisters.set(idx);
+    everAcquiredRegisters.set(idx);
+    return RegisterGuard(this, reg);
+  }
+
+  // Fixed register constraints inside an expression: a temporary of an enclosing expression is spilled meanwhile
+  RegisterGuard borrowGuard(GeneralPurposeRegister reg) {
+    if (!takenRegisters.test(static_cast<size_t>(reg))) return acquireGuard(reg);
+    DEBUG_ASSERT(spillHandler, "Register " << regToStr(reg) << " is taken and no spill handler is set");
+    spillHandler->spill(reg);
+    return RegisterGuard(this, reg, true);
+  }
+
+  // referenced: the pinned registers whose variable is read or written meanwhile, never borrowed
+  PinGuard pinGuard(RegisterMask registers, RegisterMask referenced = {}) {
+    PinGuard guard(this, pinnedRegisters, referencedRegisters);
+    pinnedRegisters |= registers;
+    referencedRegisters |= referenced;
+    return guard;
+  }
+
+  void setSpillHandler(SpillHandler *handler) { spillHandler = handler; }
+
+  // Neither a temporary nor holding a live variable
+  bool isAvailable(GeneralPurposeRegister reg) const {
+    size_t idx = static_cast<size_t>(reg);
+    return !takenRegisters.test(idx) && !pinnedRegisters.test(idx);
+  }
+
+  // Registers acquireGuard can hand out without spilling
+  size_t availableCount() const {
+    return static_cast<size_t>(std::ranges::count_if(TEMPORARY_ORDER, [this](GeneralPurposeRegister reg) { return isAvailable(reg); }));
+  }
+
   const std::bitset<GP_REGISTER_COUNT> &asBistet() const { return takenRegisters; }
 
+  // Every register handed out since the last reset
+  const RegisterMask &usedRegisters() const { return everAcquiredRegisters; }
+  void resetUsedRegisters() { everAcquiredRegisters.reset(); }
+
 protected:
   void release(GeneralPurposeRegister reg) {
     size_t idx = static_cast<size_t>(reg);
@@ -40,18 +142,35 @@ protected:
     takenRegisters.reset(idx);
   }
 
-  std::optional<GeneralPurposeRegister> acquire() {
-    for (size_t i = 0; i < takenRegisters.size(); ++i) {
-      if (!takenRegisters.test(i)) {
+  std::optional<GeneralPurposeRegister> acquire(RegisterMask exclude) {
+    for (GeneralPurposeRegister reg : TEMPORARY_ORDER) {
+      size_t i = static_cast<size_t>(reg);
+      if (!takenRegisters.test(i) && !pinnedRegisters.test(i) && !exclude.test(i)) {
         takenRegisters.set(i);
-        return static_cast<GeneralPurposeRegister>(i);
+        everAcquiredRegisters.set(i);
+        return reg;
       }
     }
     return std::nullopt;
   };
 
+private:
+  // Scratch registers first, callee-saved ones cost a push/pop in the prologue. rbp and rsp hold the frame.
+  static constexpr std::array<GeneralPurposeRegister, GP_REGISTER_COUNT - 2> TEMPORARY_ORDER = {
+    GeneralPurposeRegister::REG_RAX, GeneralPurposeRegister::REG_RCX, GeneralPurposeRegister::REG_RDX,
+    GeneralPurposeRegister::REG_RSI, GeneralPurposeRegister::REG_RDI, GeneralPurposeRegister::REG_R8,
+    GeneralPurposeRegister::REG_R9, GeneralPurposeRegister::REG_R10, GeneralPurposeRegister::REG_R11,
+    GeneralPurposeRegister::REG_RBX, GeneralPurposeRegister::REG_R12, GeneralPurposeRegister::REG_R13,
+    GeneralPurposeRegister::REG_R14, GeneralPurposeRegister::REG_R15,
+  };
+
 private:
   std::bitset<GP_REGISTER_COUNT> takenRegisters;
+  RegisterMask pinnedRegisters;
+  // Pinned registers read or written by the code being generated (see pinGuard)
+  RegisterMask referencedRegisters;
+  RegisterMask everAcquiredRegisters;
+  SpillHandler *spillHandler = nullptr;
 };
 
 
@@ -0,0 +1,258 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "ast/scopes/registers.hpp"
+#include "dbg/errors.hpp"
+
+namespace codegen
+{
+
+enum class CMP_OPERATION: char {
+  EQ='=',
+  NEQ='~',
+  LEQ='l',
+  GEQ='g',
+  LT='<',
+  GT='>',
+  // Unsigned, only produced by the code generator (bounds checks)
+  ABOVE='a',
+  BELOW_EQ='b',
+};
+
+static const std::map<CMP_OPERATION, const char*> opToMnemonicCC = {
+  {CMP_OPERATION::EQ, "e"},
+  {CMP_OPERATION::NEQ, "ne"},
+  {CMP_OPERATION::LEQ, "le"},
+  {CMP_OPERATION::GEQ, "ge"},
+  {CMP_OPERATION::LT, "l"},
+  {CMP_OPERATION::GT, "g"},
+  {CMP_OPERATION::ABOVE, "a"},
+  {CMP_OPERATION::BELOW_EQ, "be"},
+};
+
+// Condition holding exactly when op does not
+constexpr CMP_OPERATION invertCondition(CMP_OPERATION op) {
+  switch (op) {
+    case CMP_OPERATION::EQ: return CMP_OPERATION::NEQ;
+    case CMP_OPERATION::NEQ: return CMP_OPERATION::EQ;
+    case CMP_OPERATION::LEQ: return CMP_OPERATION::GT;
+    case CMP_OPERATION::GEQ: return CMP_OPERATION::LT;
+    case CMP_OPERATION::LT: return CMP_OPERATION::GEQ;
+    case CMP_OPERATION::GT: return CMP_OPERATION::LEQ;
+    case CMP_OPERATION::ABOVE: return CMP_OPERATION::BELOW_EQ;
+    case CMP_OPERATION::BELOW_EQ: return CMP_OPERATION::ABOVE;
+  }
+  return op;
+}
+
+// Outcome of `lhs op rhs` on constants
+constexpr bool evaluateCondition(CMP_OPERATION op, int64_t lhs, int64_t rhs) {
+  switch (op) {
+    case CMP_OPERATION::EQ: return lhs == rhs;
+    case CMP_OPERATION::NEQ: return lhs != rhs;
+    case CMP_OPERATION::LEQ: return lhs <= rhs;
+    case CMP_OPERATION::GEQ: return lhs >= rhs;
+    case CMP_OPERATION::LT: return lhs < rhs;
+    case CMP_OPERATION::GT: return lhs > rhs;
+    case CMP_OPERATION::ABOVE: return static_cast<uint64_t>(lhs) > static_cast<uint64_t>(rhs);
+    case CMP_OPERATION::BELOW_EQ: return static_cast<uint64_t>(lhs) <= static_cast<uint64_t>(rhs);
+  }
+  return false;
+}
+
+enum class Opcode : uint8_t {
+  LABEL,
+  RAW, // Text copied as is (user asm, comments): nothing is known about it
+  MOV,
+  MOVZX,
+  MOVSX,
+  MOVSXD,
+  XCHG,
+  LEA,
+  XOR,
+  ADD,
+  SUB,
+  IMUL,
+  IDIV,
+  CDQ,
+  SHL,
+  SAR,
+  SHR,
+  CMP,
+  TEST,
+  SETCC,
+  CMOVCC,
+  JMP,
+  JCC,
+  PUSH,
+  POP,
+  CALL,
+  RET,
+  TAIL_CALL, // jmp to a function, once the epilogue is known (see NasmGenerator_x86_64::expandTailCalls)
+  // Vector instructions (see NasmGenerator_x86_64::emitVectorOp). The broadcasts and extracti128 are AVX2 only.
+  MOVD,
+  MOVDQA,
+  MOVDQU,
+  PSHUFD,
+  PSHUFLW,
+  PUNPCKLBW,
+  PSRLDQ,
+  PBROADCASTB,
+  PBROADCASTD,
+  EXTRACTI128,
+  PADDB,
+  PADDD,
+  PSUBB,
+  PSUBD,
+  PMULLD,
+  PCMPEQB,
+  PCMPEQD,
+  PCMPGTB,
+  PCMPGTD,
+  PMINSB,
+  PMINSD,
+  PMAXSB,
+  PMAXSD,
+  PAND,
+  PANDN,
+  POR,
+  PXOR,
+  VZEROUPPER,
+};
+
+static constexpr std::array<const char *, 56> opcodeMnemonics = {
+  "", "", "mov", "movzx", "movsx", "movsxd", "xchg", "lea", "xor", "add", "sub", "imul", "idiv", "cdq", "shl", "sar", "shr", "cmp", "test",
+  "set", "cmov", "jmp", "j", "push", "pop", "call", "ret", "jmp",
+  "movd", "movdqa", "movdqu", "pshufd", "pshuflw", "punpcklbw", "psrldq", "pbroadcastb", "pbroadcastd", "extracti128",
+  "paddb", "paddd", "psubb", "psubd", "pmulld", "pcmpeqb", "pcmpeqd", "pcmpgtb", "pcmpgtd", "pminsb", "pminsd", "pmaxsb",
+  "pmaxsd", "pand", "pandn", "por", "pxor", "vzeroupper",
+};
+
+struct Immediate {
+  int64_t value;
+  bool operator==(const Immediate &) const = default;
+};
+
+// [base+index*scale+displacement], or [rel symbol+displacement] when based on rip
+struct MemoryOperand {
+  scopes::Register base;
+  int64_t displacement = 0;
+  std::optional<scopes::Register> index = std::nullopt;
+  uint8_t scale = 1;
+  // Only needed when no register operand gives the access size (movsx/movzx)
+  uint8_t byteSize = 0;
+  std::string symbol = {};
+  bool operator==(const MemoryOperand &) const = default;
+};
+
+static constexpr std::array<const char *, 9> memorySizeSpecifiers = {
+  "", "byte ", "word ", "", "dword ", "", "", "", "qword ",
+};
+
+struct LabelRef {
+  std::string name;
+  bool operator==(const LabelRef &) const = default;
+};
+
+// xmm<index>, or ymm<index> when 32 bytes wide
+struct VectorRegister {
+  uint8_t index;
+  uint8_t byteSize = 16;
+  bool operator==(const VectorRegister &) const = default;
+};
+
+using MachineOperand = std::variant<std::monostate, scopes::Register, Immediate, MemoryOperand, LabelRef, VectorRegister>;
+
+struct MachineInstruction {
+  Opcode opcode;
+  std::array<MachineOperand, 3> operands = {};
+  // setcc/cmovcc/jcc only
+  CMP_OPERATION condition = CMP_OPERATION::EQ;
+  // Label name, or the text of a RAW instruction
+  std::string text = {};
+  const char *comment = nullptr;
+  // VEX encoding (AVX): v-prefixed mnemonic, the destination is followed by both sources
+  bool vex = false;
+
+  bool isMove() const { return opcode == Opcode::MOV; }
+
+  template <typename T>
+  const T *operand(size_t i) const { return std::get_if<T>(&operands[i]); }
+
+  // Writes the flags without reading them
+  bool writesFlags() const {
+    switch (opcode) {
+      case Opcode::XOR: case Opcode::ADD: case Opcode::SUB: case Opcode::CMP: case Opcode::TEST:
+      case Opcode::IMUL: case Opcode::IDIV: case Opcode::SHL: case Opcode::SAR: case Opcode::SHR:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  bool readsFlags() const { return opcode == Opcode::SETCC || opcode == Opcode::CMOVCC || opcode == Opcode::JCC; }
+
+  void print(std::ostream &os) const {
+    if (opcode == Opcode::LABEL) {
+      os << text << ":" << '\n';
+      return;
+    }
+    if (opcode == Opcode::RAW) {
+      os << text << '\n';
+      return;
+    }
+
+    os << '\t' << (vex ? "v" : "") << opcodeMnemonics[static_cast<size_t>(opcode)];
+    if (readsFlags()) os << opToMnemonicCC.at(condition);
+
+    const char *separator = " ";
+    for (const auto &operand : operands) {
+      if (std::holds_alternative<std::monostate>(operand)) break;
+      os << separator;
+      printOperand(os, operand);
+      separator = ", ";
+    }
+    if (comment) os << " ; " << comment;
+    os << '\n';
+  }
+
+private:
+  static void printOperand(std::ostream &os, const MachineOperand &operand) {
+    std::visit([&os](auto &&arg) {
+      using T = std::decay_t<decltype(arg)>;
+      if constexpr (std::is_same_v<T, scopes::Register>) {
+        os << scopes::regToStr(arg);
+      }
+      else if constexpr (std::is_same_v<T, Immediate>) {
+        os << arg.value;
+      }
+      else if constexpr (std::is_same_v<T, MemoryOperand>) {
+        os << memorySizeSpecifiers[arg.byteSize] << "[";
+        if (arg.base == scopes::Register::REG_RIP) os << "rel " << arg.symbol;
+        else os << scopes::regToStr(arg.base);
+        if (arg.index) os << "+" << scopes::regToStr(*arg.index) << "*" << static_cast<int>(arg.scale);
+        if (arg.displacement > 0) os << "+" << arg.displacement;
+        else if (arg.displacement < 0) os << "-" << -arg.displacement;
+        os << "]";
+      }
+      else if constexpr (std::is_same_v<T, LabelRef>) {
+        os << arg.name;
+      }
+      else if constexpr (std::is_same_v<T, VectorRegister>) {
+        os << (arg.byteSize == 32 ? "ymm" : "xmm") << static_cast<int>(arg.index);
+      }
+    }, operand);
+  }
+};
+
+using MachineInstructionList = std::vector<MachineInstruction>;
+
+} // namespace codegen
@@ -0,0 +1,256 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <span>
+#include <sstream>
+#include <vector>
+
+#include "ast/scopes/memory_x86_64.hpp"
+#include "ast/scopes/registers.hpp"
+#include "codegen/GPRegisterSet.hpp"
+#include "codegen/liveness.hpp"
+#include "dbg/logger.hpp"
+
+namespace codegen
+{
+
+using GPR = scopes::GeneralPurposeRegister;
+
+// rbp and rsp hold the frame, the 14 others can hold variables
+// caller-saved: free in leaf code, but saved around every call they are live across
+constexpr std::array<GPR, 9> CALLER_SAVED_ALLOCATABLE_REGISTERS = {
+  GPR::REG_R10, GPR::REG_R11, GPR::REG_RSI, GPR::REG_RDI, GPR::REG_R8, GPR::REG_R9,
+  GPR::REG_RDX, GPR::REG_RCX, GPR::REG_RAX,
+};
+
+// callee-saved: survive calls, saved once by the prologue
+constexpr std::array<GPR, 5> CALLEE_SAVED_ALLOCATABLE_REGISTERS = {
+  GPR::REG_R12, GPR::REG_R13, GPR::REG_R14, GPR::REG_R15, GPR::REG_RBX,
+};
+
+constexpr size_t ALLOCATABLE_REGISTER_COUNT = CALLER_SAVED_ALLOCATABLE_REGISTERS.size() + CALLEE_SAVED_ALLOCATABLE_REGISTERS.size();
+
+inline scopes::RegisterMask allocatableRegisters() {
+  scopes::RegisterMask mask;
+  for (GPR reg: CALLER_SAVED_ALLOCATABLE_REGISTERS) mask |= scopes::toMask(reg);
+  for (GPR reg: CALLEE_SAVED_ALLOCATABLE_REGISTERS) mask |= scopes::toMask(reg);
+  return mask;
+}
+
+struct FunctionAllocation
+{
+  std::vector<LiveInterval> intervals;
+  scopes::RegisterMask usedCalleeSaved;
+  // No calls: the red zone is usable and the stack needs no alignment
+  bool isLeaf = true;
+  // Stack space of the variables left in memory (see Scope::layoutFrame), reserved once by the prologue
+  scopes::byteSize_t frameSize = 0;
+  // Parameters, moved after the prologue from where the caller left them when they live elsewhere
+  std::vector<IncomingArgument> arguments;
+
+  bool movesArguments() const
+  {
+    return std::ranges::any_of(arguments, [](const IncomingArgument &argument) { return !isIncomingLocation(argument); });
+  }
+
+  // Parameters read in place: in their argument register, or never read at all
+  static bool isIncomingLocation(const IncomingArgument &argument)
+  {
+    const auto *incoming = std::get_if<scopes::Register>(&argument.incoming);
+    const auto *location = std::get_if<scopes::Register>(&argument.variable->location);
+    if (incoming) return location && scopes::getGPRegisterID(*location) == scopes::getGPRegisterID(*incoming);
+    return std::holds_alternative<scopes::IncomingStackOffset>(argument.variable->location);
+  }
+
+  // Registers that can not be used as temporaries while evaluating this range
+  scopes::RegisterMask registersLiveIn(const ProgramRange &range) const
+  {
+    scopes::RegisterMask live;
+    for (const auto &interval: intervals)
+    {
+      if (interval.reg && interval.range.overlaps(range)) live |= scopes::toMask(*interval.reg);
+    }
+    return live;
+  }
+
+  // Registers of the variables read or written in this range
+  scopes::RegisterMask registersReferencedIn(const ProgramRange &range) const
+  {
+    scopes::RegisterMask referenced;
+    for (const auto &interval: intervals)
+    {
+      auto inRange = [&range](programPoint_t point) { return range.begin <= point && point <= range.end; };
+      if (interval.reg && std::ranges::any_of(interval.references, inRange)) referenced |= scopes::toMask(*interval.reg);
+    }
+    return referenced;
+  }
+
+  // Caller-saved registers holding a variable that is still needed after this call
+  scopes::RegisterMask callerSavedLiveAcross(programPoint_t call) const
+  {
+    scopes::RegisterMask live;
+    for (const auto &interval: intervals)
+    {
+      if (interval.reg && !scopes::isCalleeSaved(*interval.reg) && interval.range.strictlyContains(call)) live |= scopes::toMask(*interval.reg);
+    }
+    return live;
+  }
+
+  // True when no other variable lives in this register during the range
+  bool isExclusiveIn(GPR reg, const ProgramRange &range, const scopes::VariableDescription *variable) const
+  {
+    for (const auto &interval: intervals)
+    {
+      if (interval.variable != variable && interval.reg == reg && interval.range.overlaps(range)) return false;
+    }
+    return true;
+  }
+
+  void logDebug() const
+  {
+    std::stringstream ss;
+    ss << "[Allocation] intervals=" << intervals.size();
+    for (const auto &interval: intervals)
+    {
+      ss << "\n  [Interval] variable=" << interval.variable->name << " ; range=[" << interval.range.begin << ", " << interval.range.end << "] ; location=";
+      std::visit([&ss](auto &&arg) { ss << arg; }, interval.variable->location);
+    }
+    LOG_DEBUG(ss.str());
+  }
+};
+
+// Poletto & Sarkar linear scan over the live intervals of one function
+class LinearScanAllocator
+{
+public:
+  // Keep some registers out of reach of the variables so expressions always find temporaries: at least as many as the
+  // most demanding expression of the function needs, a spill only ever borrows a temporary of an enclosing expression
+  static constexpr size_t TEMPORARY_RESERVE = 2;
+
+public:
+  LinearScanAllocator(const LivenessBuilder &liveness)
+  : _liveness(liveness),
+    _maxActive(ALLOCATABLE_REGISTER_COUNT - std::clamp<size_t>(liveness.temporaryNeed(), TEMPORARY_RESERVE, ALLOCATABLE_REGISTER_COUNT))
+  {
+  }
+
+  FunctionAllocation run()
+  {
+    FunctionAllocation allocation;
+    allocation.intervals = _liveness.buildIntervals();
+    allocation.isLeaf = _liveness.calls().empty();
+    allocation.arguments = _liveness.parameters();
+    for (const auto &interval: allocation.intervals)
+    {
+      if (interval.incomingRegister) _parameterRegisters |= scopes::toMask(*interval.incomingRegister);
+    }
+
+    std::vector<LiveInterval*> active;
+    for (auto &current: allocation.intervals)
+    {
+      std::erase_if(active, [&current](const LiveInterval *interval) { return interval->range.end < current.range.begin; });
+
+      scopes::RegisterMask used;
+      for (auto *interval: active) used |= scopes::toMask(*interval->reg);
+
+      if (auto reg = pickRegister(allocation, current, used); reg && active.size() < _maxActive)
+      {
+        current.reg = reg;
+        active.push_back(&current);
+        continue;
+      }
+
+      // Under pressure: spill whichever interval ends last
+      LiveInterval **victim = nullptr;
+      for (auto &candidate: active)
+      {
+        if (candidate->range.end <= current.range.end || !isCompatible(*candidate->reg, current)) continue;
+        if (!victim || candidate->range.end > (*victim)->range.end) victim = &candidate;
+      }
+
+      if (victim)
+      {
+        current.reg = (*victim)->reg;
+        (*victim)->reg = std::nullopt;
+        *victim = &current;
+      }
+    }
+
+    for (auto &interval: allocation.intervals)
+    {
+      if (!interval.reg) continue;
+      interval.variable->location = static_cast<scopes::Register>(*interval.reg);
+      if (scopes::isCalleeSaved(*interval.reg)) allocation.usedCalleeSaved |= scopes::toMask(*interval.reg);
+    }
+
+    // Parameters the body never reads stay where they are: no move, no frame slot
+    for (const auto &argument: allocation.arguments)
+    {
+      bool read = std::ranges::any_of(allocation.intervals, [&argument](const LiveInterval &interval) { return interval.variable == argument.variable; });
+      if (!read) argument.variable->location = argument.incoming;
+    }
+
+    return allocation;
+  }
+
+private:
+  std::optional<GPR> pickRegister(const FunctionAllocation &allocation, const LiveInterval &current, const scopes::RegisterMask &used) const
+  {
+    // A parameter never takes the argument register of another one, which may not be moved out yet: the moves done on
+    // entry can then run in any order
+    scopes::RegisterMask unavailable = used;
+    if (current.isParameter) unavailable |= _parameterRegisters;
+    if (current.incomingRegister) unavailable.reset(static_cast<size_t>(*current.incomingRegister));
+    auto isFree = [&](GPR reg) { return !unavailable.test(static_cast<size_t>(reg)) && isCompatible(reg, current); };
+
+    // Kept in the register it arrives in, unless that one is overwritten while the value is still needed
+    if (current.incomingRegister && isFree(*current.incomingRegister)) return current.incomingRegister;
+
+    if (current.copyHint)
+    {
+      for (const auto &interval: allocation.intervals)
+      {
+        if (interval.variable == current.copyHint && interval.reg && interval.range.end < current.range.begin && isFree(*interval.reg))
+          return interval.reg;
+      }
+    }
+
+    // Across calls a callee-saved register costs one push/pop per function instead of one per call
+    std::span<const GPR> preferred = CALLER_SAVED_ALLOCATABLE_REGISTERS;
+    std::span<const GPR> fallback = CALLEE_SAVED_ALLOCATABLE_REGISTERS;
+    if (crossesCall(current)) std::swap(preferred, fallback);
+    for (GPR reg: preferred)
+    {
+      if (isFree(reg)) return reg;
+    }
+    for (GPR reg: fallback)
+    {
+      if (isFree(reg)) return reg;
+    }
+    return std::nullopt;
+  }
+
+  bool crossesCall(const LiveInterval &interval) const
+  {
+    return std::ranges::any_of(_liveness.calls(), [&interval](programPoint_t call) { return interval.range.strictlyContains(call); });
+  }
+
+  bool isCompatible(GPR reg, const LiveInterval &interval) const
+  {
+    for (const auto &clobber: _liveness.clobbers())
+    {
+      if (clobber.registers.test(static_cast<size_t>(reg)) && interval.range.strictlyContains(clobber.point)) return false;
+    }
+    return true;
+  }
+
+private:
+  const LivenessBuilder &_liveness;
+  // Variables live at the same time in registers
+  size_t _maxActive;
+  // Argument registers holding a parameter the body reads
+  scopes::RegisterMask _parameterRegisters;
+};
+
+} /* namespace codegen */
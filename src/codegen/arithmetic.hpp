@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+
+namespace codegen
+{
+
+constexpr bool isPowerOfTwo(uint64_t value) { return value && !(value & (value - 1)); }
+
+constexpr uint32_t log2(uint64_t value) {
+  uint32_t result = 0;
+  while (value >>= 1) result++;
+  return result;
+}
+
+// Constants folded into multiply/divide sequences, wider ones are loaded in a register
+constexpr std::optional<int32_t> asInt32Constant(uint64_t value) {
+  if (value > static_cast<uint64_t>(std::numeric_limits<int32_t>::max())) return std::nullopt;
+  return static_cast<int32_t>(value);
+}
+
+// n / d == ((hi32(n * multiplier) [+ n when multiplier < 0]) >> shift) + (n < 0), for 32-bit signed n and d >= 2
+// (Hacker's Delight, 10-1)
+struct SignedMagic {
+  int32_t multiplier;
+  uint32_t shift;
+};
+
+constexpr SignedMagic computeSignedMagic(int32_t divisor) {
+  constexpr uint32_t two31 = 0x80000000u;
+  const uint32_t absDivisor = divisor < 0 ? -static_cast<uint32_t>(divisor) : static_cast<uint32_t>(divisor);
+  const uint32_t t = two31 + (static_cast<uint32_t>(divisor) >> 31);
+  const uint32_t absNc = t - 1 - t % absDivisor;
+
+  uint32_t p = 31;
+  uint32_t q1 = two31 / absNc, r1 = two31 - q1 * absNc;
+  uint32_t q2 = two31 / absDivisor, r2 = two31 - q2 * absDivisor;
+  uint32_t delta = 0;
+  do {
+    p++;
+    q1 *= 2; r1 *= 2;
+    if (r1 >= absNc) { q1++; r1 -= absNc; }
+    q2 *= 2; r2 *= 2;
+    if (r2 >= absDivisor) { q2++; r2 -= absDivisor; }
+    delta = absDivisor - r2;
+  } while (q1 < delta || (q1 == delta && r1 == 0));
+
+  uint32_t multiplier = q2 + 1;
+  if (divisor < 0) multiplier = -multiplier;
+  return {static_cast<int32_t>(multiplier), p - 32};
+}
+
+static_assert(computeSignedMagic(3).multiplier == 0x55555556 && computeSignedMagic(3).shift == 0);
+static_assert(computeSignedMagic(7).multiplier == static_cast<int32_t>(0x92492493) && computeSignedMagic(7).shift == 2);
+
+} // namespace codegen
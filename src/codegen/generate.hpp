@@ -1,38 +1,70 @@
 #pragma once
 
+#include <algorithm>
 #include <format>
 #include <sstream>
 #include <string>
 #include <map>
+#include <optional>
+#include <vector>
 
 #include "ast/scopes/registers.hpp"
 #include "ast/scopes/memory_x86_64.hpp"
 #include "ast/literalTypes.hpp"
+#include "codegen/arithmetic.hpp"
 #include "codegen/GPRegisterSet.hpp"
+#include "codegen/MachineInstruction.hpp"
+#include "codegen/peephole.hpp"
+#include "codegen/RegisterAllocator.hpp"
+#include "codegen/stringPool.hpp"
+#include "codegen/switch.hpp"
+#include "codegen/vectorize.hpp"
 #include "dbg/errors.hpp"
 
 namespace codegen
 {
 
-enum class CMP_OPERATION: char {
-  EQ='=',
-  NEQ='~',
-  LEQ='l',
-  GEQ='g',
-  LT='<',
-  GT='>',
+struct CodegenOptions {
+  bool omitFramePointer = false;
+  // Partially unroll counted loops without a `#pragma unroll`
+  bool unrollLoops = false;
+  // Vectorized loops use the 32-byte AVX2 instructions instead of SSE2
+  bool avx2 = false;
 };
 
-static const std::map<CMP_OPERATION, const char*> opToMnemonicCC = {
-  {CMP_OPERATION::EQ, "e"},
-  {CMP_OPERATION::NEQ, "ne"},
-  {CMP_OPERATION::LEQ, "le"},
-  {CMP_OPERATION::GEQ, "ge"},
-  {CMP_OPERATION::LT, "l"},
-  {CMP_OPERATION::GT, "g"},
+// A value copied between a variable location and a register (see emitParallelMoves)
+struct LocationMove {
+  scopes::LocationDescription destination;
+  scopes::LocationDescription source;
+  scopes::byteSize_t byteSize;
 };
 
-class NasmGenerator_x86_64
+struct FunctionFrame {
+  // Locals addressed from rbp, otherwise from rsp
+  bool framePointer = true;
+  // Leaf functions keep their locals in the 128 bytes below rsp instead of moving it
+  bool redZone = false;
+  // Bytes used by the locals (see Scope::layoutFrame)
+  scopes::byteSize_t size = 0;
+};
+
+// What a buffered function body ended up needing from its frame
+struct FunctionBody {
+  MachineInstructionList code;
+  scopes::RegisterMask calleeSaved;
+  bool accessesFrame = false;
+  bool pushes = false;
+  bool calls = false;
+  bool containsInlineAsm = false;
+  // Jump tables pointing into the code: written to .rodata only for the attempt that is kept (see emitReadOnlyData)
+  std::string readOnlyData;
+
+  bool needsNoFrame() const { return calleeSaved.none() && !accessesFrame && !pushes && !calls; }
+};
+
+static constexpr scopes::byteSize_t RED_ZONE_SIZE = 128;
+
+class NasmGenerator_x86_64 : private scopes::GPRegisterSet::SpillHandler
 {
 public:
   static constexpr char ENDL = '\n';
@@ -43,21 +75,33 @@ public:
     std::stringstream globalDeclarations;
     std::stringstream externDeclarations;
     std::stringstream preBody;
-    std::stringstream body;
+    MachineInstructionList body;
   };
 
 public:
-  NasmGenerator_x86_64() {
+  NasmGenerator_x86_64(const CodegenOptions &options = {}) : options(options) {
+    registerSet.setSpillHandler(this);
     emitDataSectionDirective();
     emitRODataSectionDirective();
     emitBSSSectionDirective();
     emitTextSectionDirective();
   };
 
-  template <typename T>
-  NasmGenerator_x86_64& operator<<(const T& value) {
-    textSection.body << value;
-    return *this;
+  void emit(MachineInstruction &&instruction) {
+    textSection.body.push_back(std::move(instruction));
+  }
+
+  void emitInstructions(const MachineInstructionList &instructions) {
+    textSection.body.insert(textSection.body.end(), instructions.begin(), instructions.end());
+  }
+
+  // Text the generator knows nothing about (user asm): a barrier for the peephole rules
+  void emitRaw(std::string text) {
+    emit({Opcode::RAW, {}, {}, std::move(text)});
+  }
+
+  void emitComment(std::string_view comment) {
+    emitRaw(std::format(";-- {}", comment));
   }
 
   void emitDataSectionDirective() {
@@ -86,11 +130,64 @@ public:
   }
 
   void emitSaveBasePointer() {
-    textSection.body << INDENT << "push " << scopes::regToStr(scopes::Register::REG_RBP) << "                 ; Save the base pointer" << ENDL;
+    emit({Opcode::PUSH, {scopes::Register::REG_RBP}, {}, {}, "Save the base pointer"});
   }
 
   void emitSetBasePointerToCurrentStackPointer() {
-    textSection.body << INDENT << "mov " << scopes::regToStr(scopes::Register::REG_RBP) << ", " << scopes::regToStr(scopes::Register::REG_RSP) << "              ; Set base pointer to current stack pointer" << ENDL;
+    emit({Opcode::MOV, {scopes::Register::REG_RBP, scopes::Register::REG_RSP}, {}, {}, "Set base pointer to current stack pointer"});
+  }
+
+  void emitPush(scopes::GeneralPurposeRegister reg) {
+    pushedBytes += 8;
+    currentBody.pushes = true;
+    emit({Opcode::PUSH, {scopes::getProperRegisterFromID64(reg)}});
+  }
+
+  void emitPop(scopes::GeneralPurposeRegister reg) {
+    pushedBytes -= 8;
+    emit({Opcode::POP, {scopes::getProperRegisterFromID64(reg)}});
+  }
+
+  void emitStackAdjustment(Opcode opcode, scopes::byteSize_t bytes, const char *comment = nullptr) {
+    emit({opcode, {scopes::Register::REG_RSP, Immediate{static_cast<int64_t>(bytes)}}, {}, {}, comment});
+  }
+
+  // Calls need rsp 16-byte aligned: the prologue aligns the frame, pushes done since then are compensated here
+  scopes::byteSize_t emitAlignStackForCall() {
+    scopes::byteSize_t padding = pushedBytes % 16;
+    pushedBytes += padding;
+    if (padding) emitStackAdjustment(Opcode::SUB, padding, "Aligning the stack for the call");
+    return padding;
+  }
+
+  // Outgoing arguments beyond the sixth go at the bottom of an area keeping rsp 16-byte aligned at the call. The area is
+  // released with emitReleaseStackPadding.
+  scopes::byteSize_t emitReserveStackArguments(size_t count) {
+    scopes::byteSize_t bytes = 8 * count;
+    bytes += (pushedBytes + bytes) % 16;
+    pushedBytes += bytes;
+    currentBody.pushes = true;
+    emitStackAdjustment(Opcode::SUB, bytes, "Reserving the stack arguments");
+    return bytes;
+  }
+
+  // Bytes pushed so far by the function body: the depth of the stack argument area right after it is reserved
+  scopes::byteSize_t stackDepth() const { return pushedBytes; }
+
+  // The area is areaDepth bytes deep: a register still spilled by a push when the argument is stored sits below it
+  void emitStoreStackArgument(size_t index, scopes::GeneralPurposeRegister reg, scopes::byteSize_t areaDepth) {
+    int64_t offset = static_cast<int64_t>(8 * index + pushedBytes - areaDepth);
+    emit({Opcode::MOV, {MemoryOperand{scopes::Register::REG_RSP, offset}, scopes::getProperRegisterFromID64(reg)}, {}, {}, "Stack argument"});
+  }
+
+  void emitReleaseStackPadding(scopes::byteSize_t padding) {
+    pushedBytes -= padding;
+    if (padding) emitStackAdjustment(Opcode::ADD, padding);
+  }
+
+  void emitReserveFrame(scopes::byteSize_t frameSize) {
+    if (frameSize == 0) return;
+    emitStackAdjustment(Opcode::SUB, frameSize, "Creating space on the stack");
   }
 
   void emitExternDirective(const std::string_view &name) {
@@ -102,15 +199,16 @@ public:
   }
 
   void emitRestoreStackPointer() {
-    textSection.body << INDENT << "mov " << scopes::regToStr(scopes::Register::REG_RSP) << ", " << scopes::regToStr(scopes::Register::REG_RBP) << "              ; Restoring stack pointer" << ENDL;
+    emit({Opcode::MOV, {scopes::Register::REG_RSP, scopes::Register::REG_RBP}, {}, {}, "Restoring stack pointer"});
   }
 
   void emitRestoreBasePointer() {
-    textSection.body << INDENT << "pop " << scopes::regToStr(scopes::Register::REG_RBP) << "                   ; Restore the base pointer" << ENDL;
+    emit({Opcode::POP, {scopes::Register::REG_RBP}, {}, {}, "Restore the base pointer"});
   }
 
   void emitLabel(const std::string_view &name) {
-    textSection.body << name << ":" << ENDL;
+    checkStackDepth(name);
+    emit({Opcode::LABEL, {}, {}, std::string(name)});
   }
 
   auto emitUniqueLabel(const std::string_view &name = "") {
@@ -125,28 +223,47 @@ public:
 
   void emitFunctionLabel(const std::string_view &name) {
     containsMain = containsMain || name == "main";
+    currentFunctionName = name;
     emitLabel(name);
   }
 
+  // Unique labels are local to the function: other sections refer to them by their full name
+  std::string qualifiedLabel(std::string_view label) const {
+    return currentFunctionName + std::string(label);
+  }
+
   void emitReturnInstruction() {
-    textSection.body << INDENT << "ret" << ENDL;
+    emit({Opcode::RET});
   }
 
   void emitCall(const std::string_view &name) {
-    textSection.body << INDENT << "call " << name << ENDL;
+    currentBody.calls = true;
+    emit({Opcode::CALL, {LabelRef{std::string(name)}}});
+  }
+
+  // The frame is torn down before the jump: see expandTailCalls
+  void emitTailCall(const std::string_view &name) {
+    emit({Opcode::TAIL_CALL, {LabelRef{std::string(name)}}});
+  }
+
+  // Ints come back in eax. A char only fills al when the callee was not compiled here.
+  void emitLoadReturnValue(scopes::GeneralPurposeRegister reg, scopes::byteSize_t size) {
+    auto result = scopes::getProperRegisterFromID64(scopes::returnRegister, size);
+    if (size == 1) emit({Opcode::MOVSX, {int32(reg), result}});
+    else if (reg != scopes::returnRegister) emitMove(int32(reg), int32(scopes::returnRegister));
   }
 
   void emitDeclaration(const scopes::LocationDescription &location) {
     std::visit([this](auto &&arg) {
       using T = std::decay_t<decltype(arg)>;
       if constexpr (std::is_same_v<T, scopes::LocalStackOffset>) {
-        textSection.body << INDENT << "sub " << scopes::regToStr(scopes::Register::REG_RSP) << ", " << arg._byteSize << " ; Creating space on the stack" << ENDL;
+        // Reserved by the prologue (see emitReserveFrame)
       }
       else if constexpr (std::is_same_v<T, scopes::GlobalStackOffset>) {
-        THROW("Global stack offset not yet implemented");
+        THROW("Globals are not declared in a function (see emitGlobalVariable)");
       }
       else if constexpr (std::is_same_v<T, scopes::Register>) {
-        THROW("Register declaration not yet implemented");
+        // Allocated by the register allocator, no space needed
       }
       else {
         THROW("Unknown location description type");
@@ -154,24 +271,68 @@ public:
     }, location);
   }
 
-  void emitBinaryOp(const char *op, const scopes::Register &tgt, const scopes::Register &src) {
-    textSection.body << INDENT << op << " " << scopes::regToStr(tgt) << ", " << scopes::regToStr(src) << ENDL;
+  // src may be folded: an immediate, a frame slot or a register
+  void emitBinaryOp(Opcode opcode, const MachineOperand &tgt, const MachineOperand &src) {
+    emit({opcode, {tgt, src}});
+  }
+
+  void emitAdd(const scopes::Register &tgt, const scopes::Register &src) { emitBinaryOp(Opcode::ADD, tgt, src); }
+  void emitSub(const scopes::Register &tgt, const scopes::Register &src) { emitBinaryOp(Opcode::SUB, tgt, src); }
+
+  // Frame slots are addressed from rbp, or from rsp when the frame pointer is omitted
+  MemoryOperand frameSlot(const scopes::LocalStackOffset &slot) {
+    currentBody.accessesFrame = true;
+    if (currentFrame.framePointer) return {scopes::Register::REG_RBP, -static_cast<int64_t>(slot._byteOffset)};
+
+    // rsp moved by the pushes done since the prologue; a red zone frame lives below it
+    int64_t offset = static_cast<int64_t>(pushedBytes) - static_cast<int64_t>(slot._byteOffset);
+    if (!currentFrame.redZone) offset += currentFrame.size;
+    return {scopes::Register::REG_RSP, offset};
   }
 
-  void emitAdd(const scopes::Register &tgt, const scopes::Register &src) { emitBinaryOp("add", tgt, src); }
-  void emitSub(const scopes::Register &tgt, const scopes::Register &src) { emitBinaryOp("sub", tgt, src); }
+  // Globals are addressed from rip, through their local alias: a shared library can not relocate a PC-relative access to
+  // a symbol it exports
+  static MemoryOperand globalSlot(const scopes::GlobalStackOffset &slot) {
+    return {scopes::Register::REG_RIP, static_cast<int64_t>(slot._byteOffset), std::nullopt, 1, 0, std::string(slot._symbol)};
+  }
+
+  // The location as an instruction operand of size bytes. Slots addressed from rsp depend on the pushes done so far: the
+  // operand is only valid until the next push or pop.
+  MachineOperand locationOperand(const scopes::LocationDescription &location, scopes::byteSize_t size) {
+    return std::visit([this, size](auto &&arg) -> MachineOperand {
+      using T = std::decay_t<decltype(arg)>;
+      if constexpr (std::is_same_v<T, scopes::LocalStackOffset>) {
+        auto slot = frameSlot(arg);
+        slot.byteSize = static_cast<uint8_t>(size);
+        return slot;
+      }
+      else if constexpr (std::is_same_v<T, scopes::GlobalStackOffset>) {
+        auto slot = globalSlot(arg);
+        slot.byteSize = static_cast<uint8_t>(size);
+        return slot;
+      }
+      else if constexpr (std::is_same_v<T, scopes::Register>) {
+        return scopes::getProperRegisterFromID64(scopes::getGPRegisterID(arg), size);
+      }
+      else {
+        THROW("Unknown location description type");
+      }
+    }, location);
+  }
 
   void emitStoreInMemory(const scopes::LocationDescription &location, const scopes::Register &reg) {
     std::visit([this, &reg](auto &&arg) {
       using T = std::decay_t<decltype(arg)>;
       if constexpr (std::is_same_v<T, scopes::LocalStackOffset>) {
-        textSection.body << INDENT << "mov [rbp-" << arg._byteOffset << "], " << scopes::regToStr(reg) << " ; Storing value in memory" << ENDL;
+        emit({Opcode::MOV, {frameSlot(arg), reg}, {}, {}, "Storing value in memory"});
       }
       else if constexpr (std::is_same_v<T, scopes::GlobalStackOffset>) {
-        THROW("Global stack offset not yet implemented");
+        emit({Opcode::MOV, {globalSlot(arg), reg}, {}, {}, "Storing value in memory"});
       }
       else if constexpr (std::is_same_v<T, scopes::Register>) {
-        THROW("Register declaration not yet implemented");
+        // Narrow variables in registers are written whole: no partial register write, loads extend them again
+        scopes::byteSize_t size = std::max<scopes::byteSize_t>(scopes::getRegisterByteSize(reg), 4);
+        emitMove(scopes::getProperRegisterFromID64(scopes::getGPRegisterID(arg), size), scopes::getProperRegisterFromID64(scopes::getGPRegisterID(reg), size));
       }
       else {
         THROW("Unknown location description type");
@@ -183,13 +344,38 @@ public:
     std::visit([this, &reg](auto &&arg) {
       using T = std::decay_t<decltype(arg)>;
       if constexpr (std::is_same_v<T, scopes::LocalStackOffset>) {
-        textSection.body << INDENT << "mov " << scopes::regToStr(reg) << ", [rbp-" << arg._byteOffset << "] ; Loading value from memory" << ENDL;
+        emit({Opcode::MOV, {reg, frameSlot(arg)}, {}, {}, "Loading value from memory"});
+      }
+      else if constexpr (std::is_same_v<T, scopes::GlobalStackOffset>) {
+        emit({Opcode::MOV, {reg, globalSlot(arg)}, {}, {}, "Loading value from memory"});
+      }
+      else if constexpr (std::is_same_v<T, scopes::Register>) {
+        emitMove(reg, scopes::getProperRegisterFromID64(scopes::getGPRegisterID(arg), scopes::getRegisterByteSize(reg)));
+      }
+      else {
+        THROW("Unknown location description type");
+      }
+    }, location);
+  }
+
+  // reg = sign extension of the size bytes stored at location
+  void emitLoadSignExtended(const scopes::Register &reg, const scopes::LocationDescription &location, scopes::byteSize_t size) {
+    // Only 64-bit targets extend a dword
+    Opcode opcode = size == 4 ? Opcode::MOVSXD : Opcode::MOVSX;
+    std::visit([this, &reg, size, opcode](auto &&arg) {
+      using T = std::decay_t<decltype(arg)>;
+      if constexpr (std::is_same_v<T, scopes::LocalStackOffset>) {
+        auto slot = frameSlot(arg);
+        slot.byteSize = static_cast<uint8_t>(size);
+        emit({opcode, {reg, slot}, {}, {}, "Loading value from memory"});
       }
       else if constexpr (std::is_same_v<T, scopes::GlobalStackOffset>) {
-        THROW("Global stack offset not yet implemented");
+        auto slot = globalSlot(arg);
+        slot.byteSize = static_cast<uint8_t>(size);
+        emit({opcode, {reg, slot}, {}, {}, "Loading value from memory"});
       }
       else if constexpr (std::is_same_v<T, scopes::Register>) {
-        THROW("Register declaration not yet implemented");
+        emitBinaryOp(opcode, reg, scopes::getProperRegisterFromID64(scopes::getGPRegisterID(arg), size));
       }
       else {
         THROW("Unknown location description type");
@@ -197,12 +383,70 @@ public:
     }, location);
   }
 
+  // Moves to self are left to the peephole pass
+  void emitMove(scopes::Register tgt, scopes::Register src) {
+    emitBinaryOp(Opcode::MOV, tgt, src);
+  }
+
+  void emitExchange(scopes::GeneralPurposeRegister a, scopes::GeneralPurposeRegister b) {
+    emitBinaryOp(Opcode::XCHG, scopes::getProperRegisterFromID64(a), scopes::getProperRegisterFromID64(b));
+  }
+
+  // Copies done as if all at once: a move is emitted once no other one still reads its destination register, and a
+  // cycle of registers is broken with an xchg. Values written to a register are sign-extended when narrow.
+  void emitParallelMoves(std::vector<LocationMove> moves) {
+    auto sourceRegister = [](const LocationMove &move) -> std::optional<scopes::GeneralPurposeRegister> {
+      if (const auto *reg = std::get_if<scopes::Register>(&move.source)) return scopes::getGPRegisterID(*reg);
+      return std::nullopt;
+    };
+    auto isRead = [&moves, &sourceRegister](const LocationMove &move) {
+      const auto *destination = std::get_if<scopes::Register>(&move.destination);
+      return destination && std::ranges::any_of(moves, [&](const LocationMove &other) {
+        return &other != &move && sourceRegister(other) == scopes::getGPRegisterID(*destination);
+      });
+    };
+
+    while (!moves.empty()) {
+      auto ready = std::ranges::find_if(moves, [&isRead](const LocationMove &move) { return !isRead(move); });
+      if (ready != moves.end()) {
+        emitLocationMove(*ready);
+        moves.erase(ready);
+        continue;
+      }
+
+      // Every destination is still read: they are all registers, and the ones reading them form cycles
+      auto move = std::ranges::find_if(moves, [&sourceRegister](const LocationMove &move) { return sourceRegister(move).has_value(); });
+      DEBUG_ASSERT(move != moves.end(), "Parallel moves blocked without a register cycle");
+      auto destination = scopes::getGPRegisterID(std::get<scopes::Register>(move->destination));
+      auto source = *sourceRegister(*move);
+      emitExchange(destination, source);
+      if (move->byteSize < 4) emitLoadSignExtended(scopes::getProperRegisterFromID64(destination, 4), move->destination, move->byteSize);
+      moves.erase(move);
+      for (auto &other : moves) {
+        auto reg = sourceRegister(other);
+        if (reg == destination) other.source = scopes::getProperRegisterFromID64(source);
+        else if (reg == source) other.source = scopes::getProperRegisterFromID64(destination);
+      }
+    }
+  }
+
+  void emitLocationMove(const LocationMove &move) {
+    if (const auto *destination = std::get_if<scopes::Register>(&move.destination)) {
+      auto reg = scopes::getGPRegisterID(*destination);
+      if (move.byteSize < 4) emitLoadSignExtended(scopes::getProperRegisterFromID64(reg, 4), move.source, move.byteSize);
+      else emitLoadFromMemory(scopes::getProperRegisterFromID64(reg, move.byteSize), move.source);
+      return;
+    }
+    DEBUG_ASSERT(std::holds_alternative<scopes::Register>(move.source), "Memory to memory move");
+    emitStoreInMemory(move.destination, scopes::getProperRegisterFromID64(scopes::getGPRegisterID(std::get<scopes::Register>(move.source)), move.byteSize));
+  }
+
   void emitLoadNumberLiteral(const scopes::Register &reg, const ast::NumberLiteralUnderlyingType &value) {
-    textSection.body << INDENT << "mov " << scopes::regToStr(reg) << ", " << value << " ; Loading number literal" << ENDL;
+    emit({Opcode::MOV, {reg, Immediate{static_cast<int64_t>(value)}}, {}, {}, "Loading number literal"});
   }
 
   void emitTest(scopes::Register reg1, scopes::Register reg2) {
-    textSection.body << INDENT << "test " << reg1 << "," << reg2 << ENDL;
+    emitBinaryOp(Opcode::TEST, reg1, reg2);
   }
 
   void emitTest(scopes::Register reg) {
@@ -210,7 +454,7 @@ public:
   }
 
   void emitCmp(scopes::Register reg1, scopes::Register reg2) {
-    textSection.body << INDENT << "cmp " << reg1 << "," << reg2 << ENDL;
+    emitBinaryOp(Opcode::CMP, reg1, reg2);
   }
 
   void emitCmp(scopes::Register reg) {
@@ -218,22 +462,325 @@ public:
   }
 
   void emitJump(std::string_view label) {
-    textSection.body << INDENT << "jmp " << label << ENDL;
+    checkStackDepth(label);
+    emit({Opcode::JMP, {LabelRef{std::string(label)}}});
   }
 
   void emitConditionalJump(std::string_view label, scopes::Register reg) {
     emitTest(reg);
-    textSection.body << INDENT << "jz " << label << ENDL;
+    emitJumpCC(label, CMP_OPERATION::EQ);
   }
 
   void emitConditionalJumpNonZero(std::string_view label, scopes::Register reg) {
     emitTest(reg);
-    textSection.body << INDENT << "jnz" << label << ENDL;
+    emitJumpCC(label, CMP_OPERATION::NEQ);
+  }
+
+  // Must directly follow the cmp setting the flags, so that the pair macro-fuses
+  void emitJumpCC(std::string_view label, CMP_OPERATION op) {
+    DEBUG_ASSERT(opToMnemonicCC.contains(op), "Nasmx86 generator received unexpected operation type on emit jx: " << ((char)op));
+    checkStackDepth(label);
+    emit({Opcode::JCC, {LabelRef{std::string(label)}}, op});
+  }
+
+  // Jumps to the label of the case equal to the int in reg, or to defaultLabel. cases are sorted by value.
+  void emitSwitchDispatch(scopes::GeneralPurposeRegister reg, const std::vector<SwitchCase> &cases, std::string_view defaultLabel) {
+    if (cases.empty()) emitJump(defaultLabel);
+    // The table address needs a second register: spilling one would leave it pushed on every case
+    else if (useJumpTable(cases) && registerSet.availableCount()) emitJumpTableDispatch(reg, cases, defaultLabel);
+    else emitCompareTree(reg, cases, defaultLabel);
+  }
+
+  // Bounds check, then an indirect jump through a table of absolute addresses in .rodata
+  void emitJumpTableDispatch(scopes::GeneralPurposeRegister reg, std::span<const SwitchCase> cases, std::string_view defaultLabel) {
+    auto index = int32(reg);
+    int32_t first = cases.front().value;
+    uint64_t range = switchValueRange(cases);
+
+    // Unsigned compare: values below the first case wrap around above the range. Ints are always written through 32-bit
+    // registers, which clears the upper half: the index can be used as is in the address.
+    if (first != 0) emit({Opcode::SUB, {index, Immediate{first}}});
+    emit({Opcode::CMP, {index, Immediate{static_cast<int64_t>(range - 1)}}});
+    emitJumpCC(defaultLabel, CMP_OPERATION::ABOVE);
+
+    auto gTable = registerSet.acquireGuard(scopes::toMask(reg));
+    auto table = scopes::getProperRegisterFromID64(gTable.reg);
+    auto tableSymbol = qualifiedLabel(generateUniqueLabel("jump_table"));
+    emitLea(table, {scopes::Register::REG_RIP, 0, std::nullopt, 1, 0, tableSymbol});
+    emit({Opcode::JMP, {MemoryOperand{table, 0, scopes::getProperRegisterFromID64(reg), 8, 8}}});
+
+    std::stringstream tableData;
+    tableData << ENDL << "align 8" << ENDL << tableSymbol << ":" << ENDL;
+    auto nextCase = cases.begin();
+    for (const auto &switchCase : cases) checkStackDepth(switchCase.label);
+    for (uint64_t i = 0; i < range; i++) {
+      bool isCase = nextCase != cases.end() && static_cast<int64_t>(nextCase->value) - first == static_cast<int64_t>(i);
+      tableData << INDENT << "dq " << qualifiedLabel(isCase ? std::string_view(nextCase->label) : defaultLabel) << ENDL;
+      if (isCase) nextCase++;
+    }
+    currentBody.readOnlyData += tableData.str();
+  }
+
+  // Balanced binary search over the case values, linear compares at the leaves
+  void emitCompareTree(scopes::GeneralPurposeRegister reg, std::span<const SwitchCase> cases, std::string_view defaultLabel) {
+    auto value = int32(reg);
+    if (cases.size() <= COMPARE_TREE_LEAF_SIZE) {
+      for (const auto &switchCase : cases) {
+        emit({Opcode::CMP, {value, Immediate{switchCase.value}}});
+        emitJumpCC(switchCase.label, CMP_OPERATION::EQ);
+      }
+      emitJump(defaultLabel);
+      return;
+    }
+
+    size_t middle = cases.size() / 2;
+    auto upperLabel = generateUniqueLabel("switch.upper");
+    emit({Opcode::CMP, {value, Immediate{cases[middle].value}}});
+    emitJumpCC(cases[middle].label, CMP_OPERATION::EQ);
+    emitJumpCC(upperLabel, CMP_OPERATION::GT);
+    emitCompareTree(reg, cases.first(middle), defaultLabel);
+    emitLabel(upperLabel);
+    emitCompareTree(reg, cases.subspan(middle + 1), defaultLabel);
+  }
+
+  // Target of break statements: the end of the innermost loop or switch
+  // Returns of an inlined body jump to its end instead of leaving the function
+  void pushInlinedReturnLabel(std::string label) { inlinedReturnLabels.push_back(std::move(label)); }
+  void popInlinedReturnLabel() { inlinedReturnLabels.pop_back(); }
+  const std::string *inlinedReturnLabel() const { return inlinedReturnLabels.empty() ? nullptr : &inlinedReturnLabels.back(); }
+
+  void pushBreakLabel(std::string label) { breakLabels.push_back(std::move(label)); }
+  void popBreakLabel() { breakLabels.pop_back(); }
+  const std::string &breakLabel() const {
+    DEBUG_ASSERT(!breakLabels.empty(), "break outside of a loop or switch");
+    return breakLabels.back();
   }
 
   void emitSetCC(scopes::Register tgt, CMP_OPERATION op) {
     DEBUG_ASSERT(opToMnemonicCC.contains(op), "Nasmx86 generator received unexpected operation type on emit setx: " << ((char)op));
-    textSection.body << INDENT << "set" << opToMnemonicCC.at(op) << " " << tgt << ENDL;
+    emit({Opcode::SETCC, {tgt}, op});
+  }
+
+  // tgt = src when op holds; src is a register or a memory operand
+  void emitCmovCC(scopes::Register tgt, const MachineOperand &src, CMP_OPERATION op) {
+    DEBUG_ASSERT(opToMnemonicCC.contains(op), "Nasmx86 generator received unexpected operation type on emit cmovx: " << ((char)op));
+    emit({Opcode::CMOVCC, {tgt, src}, op});
+  }
+
+  void emitMovzx(scopes::Register tgt, scopes::Register src) {
+    emitBinaryOp(Opcode::MOVZX, tgt, src);
+  }
+
+  void emitImul(scopes::Register tgt, scopes::Register src) { emitBinaryOp(Opcode::IMUL, tgt, src); }
+
+  void emitImul(scopes::Register tgt, scopes::Register src, int64_t value) {
+    emit({Opcode::IMUL, {tgt, src, Immediate{value}}});
+  }
+
+  void emitShift(Opcode opcode, scopes::Register reg, uint32_t amount) {
+    emit({opcode, {reg, Immediate{amount}}});
+  }
+
+  void emitLea(scopes::Register tgt, const MemoryOperand &address) {
+    emit({Opcode::LEA, {tgt, address}});
+  }
+
+  void emitLoadAddress(scopes::Register tgt, std::string_view label) {
+    emitLea(tgt, {scopes::Register::REG_RIP, 0, std::nullopt, 1, 0, std::string(label)});
+  }
+
+  // Label of the contents in the .rodata string pool
+  std::string internString(std::string_view content) { return stringPool.intern(content); }
+
+  // Full width register of the vector instruction set in use
+  VectorRegister vectorRegister(uint8_t index) const {
+    return {index, static_cast<uint8_t>(vectorBytes(options.avx2))};
+  }
+
+  // tgt = tgt op src, lane by lane. SSE2 forms take an aligned memory operand at most, VEX ones any memory operand.
+  void emitVectorOp(Opcode opcode, VectorRegister tgt, const MachineOperand &src) {
+    if (options.avx2) emit({opcode, {tgt, tgt, src}, {}, {}, nullptr, true});
+    else emit({opcode, {tgt, src}});
+  }
+
+  // tgt = src op imm: shuffles and byte shifts
+  void emitVectorImmediateOp(Opcode opcode, VectorRegister tgt, VectorRegister src, uint8_t imm) {
+    if (options.avx2) emit({opcode, {tgt, src, Immediate{imm}}, {}, {}, nullptr, true});
+    else if (opcode == Opcode::PSRLDQ) {
+      if (tgt != src) emitVectorMove(tgt, src);
+      emit({opcode, {tgt, Immediate{imm}}});
+    }
+    else emit({opcode, {tgt, src, Immediate{imm}}});
+  }
+
+  // Copies between vector registers, unaligned loads and stores
+  void emitVectorMove(const MachineOperand &tgt, const MachineOperand &src) {
+    bool registers = std::holds_alternative<VectorRegister>(tgt) && std::holds_alternative<VectorRegister>(src);
+    emit({registers ? Opcode::MOVDQA : Opcode::MOVDQU, {tgt, src}, {}, {}, nullptr, options.avx2});
+  }
+
+  // The low laneSize bytes of reg in every lane of tgt
+  void emitVectorBroadcast(VectorRegister tgt, scopes::GeneralPurposeRegister reg, scopes::byteSize_t laneSize) {
+    VectorRegister low{tgt.index};
+    emit({Opcode::MOVD, {low, int32(reg)}, {}, {}, nullptr, options.avx2});
+    if (options.avx2) {
+      emit({laneSize == 1 ? Opcode::PBROADCASTB : Opcode::PBROADCASTD, {tgt, low}, {}, {}, nullptr, true});
+      return;
+    }
+    if (laneSize == 1) {
+      emit({Opcode::PUNPCKLBW, {tgt, tgt}});
+      emit({Opcode::PSHUFLW, {tgt, tgt, Immediate{0}}});
+    }
+    emit({Opcode::PSHUFD, {tgt, tgt, Immediate{0}}});
+  }
+
+  // Lane 0 of src, sign-extended to an int
+  void emitVectorExtract(scopes::GeneralPurposeRegister reg, VectorRegister src, scopes::byteSize_t laneSize) {
+    emit({Opcode::MOVD, {int32(reg), VectorRegister{src.index}}, {}, {}, nullptr, options.avx2});
+    if (laneSize == 1) emit({Opcode::MOVSX, {int32(reg), scopes::getProperRegisterFromID64(reg, 1)}});
+  }
+
+  // Folds the upper half of a ymm register into its lower half (the xmm register), with a lane by lane operation
+  void emitVectorFoldHighHalf(Opcode opcode, VectorRegister tgt, VectorRegister scratch) {
+    VectorRegister low{tgt.index}, scratchLow{scratch.index};
+    emit({Opcode::EXTRACTI128, {scratchLow, tgt, Immediate{1}}, {}, {}, nullptr, true});
+    emit({opcode, {low, low, scratchLow}, {}, {}, nullptr, true});
+  }
+
+  // Mixing VEX-encoded 256-bit code with legacy SSE code costs a state transition: the upper halves are cleared after
+  // the last one
+  void emitVzeroupper() {
+    if (options.avx2) emit({Opcode::VZEROUPPER});
+  }
+
+  void recordVectorization(VectorizationDecision &&decision) { vectorizationReport.decisions.push_back(std::move(decision)); }
+
+  const VectorizationReport &getVectorizationReport() const { return vectorizationReport; }
+
+  std::string_view functionName() const { return currentFunctionName; }
+
+  // Exported under its name, referenced by the code through symbol. Constants go to .rodata, other initialized values
+  // to .data, and the zero-initialized ones only reserve space in .bss.
+  void emitGlobalVariable(std::string_view name, std::string_view symbol, scopes::byteSize_t size, scopes::byteSize_t alignment,
+                          bool readOnly, std::optional<std::string> initializer) {
+    bool zeroInitialized = !initializer || *initializer == "0";
+    auto &section = readOnly ? RODataSection : zeroInitialized ? bssSection : dataSection;
+    section << ENDL << INDENT << (&section == &bssSection ? "alignb " : "align ") << alignment << ENDL;
+    section << INDENT << "global " << name << ":data " << size << ENDL;
+    section << name << ":" << ENDL << symbol << ":" << ENDL;
+    if (&section == &bssSection) {
+      section << INDENT << "resb " << size;
+      return;
+    }
+
+    const char *define = size == 1 ? "db" : size == 2 ? "dw" : size == 4 ? "dd" : "dq";
+    DEBUG_ASSERT(size == 1 || size == 2 || size == 4 || size == 8, "Initialized global of " << size << " bytes");
+    section << INDENT << define << " " << initializer.value_or("0");
+  }
+
+  // Integer arithmetic is done on 32-bit registers (int)
+  static scopes::Register int32(scopes::GeneralPurposeRegister reg) { return scopes::getProperRegisterFromID64(reg, 4); }
+
+  // reg *= value, with shifts and lea instead of imul when possible
+  void emitMultiplyByConstant(scopes::GeneralPurposeRegister reg, int32_t value) {
+    auto reg32 = int32(reg);
+    auto reg64 = scopes::getProperRegisterFromID64(reg);
+    if (value == 0) {
+      emitLoadNumberLiteral(reg64, 0);
+      return;
+    }
+
+    uint32_t shift = 0;
+    while (!(value & 1)) {
+      value >>= 1;
+      shift++;
+    }
+
+    // lea computes reg + reg*{2,4,8}
+    if (value == 3 || value == 5 || value == 9) {
+      emitLea(reg32, {reg64, 0, reg64, static_cast<uint8_t>(value - 1)});
+    }
+    else if (value != 1) {
+      emitImul(reg32, reg32, static_cast<int64_t>(value) << shift);
+      return;
+    }
+    if (shift) emitShift(Opcode::SHL, reg32, shift);
+  }
+
+  // reg = reg / divisor (or reg % divisor), for divisor >= 1, with a multiplication by the reciprocal instead of idiv
+  void emitSignedDivideByConstant(scopes::GeneralPurposeRegister reg, int32_t divisor, bool remainder) {
+    auto reg32 = int32(reg);
+    if (divisor == 1) {
+      if (remainder) emitLoadNumberLiteral(scopes::getProperRegisterFromID64(reg), 0);
+      return;
+    }
+
+    auto gQuotient = registerSet.acquireGuard(scopes::toMask(reg));
+    auto quotient32 = int32(gQuotient.reg);
+    auto quotient64 = scopes::getProperRegisterFromID64(gQuotient.reg);
+
+    if (isPowerOfTwo(divisor)) {
+      // Shifting rounds towards -inf: negative dividends are biased by divisor-1 first
+      uint32_t shift = log2(divisor);
+      emitMove(quotient32, reg32);
+      emitShift(Opcode::SAR, quotient32, 31);
+      emitShift(Opcode::SHR, quotient32, 32 - shift);
+      emitAdd(quotient32, reg32);
+      emitShift(Opcode::SAR, quotient32, shift);
+      if (!remainder) {
+        emitMove(reg32, quotient32);
+        return;
+      }
+      emitShift(Opcode::SHL, quotient32, shift);
+      emitSub(reg32, quotient32);
+      return;
+    }
+
+    auto magic = computeSignedMagic(divisor);
+    emitBinaryOp(Opcode::MOVSXD, quotient64, reg32);
+    emitImul(quotient64, quotient64, magic.multiplier);
+    emitShift(Opcode::SAR, quotient64, 32);
+    if (magic.multiplier < 0) emitAdd(quotient32, reg32);
+    if (magic.shift) emitShift(Opcode::SAR, quotient32, magic.shift);
+
+    // Round towards zero: +1 for negative dividends
+    if (!remainder) {
+      emitShift(Opcode::SHR, reg32, 31);
+      emitAdd(reg32, quotient32);
+      return;
+    }
+    auto gSign = registerSet.acquireGuard(scopes::toMask(reg) | scopes::toMask(gQuotient.reg));
+    auto sign32 = int32(gSign.reg);
+    emitMove(sign32, reg32);
+    emitShift(Opcode::SHR, sign32, 31);
+    emitAdd(quotient32, sign32);
+    emitImul(quotient32, quotient32, divisor);
+    emitSub(reg32, quotient32);
+  }
+
+  // reg = reg / divisor (or reg % divisor) with idiv, which works on edx:eax. Both are borrowed (saved when in use).
+  void emitSignedDivide(scopes::GeneralPurposeRegister reg, scopes::GeneralPurposeRegister divisor, bool remainder) {
+    using scopes::GeneralPurposeRegister;
+    DEBUG_ASSERT(divisor != GeneralPurposeRegister::REG_RAX && divisor != GeneralPurposeRegister::REG_RDX, "idiv divisor can not live in edx:eax");
+
+    std::vector<scopes::GPRegisterSet::RegisterGuard> borrowed;
+    std::vector<GeneralPurposeRegister> saved;
+    for (auto fixed : {GeneralPurposeRegister::REG_RAX, GeneralPurposeRegister::REG_RDX}) {
+      if (fixed == reg) continue;
+      if (registerSet.isAvailable(fixed)) {
+        borrowed.push_back(registerSet.acquireGuard(fixed));
+      } else {
+        emitPush(fixed);
+        saved.push_back(fixed);
+      }
+    }
+
+    emitMove(int32(GeneralPurposeRegister::REG_RAX), int32(reg));
+    emit({Opcode::CDQ});
+    emit({Opcode::IDIV, {int32(divisor)}});
+    emitMove(int32(reg), int32(remainder ? GeneralPurposeRegister::REG_RDX : GeneralPurposeRegister::REG_RAX));
+
+    for (auto fixed = saved.rbegin(); fixed != saved.rend(); ++fixed) emitPop(*fixed);
   }
 
   void generateAsmCode(std::ostream &asmCode) {
@@ -245,6 +792,8 @@ public:
 
     asmCode << ENDL;
     asmCode << RODataSection.str() << ENDL;
+    stringPool.emit(asmCode);
+    stringPoolStats = stringPool.stats();
 
     asmCode << ENDL;
     asmCode << bssSection.str() << ENDL;
@@ -254,19 +803,214 @@ public:
     asmCode << textSection.externDeclarations.str() << ENDL;
     asmCode << textSection.globalDeclarations.str() << ENDL;
     asmCode << textSection.preBody.str() << ENDL;
-    asmCode << textSection.body.str();
+
+    PeepholeOptimizer peephole;
+    peephole.run(textSection.body);
+    peepholeStats = peephole.stats();
+    for (const auto &instruction : textSection.body) {
+      instruction.print(asmCode);
+    }
   }
 
+  // Rewrites done by the peephole pass of generateAsmCode
+  const PeepholeStats &getPeepholeStats() const { return peepholeStats; }
+
+  const StringPoolStats &getStringPoolStats() const { return stringPoolStats; }
+
   scopes::GPRegisterSet &regSet() { return registerSet; }
 
+  // Function bodies are buffered: the prologue depends on what the body ends up using
+  void beginFunctionBody(const FunctionAllocation &allocation, const FunctionFrame &frame, std::optional<std::string> returnLabel) {
+    DEBUG_ASSERT(!currentAllocation, "Nested function bodies are not supported");
+    currentAllocation = &allocation;
+    currentFrame = frame;
+    currentReturnLabel = std::move(returnLabel);
+    currentBody = FunctionBody{};
+    pushedBytes = 0;
+    labelStackDepths.clear();
+    registerSet.resetUsedRegisters();
+    std::swap(textSection.body, pendingFunctionBody);
+  }
+
+  FunctionBody endFunctionBody() {
+    DEBUG_ASSERT(currentAllocation, "No function body to end");
+    std::swap(textSection.body, pendingFunctionBody);
+    currentBody.code = std::move(pendingFunctionBody);
+    pendingFunctionBody.clear();
+
+    scopes::RegisterMask written = currentAllocation->usedCalleeSaved | currentBody.calleeSaved | registerSet.usedRegisters();
+    currentBody.calleeSaved.reset();
+    for (auto reg: scopes::CALLEE_SAVED_REGISTERS) {
+      if (written.test(static_cast<size_t>(reg))) currentBody.calleeSaved |= scopes::toMask(reg);
+    }
+    currentAllocation = nullptr;
+    return std::move(currentBody);
+  }
+
+  // A body can be generated several times: only the one emitted keeps its jump tables
+  void emitReadOnlyData(const FunctionBody &body) {
+    RODataSection << body.readOnlyData;
+  }
+
+  // Registers written behind the register set's back by inline asm. The block may also use the stack below rsp.
+  void markInlineAsm(scopes::RegisterMask clobbered) {
+    currentBody.calleeSaved |= clobbered;
+    currentBody.containsInlineAsm = true;
+  }
+
+  void emitFunctionReturn() {
+    if (currentReturnLabel) emitJump(*currentReturnLabel);
+    else emitReturnInstruction();
+  }
+
+  void emitFramePrologue(const FunctionFrame &frame, const FunctionBody &body, scopes::byteSize_t reservedBytes) {
+    for (auto reg : scopes::CALLEE_SAVED_REGISTERS) {
+      if (body.calleeSaved.test(static_cast<size_t>(reg))) emitPush(reg);
+    }
+    if (frame.framePointer) {
+      emitSaveBasePointer();
+      emitSetBasePointerToCurrentStackPointer();
+    }
+    emitReserveFrame(reservedBytes);
+  }
+
+  // Parameters that do not live where the caller left them. The register allocator never gives a parameter the argument
+  // register of another one, so the only ordering needed is that values going to the frame are stored first (a
+  // parameter may take the register of one spilled under pressure). Stack arguments are read from the caller's frame,
+  // above the return address and everything the prologue pushed.
+  void emitIncomingArguments(const FunctionAllocation &allocation, const FunctionFrame &frame, const FunctionBody &body, scopes::byteSize_t reservedBytes) {
+    auto savedPushedBytes = pushedBytes;
+    pushedBytes = 0;
+    currentFrame = frame;
+    scopes::byteSize_t callerArea = reservedBytes + 8 * (body.calleeSaved.count() + (frame.framePointer ? 1 : 0) + 1);
+
+    auto incomingSlot = [callerArea](const scopes::IncomingStackOffset &slot) {
+      return MemoryOperand{scopes::Register::REG_RSP, static_cast<int64_t>(callerArea + 8 * slot._index)};
+    };
+    // Narrow values are sign-extended, like every value held in a register
+    auto load = [this, &incomingSlot](scopes::GeneralPurposeRegister reg, const scopes::IncomingStackOffset &slot) {
+      auto operand = incomingSlot(slot);
+      operand.byteSize = static_cast<uint8_t>(slot._byteSize);
+      emit({slot._byteSize < 4 ? Opcode::MOVSX : Opcode::MOV, {int32(reg), operand}, {}, {}, "Loading stack argument"});
+    };
+
+    for (bool toFrame : {true, false}) {
+      for (const auto &argument : allocation.arguments) {
+        if (FunctionAllocation::isIncomingLocation(argument)) continue;
+        const auto &location = argument.variable->location;
+        if (std::holds_alternative<scopes::LocalStackOffset>(location) != toFrame) continue;
+
+        auto size = (*argument.variable->typeDescription)->byteSize;
+        if (const auto *reg = std::get_if<scopes::Register>(&argument.incoming)) {
+          emitStoreInMemory(location, scopes::getProperRegisterFromID64(scopes::getGPRegisterID(*reg), size));
+        }
+        else if (toFrame) {
+          // rax carries no argument
+          load(scopes::GeneralPurposeRegister::REG_RAX, std::get<scopes::IncomingStackOffset>(argument.incoming));
+          emitStoreInMemory(location, scopes::getProperRegisterFromID64(scopes::GeneralPurposeRegister::REG_RAX, size));
+        }
+        else {
+          load(scopes::getGPRegisterID(std::get<scopes::Register>(location)), std::get<scopes::IncomingStackOffset>(argument.incoming));
+        }
+      }
+    }
+    pushedBytes = savedPushedBytes;
+  }
+
+  void emitFrameEpilogue(const FunctionFrame &frame, const FunctionBody &body, scopes::byteSize_t reservedBytes) {
+    if (frame.framePointer) {
+      if (reservedBytes) emitRestoreStackPointer();
+      emitRestoreBasePointer();
+    }
+    else if (reservedBytes) {
+      emitStackAdjustment(Opcode::ADD, reservedBytes, "Releasing the frame");
+    }
+    for (auto reg = scopes::CALLEE_SAVED_REGISTERS.rbegin(); reg != scopes::CALLEE_SAVED_REGISTERS.rend(); ++reg) {
+      if (body.calleeSaved.test(static_cast<size_t>(*reg))) emitPop(*reg);
+    }
+  }
+
+  // Each tail call becomes the epilogue followed by a jump: the callee returns straight to our caller
+  void expandTailCalls(MachineInstructionList &code, const FunctionFrame &frame, const FunctionBody &body, scopes::byteSize_t reservedBytes) {
+    if (std::ranges::none_of(code, [](const auto &instruction) { return instruction.opcode == Opcode::TAIL_CALL; })) return;
+
+    MachineInstructionList epilogue;
+    std::swap(textSection.body, epilogue);
+    auto savedPushedBytes = pushedBytes;
+    emitFrameEpilogue(frame, body, reservedBytes);
+    pushedBytes = savedPushedBytes;
+    std::swap(textSection.body, epilogue);
+
+    MachineInstructionList expanded;
+    expanded.reserve(code.size());
+    for (auto &instruction : code) {
+      if (instruction.opcode != Opcode::TAIL_CALL) {
+        expanded.push_back(std::move(instruction));
+        continue;
+      }
+      expanded.insert(expanded.end(), epilogue.begin(), epilogue.end());
+      expanded.push_back({Opcode::JMP, std::move(instruction.operands), {}, {}, "Tail call"});
+    }
+    code = std::move(expanded);
+  }
+
+  // Temporaries must not overwrite the variables living in registers during this range. Those the range never reads or
+  // writes can still be saved and borrowed when nothing else is left (see GPRegisterSet::acquireGuard)
+  scopes::GPRegisterSet::PinGuard pinLiveRegisters(const ProgramRange &range) {
+    if (!currentAllocation) return registerSet.pinGuard({});
+    return registerSet.pinGuard(currentAllocation->registersLiveIn(range), currentAllocation->registersReferencedIn(range));
+  }
+
+  const FunctionAllocation *allocation() const { return currentAllocation; }
+
+  const CodegenOptions &codegenOptions() const { return options; }
+
+private:
+  // Pushes and spills are undone on the path they were done on: every jump to a label and the label itself must see the
+  // same stack depth, or rsp is off on one of the paths
+  void checkStackDepth(std::string_view label) {
+    if (!currentAllocation) return;
+    auto [depth, inserted] = labelStackDepths.try_emplace(std::string(label), pushedBytes);
+    DEBUG_ASSERT(inserted || depth->second == pushedBytes, "Stack depth " << pushedBytes << " at label " << label
+                 << " differs from the depth " << depth->second << " seen at another jump to it");
+  }
+
+  void spill(scopes::GeneralPurposeRegister reg) override {
+    pushedBytes += 8;
+    currentBody.pushes = true;
+    emit({Opcode::PUSH, {scopes::getProperRegisterFromID64(reg)}, {}, {}, "Spilling register"});
+  }
+
+  void reload(scopes::GeneralPurposeRegister reg) override {
+    pushedBytes -= 8;
+    emit({Opcode::POP, {scopes::getProperRegisterFromID64(reg)}, {}, {}, "Reloading spilled register"});
+  }
+
 private:
+  CodegenOptions options;
   uint32_t uniqueLabelCount = 0;
   bool containsMain = false;
+  std::string currentFunctionName;
+  std::vector<std::string> breakLabels;
+  std::vector<std::string> inlinedReturnLabels;
   std::stringstream dataSection;
   std::stringstream RODataSection;
   std::stringstream bssSection;
   TextSection textSection;
+  StringPool stringPool;
   scopes::GPRegisterSet registerSet;
+  const FunctionAllocation *currentAllocation = nullptr;
+  FunctionFrame currentFrame;
+  FunctionBody currentBody;
+  std::optional<std::string> currentReturnLabel;
+  // Bytes pushed by the function body on top of its frame
+  scopes::byteSize_t pushedBytes = 0;
+  // Depth of the pushes at the jumps and labels of the current body (see checkStackDepth)
+  std::map<std::string, scopes::byteSize_t> labelStackDepths;
+  MachineInstructionList pendingFunctionBody;
+  PeepholeStats peepholeStats;
+  StringPoolStats stringPoolStats;
+  VectorizationReport vectorizationReport;
 };
 
 }
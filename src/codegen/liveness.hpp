@@ -0,0 +1,143 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <vector>
+
+#include "ast/scopes/memory_x86_64.hpp"
+#include "ast/scopes/registers.hpp"
+#include "codegen/GPRegisterSet.hpp"
+
+namespace codegen
+{
+
+// Program points are handed out in evaluation order by the liveness pass (see nodes_liveness.ipp)
+using programPoint_t = uint32_t;
+
+struct ProgramRange
+{
+  programPoint_t begin = 0;
+  programPoint_t end = 0;
+
+  bool overlaps(const ProgramRange &other) const { return begin <= other.end && other.begin <= end; }
+  bool strictlyContains(programPoint_t point) const { return begin < point && point < end; }
+};
+
+struct LiveInterval
+{
+  scopes::VariableDescription *variable;
+  ProgramRange range;
+  // Set when the variable is declared as a copy of another one: sharing its register removes the copy
+  const scopes::VariableDescription *copyHint = nullptr;
+  // Parameters: defined on entry, in their argument register when passed in one
+  bool isParameter = false;
+  std::optional<scopes::GeneralPurposeRegister> incomingRegister = std::nullopt;
+  std::optional<scopes::GeneralPurposeRegister> reg = std::nullopt;
+  // Points where the variable is read or written
+  std::vector<programPoint_t> references = {};
+};
+
+// A parameter and the location the caller left it in
+struct IncomingArgument
+{
+  scopes::VariableDescription *variable;
+  scopes::LocationDescription incoming;
+};
+
+struct RegisterClobber
+{
+  programPoint_t point;
+  scopes::RegisterMask registers;
+};
+
+class LivenessBuilder
+{
+public:
+  programPoint_t tick() { return _nextPoint++; }
+
+  void reference(scopes::VariableDescription &variable)
+  {
+    programPoint_t point = tick();
+    auto [it, inserted] = _intervals.try_emplace(variable.variableId, LiveInterval{&variable, {point, point}});
+    if (!inserted) it->second.range.end = point;
+    it->second.references.push_back(point);
+  }
+
+  void copy(const scopes::VariableDescription &destination, const scopes::VariableDescription &source)
+  {
+    auto it = _intervals.find(destination.variableId);
+    if (it != _intervals.end() && it->second.range.begin == _nextPoint - 1) it->second.copyHint = &source;
+  }
+
+  // Called once the body is walked, with a point taken before it: a parameter the body reads is live from the entry
+  void parameter(scopes::VariableDescription &variable, const scopes::LocationDescription &incoming, programPoint_t entry)
+  {
+    _parameters.push_back({&variable, incoming});
+    auto it = _intervals.find(variable.variableId);
+    if (it == _intervals.end()) return;
+    it->second.range.begin = entry;
+    it->second.isParameter = true;
+    if (const auto *reg = std::get_if<scopes::Register>(&incoming)) it->second.incomingRegister = scopes::getGPRegisterID(*reg);
+  }
+
+  // The value of these registers is overwritten at this point (fixed register constraints, calls, asm blocks)
+  void clobber(scopes::RegisterMask registers) { _clobbers.push_back({tick(), registers}); }
+  void clobber(scopes::GeneralPurposeRegister reg) { clobber(scopes::toMask(reg)); }
+
+  programPoint_t call()
+  {
+    _calls.push_back(tick());
+    return _calls.back();
+  }
+
+  // An expression needing this many temporaries is evaluated somewhere in the function
+  void requireTemporaries(uint32_t count) { _temporaryNeed = std::max(_temporaryNeed, count); }
+
+  programPoint_t beginLoop() { return tick(); }
+  void endLoop(programPoint_t header) { _loops.push_back({header, tick()}); }
+
+  // A variable alive when entering a loop stays alive until the back edge: the next iteration may read it
+  std::vector<LiveInterval> buildIntervals() const
+  {
+    std::vector<LiveInterval> intervals;
+    for (auto &[id, interval]: _intervals) intervals.push_back(interval);
+
+    bool changed = true;
+    while (changed)
+    {
+      changed = false;
+      for (auto &interval: intervals)
+      {
+        for (auto &loop: _loops)
+        {
+          if (interval.range.begin < loop.begin && interval.range.end >= loop.begin && interval.range.end < loop.end)
+          {
+            interval.range.end = loop.end;
+            changed = true;
+          }
+        }
+      }
+    }
+
+    std::sort(intervals.begin(), intervals.end(), [](const LiveInterval &a, const LiveInterval &b) { return a.range.begin < b.range.begin; });
+    return intervals;
+  }
+
+  const std::vector<RegisterClobber> &clobbers() const { return _clobbers; }
+  const std::vector<programPoint_t> &calls() const { return _calls; }
+  const std::vector<IncomingArgument> &parameters() const { return _parameters; }
+  uint32_t temporaryNeed() const { return _temporaryNeed; }
+
+private:
+  programPoint_t _nextPoint = 0;
+  std::map<scopes::id_t, LiveInterval> _intervals;
+  std::vector<RegisterClobber> _clobbers;
+  std::vector<programPoint_t> _calls;
+  std::vector<ProgramRange> _loops;
+  std::vector<IncomingArgument> _parameters;
+  uint32_t _temporaryNeed = 0;
+};
+
+} /* namespace codegen */
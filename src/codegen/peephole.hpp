@@ -0,0 +1,141 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "ast/scopes/registers.hpp"
+#include "codegen/MachineInstruction.hpp"
+#include "dbg/logger.hpp"
+
+namespace codegen
+{
+
+enum class PeepholeRule : uint8_t {
+  SELF_MOVE,
+  STORE_LOAD_FORWARDING,
+  ZERO_WITH_XOR,
+  JUMP_TO_NEXT,
+  MERGE_STACK_ADJUSTMENTS,
+};
+
+static constexpr size_t PEEPHOLE_RULE_COUNT = 5;
+
+static constexpr std::array<const char *, PEEPHOLE_RULE_COUNT> peepholeRuleNames = {
+  "self-move", "store-load-forwarding", "zero-with-xor", "jump-to-next", "merge-stack-adjustments",
+};
+
+struct PeepholeStats {
+  std::array<size_t, PEEPHOLE_RULE_COUNT> hits = {};
+
+  void hit(PeepholeRule rule) { hits[static_cast<size_t>(rule)]++; }
+
+  void logDebug() const {
+    for (size_t i = 0; i < PEEPHOLE_RULE_COUNT; i++) {
+      LOG_DEBUG("[Peephole] " << peepholeRuleNames[i] << "=" << hits[i]);
+    }
+  }
+};
+
+// Local rewrites over the emitted instructions. Rules look at a small window and are applied until nothing changes.
+class PeepholeOptimizer {
+public:
+  void run(MachineInstructionList &instructions) {
+    bool changed = true;
+    while (changed) {
+      changed = false;
+      for (size_t i = 0; i < instructions.size(); i++) {
+        changed |= rewriteAt(instructions, i);
+      }
+    }
+  }
+
+  const PeepholeStats &stats() const { return _stats; }
+
+private:
+  bool rewriteAt(MachineInstructionList &instructions, size_t i) {
+    auto &instruction = instructions[i];
+    MachineInstruction *next = i + 1 < instructions.size() ? &instructions[i + 1] : nullptr;
+
+    // mov r, r
+    if (instruction.isMove()) {
+      const auto *target = instruction.operand<scopes::Register>(0);
+      const auto *source = instruction.operand<scopes::Register>(1);
+      if (target && source && *target == *source) {
+        instructions.erase(instructions.begin() + i);
+        _stats.hit(PeepholeRule::SELF_MOVE);
+        return true;
+      }
+    }
+
+    // mov [m], r1 ; mov r2, [m]  ->  mov [m], r1 ; mov r2, r1
+    if (instruction.isMove() && next && next->isMove()) {
+      const auto *storeSlot = instruction.operand<MemoryOperand>(0);
+      const auto *stored = instruction.operand<scopes::Register>(1);
+      const auto *loaded = next->operand<scopes::Register>(0);
+      const auto *loadSlot = next->operand<MemoryOperand>(1);
+      if (storeSlot && stored && loaded && loadSlot && *storeSlot == *loadSlot
+          && scopes::getRegisterByteSize(*stored) == scopes::getRegisterByteSize(*loaded)) {
+        *next = MachineInstruction{Opcode::MOV, {*loaded, *stored}};
+        _stats.hit(PeepholeRule::STORE_LOAD_FORWARDING);
+        return true;
+      }
+    }
+
+    // mov r, 0  ->  xor r32, r32 (32-bit writes clear the upper half, 8 and 16-bit ones do not)
+    if (instruction.isMove()) {
+      const auto *target = instruction.operand<scopes::Register>(0);
+      const auto *value = instruction.operand<Immediate>(1);
+      if (target && value && value->value == 0 && scopes::getRegisterByteSize(*target) >= 4
+          && flagsDeadAfter(instructions, i)) {
+        auto target32 = scopes::getProperRegisterFromID64(scopes::getGPRegisterID(*target), 4);
+        instruction = MachineInstruction{Opcode::XOR, {target32, target32}};
+        _stats.hit(PeepholeRule::ZERO_WITH_XOR);
+        return true;
+      }
+    }
+
+    // jmp L ; L:
+    if (instruction.opcode == Opcode::JMP) {
+      const auto *target = instruction.operand<LabelRef>(0);
+      for (size_t j = i + 1; target && j < instructions.size() && instructions[j].opcode == Opcode::LABEL; j++) {
+        if (instructions[j].text != target->name) continue;
+        instructions.erase(instructions.begin() + i);
+        _stats.hit(PeepholeRule::JUMP_TO_NEXT);
+        return true;
+      }
+    }
+
+    // sub rsp, a ; sub rsp, b  ->  sub rsp, a+b
+    if (next && isStackAdjustment(instruction) && next->opcode == instruction.opcode && isStackAdjustment(*next)) {
+      instruction.operands[1] = Immediate{instruction.operand<Immediate>(1)->value + next->operand<Immediate>(1)->value};
+      instructions.erase(instructions.begin() + i + 1);
+      _stats.hit(PeepholeRule::MERGE_STACK_ADJUSTMENTS);
+      return true;
+    }
+
+    return false;
+  }
+
+  // Flags are only ever consumed right after the cmp/test producing them: they are dead once the next writer, call,
+  // return or jump is reached. User asm could read anything.
+  static bool flagsDeadAfter(const MachineInstructionList &instructions, size_t i) {
+    for (size_t j = i + 1; j < instructions.size(); j++) {
+      const auto &instruction = instructions[j];
+      if (instruction.readsFlags() || instruction.opcode == Opcode::RAW) return false;
+      if (instruction.writesFlags()) return true;
+      if (instruction.opcode == Opcode::CALL || instruction.opcode == Opcode::RET || instruction.opcode == Opcode::JMP) return true;
+    }
+    return true;
+  }
+
+  static bool isStackAdjustment(const MachineInstruction &instruction) {
+    if (instruction.opcode != Opcode::SUB && instruction.opcode != Opcode::ADD) return false;
+    const auto *target = instruction.operand<scopes::Register>(0);
+    return target && *target == scopes::Register::REG_RSP && instruction.operand<Immediate>(1);
+  }
+
+private:
+  PeepholeStats _stats;
+};
+
+} // namespace codegen
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <numeric>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "dbg/logger.hpp"
+
+namespace codegen
+{
+
+// Strings are read 16 bytes at a time (SSE2): a short one never straddles two blocks, a longer one starts on a block
+static constexpr size_t STRING_POOL_BLOCK_SIZE = 16;
+
+struct StringPoolStats {
+  // Literals met in the code, distinct contents, contents stored inside a longer one
+  size_t literals = 0;
+  size_t unique = 0;
+  size_t suffixShared = 0;
+  size_t bytes = 0;
+  size_t padding = 0;
+
+  void logDebug() const {
+    LOG_DEBUG("[StringPool] literals=" << literals << " unique=" << unique << " suffix-shared=" << suffixShared
+              << " bytes=" << bytes << " padding=" << padding);
+  }
+};
+
+// The NUL-terminated string literals of the translation unit, in .rodata. Equal literals share a label, and a literal
+// ending another one ("ld" in "world") points into it instead of taking bytes of its own.
+class StringPool {
+public:
+  // Label of the first byte of the contents
+  std::string intern(std::string_view content) {
+    _stats.literals++;
+    auto [entry, inserted] = labels.try_emplace(std::string(content), "");
+    if (inserted) {
+      entry->second = "__zpp_str." + std::to_string(strings.size());
+      strings.push_back(&entry->first);
+    }
+    return entry->second;
+  }
+
+  bool empty() const { return strings.empty(); }
+
+  void emit(std::ostream &os) {
+    if (strings.empty()) return;
+    _stats.unique = strings.size();
+
+    // Sorted by reversed contents, a string is a suffix of the next one when it is a prefix of it backwards. Its owner
+    // is then the owner of the next one: the longest string ending the same way.
+    std::vector<size_t> order(strings.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::ranges::sort(order, [this](size_t a, size_t b) {
+      return std::lexicographical_compare(strings[a]->rbegin(), strings[a]->rend(), strings[b]->rbegin(), strings[b]->rend());
+    });
+    std::vector<size_t> owner(strings.size());
+    for (size_t i = order.size(); i-- > 0;) {
+      size_t current = order[i];
+      owner[current] = current;
+      if (i + 1 < order.size() && strings[order[i + 1]]->ends_with(*strings[current])) owner[current] = owner[order[i + 1]];
+    }
+
+    // Labels inside each owner, by offset
+    std::vector<std::multimap<size_t, size_t>> suffixes(strings.size());
+    for (size_t i = 0; i < strings.size(); i++) {
+      suffixes[owner[i]].emplace(strings[owner[i]]->size() - strings[i]->size(), i);
+      if (owner[i] != i) _stats.suffixShared++;
+    }
+
+    os << "\talign " << STRING_POOL_BLOCK_SIZE << ", db 0\n";
+    size_t offset = 0;
+    for (size_t i = 0; i < strings.size(); i++) {
+      if (owner[i] != i) continue;
+      const auto &content = *strings[i];
+      size_t size = content.size() + 1;
+      size_t blockOffset = offset % STRING_POOL_BLOCK_SIZE;
+      if (blockOffset && (size > STRING_POOL_BLOCK_SIZE || blockOffset + size > STRING_POOL_BLOCK_SIZE)) {
+        os << "\talign " << STRING_POOL_BLOCK_SIZE << ", db 0\n";
+        _stats.padding += STRING_POOL_BLOCK_SIZE - blockOffset;
+        offset += STRING_POOL_BLOCK_SIZE - blockOffset;
+      }
+
+      size_t begin = 0;
+      for (const auto &[suffixOffset, string] : suffixes[i]) {
+        if (suffixOffset > begin) emitBytes(os, std::string_view(content).substr(begin, suffixOffset - begin), false);
+        begin = suffixOffset;
+        os << labels.at(*strings[string]) << ":\n";
+      }
+      emitBytes(os, std::string_view(content).substr(begin), true);
+      offset += size;
+    }
+    _stats.bytes = offset;
+  }
+
+  const StringPoolStats &stats() const { return _stats; }
+
+private:
+  // Printable runs are quoted, the other bytes written as numbers
+  static void emitBytes(std::ostream &os, std::string_view bytes, bool terminate) {
+    os << "\tdb ";
+    bool first = true;
+    auto separate = [&os, &first]() {
+      if (!first) os << ", ";
+      first = false;
+    };
+    for (size_t i = 0; i < bytes.size();) {
+      size_t end = i;
+      while (end < bytes.size() && isQuotable(bytes[end])) end++;
+      separate();
+      if (end > i) {
+        os << '\'' << bytes.substr(i, end - i) << '\'';
+        i = end;
+      }
+      else {
+        os << static_cast<unsigned>(static_cast<uint8_t>(bytes[i++]));
+      }
+    }
+    if (terminate) {
+      separate();
+      os << 0;
+    }
+    os << '\n';
+  }
+
+  static bool isQuotable(char c) { return c >= ' ' && c <= '~' && c != '\''; }
+
+  // Node-based: the pointers in strings stay valid
+  std::map<std::string, std::string> labels;
+  // In interning order, which is also the emission order
+  std::vector<const std::string *> strings;
+  StringPoolStats _stats;
+};
+
+} // namespace codegen
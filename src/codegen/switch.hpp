@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace codegen
+{
+
+struct SwitchCase {
+  int32_t value;
+  std::string label;
+};
+
+// Below this many cases, a compare tree is as fast as the indirect jump
+constexpr size_t JUMP_TABLE_MIN_CASES = 4;
+// Table entries per case: holes in the value range jump to the default label
+constexpr uint64_t JUMP_TABLE_MAX_SPREAD = 3;
+// Leaves of the compare tree are tested linearly
+constexpr size_t COMPARE_TREE_LEAF_SIZE = 3;
+
+// Number of table entries covering sorted cases
+inline uint64_t switchValueRange(std::span<const SwitchCase> cases) {
+  return static_cast<uint64_t>(static_cast<int64_t>(cases.back().value) - cases.front().value) + 1;
+}
+
+// Dense case sets dispatch through a jump table, sparse ones through a balanced compare tree
+inline bool useJumpTable(std::span<const SwitchCase> cases) {
+  return cases.size() >= JUMP_TABLE_MIN_CASES && switchValueRange(cases) <= JUMP_TABLE_MAX_SPREAD * cases.size();
+}
+
+} // namespace codegen
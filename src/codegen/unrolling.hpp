@@ -0,0 +1,90 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <optional>
+
+#include "codegen/MachineInstruction.hpp"
+
+namespace codegen
+{
+
+// `#pragma unroll` without a count: as many copies as iterations
+constexpr uint32_t UNROLL_FULL = std::numeric_limits<uint32_t>::max();
+
+// Sizes are counted in AST nodes of the body and increment (see summarize)
+// Constant trip count loops are always fully unrolled below this size, as the tests and jumps removed pay for the copies
+constexpr uint64_t FULL_UNROLL_MAX_SIZE = 48;
+// Copies made by a `#pragma unroll` asking for more iterations than the loop has
+constexpr uint64_t FULL_UNROLL_MAX_TRIP_COUNT = 1024;
+// Copies of the body per test with -funroll-loops
+constexpr uint32_t DEFAULT_UNROLL_FACTOR = 4;
+// -funroll-loops lowers its factor to keep unrolled bodies below this size
+constexpr uint64_t PARTIAL_UNROLL_MAX_SIZE = 128;
+
+// Iterations of `for (i = start; i op bound; i = i + step)`, when the induction variable never wraps around
+constexpr std::optional<uint64_t> tripCount(int32_t start, int32_t bound, int32_t step, CMP_OPERATION op) {
+  bool increasing = op == CMP_OPERATION::LT || op == CMP_OPERATION::LEQ;
+  if (step == 0 || increasing != (step > 0)) return std::nullopt;
+
+  int64_t distance = 0;
+  switch (op) {
+    case CMP_OPERATION::LT: distance = static_cast<int64_t>(bound) - start; break;
+    case CMP_OPERATION::LEQ: distance = static_cast<int64_t>(bound) - start + 1; break;
+    case CMP_OPERATION::GT: distance = static_cast<int64_t>(start) - bound; break;
+    case CMP_OPERATION::GEQ: distance = static_cast<int64_t>(start) - bound + 1; break;
+    default: return std::nullopt;
+  }
+  if (distance <= 0) return 0;
+
+  int64_t magnitude = step < 0 ? -static_cast<int64_t>(step) : step;
+  uint64_t trips = static_cast<uint64_t>((distance + magnitude - 1) / magnitude);
+  // The value after the last increment must still be an int
+  int64_t last = start + static_cast<int64_t>(trips) * step;
+  if (last < std::numeric_limits<int32_t>::min() || last > std::numeric_limits<int32_t>::max()) return std::nullopt;
+  return trips;
+}
+
+static_assert(tripCount(0, 10, 1, CMP_OPERATION::LT) == 10);
+static_assert(tripCount(0, 10, 3, CMP_OPERATION::LT) == 4);
+static_assert(tripCount(0, 10, 3, CMP_OPERATION::LEQ) == 4);
+static_assert(tripCount(10, 0, -2, CMP_OPERATION::GEQ) == 6);
+static_assert(tripCount(5, 5, 1, CMP_OPERATION::LT) == 0);
+static_assert(!tripCount(0, std::numeric_limits<int32_t>::max(), 1, CMP_OPERATION::LEQ));
+
+struct UnrollPlan {
+  // Copies of the body between two tests of the condition
+  uint32_t factor = 1;
+  // No test at all: the body is copied once per iteration
+  bool full = false;
+};
+
+// pragmaCount is the count of a `#pragma unroll` on the loop, trips its trip count when constant
+constexpr UnrollPlan planUnroll(std::optional<uint64_t> trips, uint64_t bodySize, std::optional<uint32_t> pragmaCount,
+                                bool unrollLoops) {
+  if (pragmaCount == 1u) return {};
+
+  if (trips) {
+    bool requested = pragmaCount && *pragmaCount >= *trips && *trips <= FULL_UNROLL_MAX_TRIP_COUNT;
+    if (requested || *trips * bodySize <= FULL_UNROLL_MAX_SIZE) return {static_cast<uint32_t>(*trips), true};
+  }
+
+  uint32_t factor = 1;
+  if (pragmaCount) factor = *pragmaCount == UNROLL_FULL ? DEFAULT_UNROLL_FACTOR : *pragmaCount;
+  else if (unrollLoops) {
+    factor = DEFAULT_UNROLL_FACTOR;
+    while (factor > 1 && factor * bodySize > PARTIAL_UNROLL_MAX_SIZE) factor /= 2;
+  }
+  // More copies than iterations would never run the unrolled loop
+  if (trips) factor = static_cast<uint32_t>(std::min<uint64_t>(factor, *trips));
+  return {std::max(factor, 1u), false};
+}
+
+static_assert(planUnroll(4, 5, std::nullopt, false).full);
+static_assert(planUnroll(100, 5, std::nullopt, false).factor == 1);
+static_assert(planUnroll(100, 5, std::nullopt, true).factor == DEFAULT_UNROLL_FACTOR);
+static_assert(planUnroll(std::nullopt, 5, 8, false).factor == 8);
+static_assert(planUnroll(4, 5, 1, true).factor == 1);
+
+} // namespace codegen
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ast/scopes/types.hpp"
+#include "dbg/logger.hpp"
+
+namespace codegen
+{
+
+// SSE2 is part of x86-64 and always used, AVX2 only with -mavx2
+constexpr scopes::byteSize_t SSE2_VECTOR_BYTES = 16;
+constexpr scopes::byteSize_t AVX2_VECTOR_BYTES = 32;
+constexpr uint8_t VECTOR_REGISTER_COUNT = 16;
+
+constexpr scopes::byteSize_t vectorBytes(bool avx2) { return avx2 ? AVX2_VECTOR_BYTES : SSE2_VECTOR_BYTES; }
+
+// Global arrays spanning a vector start on a vector boundary
+constexpr scopes::byteSize_t arrayAlignment(scopes::byteSize_t byteSize, scopes::byteSize_t elementAlignment) {
+  return byteSize >= SSE2_VECTOR_BYTES && elementAlignment < SSE2_VECTOR_BYTES ? SSE2_VECTOR_BYTES : elementAlignment;
+}
+
+struct VectorizationDecision {
+  std::string function;
+  bool vectorized;
+  // Elements handled by an iteration of the vector loop, 0 when the analysis stopped before the element type was known
+  uint32_t lanes;
+  const char *reason;
+};
+
+// Counted loops reading or writing arrays, vectorized or kept scalar (see LoopVectorizer)
+struct VectorizationReport {
+  std::vector<VectorizationDecision> decisions;
+
+  void logDebug() const {
+    for (const auto &decision : decisions) {
+      LOG_DEBUG("[Vectorizer] " << decision.function << " ; " << (decision.vectorized ? "vectorized" : "kept scalar")
+                << " (" << decision.reason << ") ; lanes="
+                << (decision.lanes ? std::to_string(decision.lanes) : std::string("n/a")));
+    }
+  }
+};
+
+} // namespace codegen
@@ -37,26 +37,86 @@ public:
     getOrCreateTranslationUnit().debug(0);
   }
 
+  void debugInlining()
+  {
+    _inlineReport.logDebug();
+  }
+
+  void debugSpecialization()
+  {
+    _specializationReport.logDebug();
+  }
+
+  void debugConstantEvaluation()
+  {
+    _constantEvaluationReport.logDebug();
+  }
+
+  void debugClassLayout()
+  {
+    getOrCreateTranslationUnit().classLayouts().logDebug();
+  }
+
+  void dumpClassLayout(std::ostream &os)
+  {
+    decorate();
+    getOrCreateTranslationUnit().classLayouts().print(os);
+  }
+
   void debugScopeStack()
   {
     _scopeStack->logDebug();
   }
 
-  void decorate()
+  void debugRegisterAllocation()
+  {
+    getOrCreateTranslationUnit().debugRegisterAllocation();
+  }
+
+  void decorate(const ast::ConstantEvaluationOptions &options = {})
   {
     if (_scopeStack) return;
 
     parseIfNeeded();
+    _inlineReport = getOrCreateTranslationUnit().inlineCalls();
+    _specializationReport = getOrCreateTranslationUnit().specializeCalls();
     _scopeStack = std::make_unique<scopes::ScopeStack>();
     getOrCreateTranslationUnit().decorate(*_scopeStack, _scopeStack->rootScope());
+    _constantEvaluationReport = getOrCreateTranslationUnit().evaluateConstantCalls(options);
+    getOrCreateTranslationUnit().hoistLoopInvariants(*_scopeStack);
+  }
+
+  void allocateRegisters()
+  {
+    decorate();
+    getOrCreateTranslationUnit().allocateRegisters();
   }
 
-  std::string genAsm_x86_64()
+  std::string genAsm_x86_64(const codegen::CodegenOptions &options = {})
   {
     const auto &translationUnit = getOrCreateTranslationUnit();
     DEBUG_ASSERT(translationUnit.isDecorated(), "Translation unit is not decorated!");
-    codegen::NasmGenerator_x86_64 codeGenerator;
-    return translationUnit.genAsm_x86_64(codeGenerator);
+    codegen::NasmGenerator_x86_64 codeGenerator(options);
+    auto generatedAsm = translationUnit.genAsm_x86_64(codeGenerator);
+    _peepholeStats = codeGenerator.getPeepholeStats();
+    _stringPoolStats = codeGenerator.getStringPoolStats();
+    _vectorizationReport = codeGenerator.getVectorizationReport();
+    return generatedAsm;
+  }
+
+  void debugPeephole()
+  {
+    _peepholeStats.logDebug();
+  }
+
+  void debugStringPool()
+  {
+    _stringPoolStats.logDebug();
+  }
+
+  void debugVectorization()
+  {
+    _vectorizationReport.logDebug();
   }
 
 private:
@@ -72,6 +132,12 @@ private:
   std::unique_ptr<parser::Parser> _parser;
   std::unique_ptr<ast::TranslationUnit> _translationUnit;
   std::unique_ptr<scopes::ScopeStack> _scopeStack;
+  ast::InlineReport _inlineReport;
+  ast::SpecializationReport _specializationReport;
+  ast::ConstantEvaluationReport _constantEvaluationReport;
+  codegen::PeepholeStats _peepholeStats;
+  codegen::StringPoolStats _stringPoolStats;
+  codegen::VectorizationReport _vectorizationReport;
 };
 
 }
@@ -20,6 +20,11 @@ struct CompilerOptions {
   bool compileAndAssemble = false;
   bool createSharedLib = false;
   bool fullDebugExec = false;
+  bool omitFramePointer = false;
+  bool unrollLoops = false;
+  bool avx2 = false;
+  bool dumpClassLayout = false;
+  bool optimize = false;
 };
 
 class ArgParser {
@@ -46,6 +51,11 @@ private:
     { "-c", nullptr, nullptr, &CompilerOptions::compileAndAssemble, "Compile and assemble, but do not link." },
     { "-shared", "--shared", nullptr, &CompilerOptions::createSharedLib, "Link as shared library" },
     { "-d", "--debug", nullptr, &CompilerOptions::fullDebugExec, "Full generation with debug logs" },
+    { "-fomit-frame-pointer", nullptr, nullptr, &CompilerOptions::omitFramePointer, "Address locals from rsp, without setting up rbp" },
+    { "-funroll-loops", nullptr, nullptr, &CompilerOptions::unrollLoops, "Unroll counted loops whose trip count is not a small constant" },
+    { "-mavx2", nullptr, nullptr, &CompilerOptions::avx2, "Vectorize loops with 32-byte AVX2 instructions instead of SSE2" },
+    { "-fdump-class-layout", nullptr, nullptr, &CompilerOptions::dumpClassLayout, "Print the size, alignment and field offsets of every class" },
+    { "-O2", nullptr, nullptr, &CompilerOptions::optimize, "Evaluate calls to side-effect-free functions with constant arguments at compile time" },
   };
 
   static constexpr OptionDescription<StringPtrT> stringFlags[] = {
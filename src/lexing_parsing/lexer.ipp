@@ -21,8 +21,15 @@ namespace keywords
   constexpr const char KW_WHILE[] = "while";
   constexpr const char KW_DO[] = "do";
   constexpr const char KW_FOR[] = "for";
+  constexpr const char KW_SWITCH[] = "switch";
+  constexpr const char KW_CASE[] = "case";
+  constexpr const char KW_DEFAULT[] = "default";
+  constexpr const char KW_BREAK[] = "break";
   constexpr const char KW_RETURN[] = "return";
   constexpr const char KW_EXTERN[] = "extern";
+  constexpr const char KW_INLINE[] = "inline";
+  constexpr const char KW_CONSTEXPR[] = "constexpr";
+  constexpr const char KW_CONST[] = "const";
   constexpr const char KW_CLASS[] = "class";
   constexpr const char KW_PUBLIC[] = "public";
   constexpr const char KW_PROTECTED[] = "protected";
@@ -49,8 +56,15 @@ namespace keywords
     X(TT_K_WHILE, "TT_K_WHILE") \
     X(TT_K_DO, "TT_K_DO") \
     X(TT_K_FOR, "TT_K_FOR") \
+    X(TT_K_SWITCH, "TT_K_SWITCH") \
+    X(TT_K_CASE, "TT_K_CASE") \
+    X(TT_K_DEFAULT, "TT_K_DEFAULT") \
+    X(TT_K_BREAK, "TT_K_BREAK") \
     X(TT_K_RETURN, "TT_K_RETURN") \
     X(TT_K_EXTERN, "TT_K_EXTERN") \
+    X(TT_K_INLINE, "TT_K_INLINE") \
+    X(TT_K_CONSTEXPR, "TT_K_CONSTEXPR") \
+    X(TT_K_CONST, "TT_K_CONST") \
     X(TT_K_CLASS, "TT_K_CLASS") \
     X(TT_K_PUBLIC, "TT_K_PUBLIC") \
     X(TT_K_PROTECTED, "TT_K_PROTECTED") \
@@ -65,6 +79,7 @@ namespace keywords
     X(TT_MINUS, "TT_MINUS") \
     X(TT_STAR, "TT_STAR") \
     X(TT_SLASH, "TT_SLASH") \
+    X(TT_PERCENT, "TT_PERCENT") \
     \
     X(TT_CMP_EQ, "TT_CMP_EQ") \
     X(TT_CMP_NEQ, "TT_CMP_NEQ") \
@@ -73,6 +88,10 @@ namespace keywords
     X(TT_CMP_LT, "TT_CMP_LT") \
     X(TT_CMP_GT, "TT_CMP_GT") \
     \
+    X(TT_LOGICAL_AND, "TT_LOGICAL_AND") \
+    X(TT_LOGICAL_OR, "TT_LOGICAL_OR") \
+    X(TT_BANG, "TT_BANG") \
+    \
     X(TT_LBRACK, "TT_LBRACK") \
     X(TT_RBRACK, "TT_RBRACK") \
     X(TT_LPAR, "TT_LPAR") \
@@ -82,8 +101,10 @@ namespace keywords
     X(TT_DOUBLE_QUOTE, "TT_DOUBLE_QUOTE") \
     \
     X(TT_COMMA, "TT_COMMA") \
+    X(TT_DOT, "TT_DOT") \
     X(TT_COLON, "TT_COLON") \
     X(TT_SEMI, "TT_SEMI") \
+    X(TT_HASH, "TT_HASH") \
     \
     X(TT_END, "TT_END")
 
@@ -166,7 +187,7 @@ public:
       char current = peek();
 
       if (std::isdigit(current)) return number();
-      if (std::isalpha(current)) return identifier();
+      if (std::isalpha(current) || current == '_') return identifier();
 
       if (auto doubleChar = peekDoubleCharOperation()) {
         _pos += 2;
@@ -178,6 +199,8 @@ public:
       if (current == '-') return createToken(TT_MINUS, std::string_view(_content.data()+_pos++, 1));
       if (current == '*') return createToken(TT_STAR, std::string_view(_content.data()+_pos++, 1));
       if (current == '/') return createToken(TT_SLASH, std::string_view(_content.data()+_pos++, 1));
+      if (current == '%') return createToken(TT_PERCENT, std::string_view(_content.data()+_pos++, 1));
+      if (current == '!') return createToken(TT_BANG, std::string_view(_content.data()+_pos++, 1));
 
       if (current == '<') return createToken(TT_CMP_LT, std::string_view(_content.data()+_pos++, 1));
       if (current == '>') return createToken(TT_CMP_GT, std::string_view(_content.data()+_pos++, 1));
@@ -190,8 +213,10 @@ public:
       if (current == '}') return createToken(TT_RCURL, std::string_view(_content.data()+_pos++, 1));
 
       if (current == ',') return createToken(TT_COMMA, std::string_view(_content.data()+_pos++, 1));
+      if (current == '.') return createToken(TT_DOT, std::string_view(_content.data()+_pos++, 1));
       if (current == ':') return createToken(TT_COLON, std::string_view(_content.data()+_pos++, 1));
       if (current == ';') return createToken(TT_SEMI, std::string_view(_content.data()+_pos++, 1));
+      if (current == '#') return createToken(TT_HASH, std::string_view(_content.data()+_pos++, 1));
 
       if (current == '"') return createToken(TT_DOUBLE_QUOTE, std::string_view(_content.data()+_pos++, 1));
 
@@ -258,10 +283,13 @@ private:
     char cur = peek<0>();
     char nxt = peek<1>();
 
-    if (cur == '=' && nxt == '=') return createToken(TT_CMP_EQ, std::string_view(_content.data()+_pos++, 2));
-    if (cur == '!' && nxt == '=') return createToken(TT_CMP_NEQ, std::string_view(_content.data()+_pos++, 2));
-    if (cur == '<' && nxt == '=') return createToken(TT_CMP_LEQ, std::string_view(_content.data()+_pos++, 2));
-    if (cur == '>' && nxt == '=') return createToken(TT_CMP_GEQ, std::string_view(_content.data()+_pos++, 2));
+    // The caller moves past both characters
+    if (cur == '=' && nxt == '=') return createToken(TT_CMP_EQ, std::string_view(_content.data()+_pos, 2));
+    if (cur == '!' && nxt == '=') return createToken(TT_CMP_NEQ, std::string_view(_content.data()+_pos, 2));
+    if (cur == '<' && nxt == '=') return createToken(TT_CMP_LEQ, std::string_view(_content.data()+_pos, 2));
+    if (cur == '>' && nxt == '=') return createToken(TT_CMP_GEQ, std::string_view(_content.data()+_pos, 2));
+    if (cur == '&' && nxt == '&') return createToken(TT_LOGICAL_AND, std::string_view(_content.data()+_pos, 2));
+    if (cur == '|' && nxt == '|') return createToken(TT_LOGICAL_OR, std::string_view(_content.data()+_pos, 2));
 
     return std::nullopt;
   }
@@ -278,7 +306,7 @@ private:
   Token identifier()
   {
     auto start = _content.begin() + _pos;
-    auto end = std::find_if(start, _content.end(), [](char c) { return !std::isalnum(c); });
+    auto end = std::find_if(start, _content.end(), [](char c) { return !std::isalnum(c) && c != '_'; });
     std::string_view value(&*start, std::distance(start, end));
     _pos += value.size();
 
@@ -287,8 +315,15 @@ private:
     if (value == keywords::KW_WHILE) return createToken(TT_K_WHILE, keywords::KW_WHILE);
     if (value == keywords::KW_DO) return createToken(TT_K_DO, keywords::KW_DO);
     if (value == keywords::KW_FOR) return createToken(TT_K_FOR, keywords::KW_FOR);
+    if (value == keywords::KW_SWITCH) return createToken(TT_K_SWITCH, keywords::KW_SWITCH);
+    if (value == keywords::KW_CASE) return createToken(TT_K_CASE, keywords::KW_CASE);
+    if (value == keywords::KW_DEFAULT) return createToken(TT_K_DEFAULT, keywords::KW_DEFAULT);
+    if (value == keywords::KW_BREAK) return createToken(TT_K_BREAK, keywords::KW_BREAK);
     if (value == keywords::KW_RETURN) return createToken(TT_K_RETURN, keywords::KW_RETURN);
     if (value == keywords::KW_EXTERN) return createToken(TT_K_EXTERN, keywords::KW_EXTERN);
+    if (value == keywords::KW_INLINE) return createToken(TT_K_INLINE, keywords::KW_INLINE);
+    if (value == keywords::KW_CONSTEXPR) return createToken(TT_K_CONSTEXPR, keywords::KW_CONSTEXPR);
+    if (value == keywords::KW_CONST) return createToken(TT_K_CONST, keywords::KW_CONST);
     if (value == keywords::KW_CLASS) return createToken(TT_K_CLASS, keywords::KW_CLASS);
     if (value == keywords::KW_PUBLIC) return createToken(TT_K_PUBLIC, keywords::KW_PUBLIC);
     if (value == keywords::KW_PROTECTED) return createToken(TT_K_PROTECTED, keywords::KW_PROTECTED);
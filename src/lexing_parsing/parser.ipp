@@ -1,8 +1,10 @@
 #pragma once
 
+#include <algorithm>
 #include <fstream>
 #include <functional>
 #include <optional>
+#include <set>
 
 #include "ast/scopes/registers.hpp"
 #include "dbg/logger.hpp"
@@ -30,6 +32,7 @@ public:
     std::vector<ast::FunctionDeclaration> funcDeclarations{};
     std::vector<ast::Function> funcList{};
     std::vector<ast::Class> classList{};
+    std::vector<ast::GlobalVariable> globalList{};
     nextToken();
     while (_currentToken.type != TT_END)
     {
@@ -39,11 +42,11 @@ public:
       else if (_currentToken.type == lexer::TT_K_EXTERN)
         funcDeclarations.emplace_back(parseFunctionDeclaration());
       else
-        funcList.emplace_back(parseFunction());
+        parseFunctionOrGlobal(funcList, globalList);
     }
     match(TT_END);
 
-    return ast::TranslationUnit(std::move(funcDeclarations), std::move(funcList), std::move(classList));
+    return ast::TranslationUnit(std::move(funcDeclarations), std::move(funcList), std::move(classList), std::move(globalList));
   }
 
 private:
@@ -53,18 +56,48 @@ private:
       case TT_MINUS: return BinOp::SUBSTRACT;
       case TT_STAR: return BinOp::MULTIPLY;
       case TT_SLASH: return BinOp::DIVIDE;
+      case TT_PERCENT: return BinOp::MODULO;
       case TT_CMP_EQ: return BinOp::CMP_EQ;
       case TT_CMP_NEQ: return BinOp::CMP_NEQ;
       case TT_CMP_LEQ: return BinOp::CMP_LEQ;
       case TT_CMP_GEQ: return BinOp::CMP_GEQ;
       case TT_CMP_LT: return BinOp::CMP_LT;
       case TT_CMP_GT: return BinOp::CMP_GT;
+      case TT_LOGICAL_AND: return BinOp::LOGICAL_AND;
+      case TT_LOGICAL_OR: return BinOp::LOGICAL_OR;
       default: return BinOp::NOT_AN_OPERATION;
     }
   }
 
   static bool isBinaryOp(TokenType op) { return getBinaryOperation(op) != BinOp::NOT_AN_OPERATION; }
 
+  // Higher binds tighter, same order as C++
+  static int getBinaryPrecedence(BinOp op) {
+    switch (op) {
+      case BinOp::MULTIPLY:
+      case BinOp::DIVIDE:
+      case BinOp::MODULO:
+        return 6;
+      case BinOp::ADD:
+      case BinOp::SUBSTRACT:
+        return 5;
+      case BinOp::CMP_LEQ:
+      case BinOp::CMP_GEQ:
+      case BinOp::CMP_LT:
+      case BinOp::CMP_GT:
+        return 4;
+      case BinOp::CMP_EQ:
+      case BinOp::CMP_NEQ:
+        return 3;
+      case BinOp::LOGICAL_AND:
+        return 2;
+      case BinOp::LOGICAL_OR:
+        return 1;
+      default:
+        return 0;
+    }
+  }
+
   inline std::string_view getRawUntil(char breaker)
   {
     std::string_view raw = _lexer.getRawUntil(breaker);
@@ -149,8 +182,10 @@ private:
     return match(TT_IDENT);
   }
 
+  // `const` is only accepted in front: `const char *` is a pointer to const chars, `const int` a read-only int
   ast::Type parseType()
   {
+    bool isConst = maybeMatch(lexer::TT_K_CONST);
     std::string_view pureType = parsePureType();
     int pointerDepth = 0;
     while (_currentToken.type == TT_STAR)
@@ -159,7 +194,18 @@ private:
       pointerDepth++;
     }
 
-    return ast::Type(pureType, pointerDepth);
+    return ast::Type(pureType, pointerDepth, isConst);
+  }
+
+  // `[N]` after the declared name makes the type an array of N elements
+  void parseArrayLength(ast::Type &type)
+  {
+    if (!maybeMatch(TT_LBRACK)) return;
+    auto position = _currentToken.position;
+    auto length = parseNumberLiteral().getValue();
+    USER_ASSERT(length > 0 && length <= INT32_MAX, "Array length must be between 1 and " << INT32_MAX, position);
+    match(TT_RBRACK);
+    type.setArrayLength(static_cast<uint32_t>(length));
   }
 
   ast::FunctionDeclaration parseFunctionDeclaration()
@@ -172,19 +218,94 @@ private:
     return ast::FunctionDeclaration(isExtern, std::move(returnType), name, std::move(parametersNode));
   }
 
-  ast::Function parseFunction()
+  // Both start with specifiers, a type and a name: only the next token tells a definition of a function from one of a
+  // global variable
+  void parseFunctionOrGlobal(std::vector<ast::Function> &functions, std::vector<ast::GlobalVariable> &globals)
   {
     // TODO use parseFunctionDeclaration
-    ast::Type returnType = parseType();
+    bool isConstexpr = false;
+    ast::InlineHint inlineHint = parseInlineHint(isConstexpr);
+    ast::Type type = parseType();
     std::string_view name = match(TT_IDENT);
-    ast::FunctionParameterList parametersNode = parseFunctionParams();
-    ast::CodeBlock body = parseCodeBlock();
-    return ast::Function(std::move(returnType), name, std::move(parametersNode), std::move(body));
+    if (_currentToken.type == TT_LPAR)
+    {
+      ast::FunctionParameterList parametersNode = parseFunctionParams();
+      ast::CodeBlock body = parseCodeBlock();
+      functions.emplace_back(std::move(type), name, std::move(parametersNode), std::move(body), inlineHint, isConstexpr);
+      return;
+    }
+
+    parseArrayLength(type);
+    // constexpr variables are const
+    if (isConstexpr) type.setConst();
+    std::optional<ast::Expression> initializer = std::nullopt;
+    if (maybeMatch(TT_EQUAL)) initializer.emplace(parseExpression());
+    match(TT_SEMI);
+    globals.emplace_back(std::move(type), ast::Variable(std::move(name)), std::move(initializer));
+  }
+
+  // `inline`, `constexpr` and [[...]] attribute lists, in any order. Only gnu::always_inline and gnu::noinline mean
+  // something, other attributes are ignored.
+  ast::InlineHint parseInlineHint(bool &isConstexpr)
+  {
+    ast::InlineHint hint = ast::InlineHint::NONE;
+    while (true)
+    {
+      if (maybeMatch(TT_K_INLINE))
+      {
+        if (hint == ast::InlineHint::NONE) hint = ast::InlineHint::INLINE;
+        continue;
+      }
+      if (maybeMatch(lexer::TT_K_CONSTEXPR))
+      {
+        isConstexpr = true;
+        continue;
+      }
+      if (_currentToken.type != TT_LBRACK) return hint;
+
+      parseAttributeSpecifier([&hint](std::string_view attributeNamespace, std::string_view attribute) {
+        if (attributeNamespace == "gnu" && attribute == "always_inline") hint = ast::InlineHint::ALWAYS;
+        if (attributeNamespace == "gnu" && attribute == "noinline") hint = ast::InlineHint::NEVER;
+      });
+    }
+  }
+
+  // [[ns::attribute, attribute]]: every attribute is handed to onAttribute, with an empty namespace when it has none
+  template <typename F>
+  void parseAttributeSpecifier(F &&onAttribute)
+  {
+    match(TT_LBRACK);
+    match(TT_LBRACK);
+    while (_currentToken.type != TT_RBRACK)
+    {
+      std::string_view attribute = match(TT_IDENT);
+      std::string_view attributeNamespace{};
+      if (maybeMatch(TT_COLON))
+      {
+        match(TT_COLON);
+        attributeNamespace = attribute;
+        attribute = match(TT_IDENT);
+      }
+      onAttribute(attributeNamespace, attribute);
+      if (_currentToken.type != TT_RBRACK) match(TT_COMMA);
+    }
+    match(TT_RBRACK);
+    match(TT_RBRACK);
   }
 
+  // class [[zpp::reorder]] Name { ... }; the attribute lets the fields be laid out in another order than declared
   ast::Class parseClass() {
     match(TT_K_CLASS);
+    bool reorder = false;
+    while (_currentToken.type == TT_LBRACK)
+    {
+      parseAttributeSpecifier([&reorder](std::string_view attributeNamespace, std::string_view attribute) {
+        if (attributeNamespace == "zpp" && attribute == "reorder") reorder = true;
+      });
+    }
     std::string_view name = match(TT_IDENT);
+    // Known before the body: a class can not contain itself, but later statements declare objects of it
+    _classNames.insert(name);
     match(TT_LCURL);
 
     ast::Class::MethodList methods;
@@ -209,7 +330,7 @@ private:
     match(TT_RCURL);
     match(TT_SEMI);
 
-    return ast::Class(name, std::move(attributes), std::move(methods));
+    return ast::Class(name, std::move(attributes), std::move(methods), reorder);
   }
 
   ast::FunctionParameter parseSingleParam()
@@ -250,7 +371,7 @@ private:
     match(TT_RPAR);
 
     // TODO: should be statement
-    ast::CodeBlock body = parseCodeBlock();
+    ast::CodeBlock body = parseBreakableBody();
 
     return ast::WhileStatement(std::move(condition), std::move(body));
   }
@@ -259,7 +380,7 @@ private:
     match(TT_K_DO);
 
     // TODO: should be statement
-    ast::CodeBlock body = parseCodeBlock();
+    ast::CodeBlock body = parseBreakableBody();
 
     match(TT_K_WHILE);
     match(TT_LPAR);
@@ -269,7 +390,29 @@ private:
     return ast::DoStatement(std::move(expr), std::move(body));
   }
 
-  ast::ForStatement parseForStatement() {
+  // `#pragma unroll [N]` or `#pragma GCC unroll N`, for the loop that follows. Other pragmas are ignored.
+  std::optional<uint32_t> parsePragma()
+  {
+    size_t line = _currentToken.position.lineCount;
+    match(TT_HASH);
+    matchIdent("pragma");
+    auto onPragmaLine = [this, line]() { return _currentToken.type != TT_END && _currentToken.position.lineCount == line; };
+
+    if (onPragmaLine() && _currentToken.value == "GCC") match(TT_IDENT);
+    if (!onPragmaLine() || _currentToken.value != "unroll")
+    {
+      while (onPragmaLine()) nextToken();
+      return std::nullopt;
+    }
+    match(TT_IDENT);
+
+    if (!onPragmaLine()) return codegen::UNROLL_FULL;
+    auto count = parseNumberLiteral().getValue();
+    // 0 and 1 both disable unrolling
+    return static_cast<uint32_t>(std::clamp<uint64_t>(count, 1, codegen::UNROLL_FULL - 1));
+  }
+
+  ast::ForStatement parseForStatement(std::optional<uint32_t> unrollCount = std::nullopt) {
     // TODO: for (for-range-declaration : expression) statement
     match(TT_K_FOR);
     match(TT_LPAR);
@@ -287,9 +430,60 @@ private:
     match(TT_RPAR);
 
     // TODO: should be statement
+    auto body = parseBreakableBody();
+
+    return ast::ForStatement(std::move(initStatement), std::move(condition), std::move(expr), std::move(body), unrollCount);
+  }
+
+  ast::CodeBlock parseBreakableBody() {
+    _breakableDepth++;
     auto body = parseCodeBlock();
+    _breakableDepth--;
+    return body;
+  }
+
+  int32_t parseCaseValue() {
+    // Converted to the promoted type of the condition (int)
+    bool negative = maybeMatch(TT_MINUS);
+    auto number = parseNumberLiteral().getValue();
+    return static_cast<int32_t>(negative ? -number : number);
+  }
+
+  ast::SwitchStatement parseSwitchStatement() {
+    match(TT_K_SWITCH);
+    match(TT_LPAR);
+    ast::Expression condition = parseCondition();
+    match(TT_RPAR);
+    match(TT_LCURL);
 
-    return ast::ForStatement(std::move(initStatement), std::move(condition), std::move(expr), std::move(body));
+    std::vector<ast::Statement> statements;
+    std::vector<ast::SwitchStatement::CaseLabel> labels;
+    _breakableDepth++;
+    while (_currentToken.type != TT_RCURL)
+    {
+      auto position = _currentToken.position;
+      if (maybeMatch(TT_K_CASE)) {
+        int32_t value = parseCaseValue();
+        bool duplicate = std::ranges::any_of(labels, [value](const auto &label) { return label.value == value; });
+        USER_ASSERT(!duplicate, "Duplicate case value " << value, position);
+        labels.push_back({value, statements.size()});
+        match(TT_COLON);
+        continue;
+      }
+      if (maybeMatch(TT_K_DEFAULT)) {
+        bool duplicate = std::ranges::any_of(labels, [](const auto &label) { return !label.value; });
+        USER_ASSERT(!duplicate, "Multiple default labels in one switch", position);
+        labels.push_back({std::nullopt, statements.size()});
+        match(TT_COLON);
+        continue;
+      }
+      statements.push_back(parseStatement());
+      maybeMatch(TT_SEMI);
+    }
+    _breakableDepth--;
+    match(TT_RCURL);
+
+    return ast::SwitchStatement(std::move(condition), ast::CodeBlock(std::move(statements)), std::move(labels));
   }
 
   ast::FunctionParameterList parseFunctionParams()
@@ -300,11 +494,13 @@ private:
     return ast::FunctionParameterList(std::move(functionParams));
   }
 
-  scopes::Register parseRegisterName()
+  // Operands and clobbers may name any register a variable can live in: rsp and rbp hold the frame
+  scopes::Register parseAsmRegisterName(std::string_view raw)
   {
-    std::string_view raw = parseRawSingleStringLiteral();
-    USER_ASSERT(raw[0] == '=', "Only ={register} identifiers are supported", _currentToken.position);
-    return scopes::strToReg(raw.substr(1));
+    scopes::Register reg = scopes::strToReg(raw);
+    USER_ASSERT(codegen::allocatableRegisters().test(static_cast<size_t>(scopes::getGPRegisterID(reg))),
+                "Register " << raw << " can not be bound or clobbered by inline asm", _currentToken.position);
+    return reg;
   }
 
   // "a" "b" won't work, a single double quoted value is possible here, no escape characters are replaced
@@ -344,6 +540,14 @@ private:
     return ast::NumberLiteral(number);
   }
 
+  // .field.subfield after a variable name
+  std::vector<std::string_view> parseMemberPath()
+  {
+    std::vector<std::string_view> members;
+    while (maybeMatch(lexer::TT_DOT)) members.push_back(match(TT_IDENT));
+    return members;
+  }
+
   ast::Expression parseTerm()
   {
     if (_currentToken.type == TT_IDENT)
@@ -351,18 +555,44 @@ private:
       std::string_view ident = match(TT_IDENT);
       if (_currentToken.type == TT_LPAR) return ast::Expression(parseFunctionCall(ident));
 
-      ast::Variable var = ast::Variable(std::move(ident));
+      ast::Variable var = ast::Variable(std::move(ident), parseMemberPath());
+      if (maybeMatch(TT_LBRACK))
+      {
+        USER_ASSERT(var.getMembers().empty(), "Only arrays declared as variables can be indexed", _currentToken.position);
+        auto index = std::make_unique<ast::Expression>(parseExpression());
+        match(TT_RBRACK);
+        if (!maybeMatch(lexer::TT_EQUAL)) return ast::Expression(ast::Subscript(std::move(var), std::move(index)));
+
+        auto expr = parseExpression();
+        return ast::Expression(ast::Assign(std::move(var), std::move(expr), std::move(index)));
+      }
       if (!maybeMatch(lexer::TT_EQUAL)) return ast::Expression(std::move(var));
 
       auto expr = parseExpression();
       return ast::Expression(ast::Assign(std::move(var), std::move(expr)));
     }
 
+    if (maybeMatch(lexer::TT_LPAR))
+    {
+      auto expr = parseExpression();
+      match(lexer::TT_RPAR);
+      return expr;
+    }
+
+    if (_currentToken.type == lexer::TT_DOUBLE_QUOTE) return ast::Expression(parseStringLiteral());
+
+    if (maybeMatch(lexer::TT_BANG))
+    {
+      auto operand = std::make_unique<ast::Expression>(parseTerm());
+      return ast::Expression(ast::UnaryOperation(ast::UnaryOperation::Operation::LOGICAL_NOT, std::move(operand)));
+    }
+
     auto numberLiteral = parseNumberLiteral();
     return ast::Expression(std::move(numberLiteral));
   }
 
-  ast::Expression parseExpression()
+  // Precedence climbing: operators of the same precedence are left-associative
+  ast::Expression parseExpression(int minPrecedence = 1)
   {
     // Trivial expression
     auto expr = parseTerm();
@@ -371,9 +601,9 @@ private:
     // Composed expression
     auto lhs = std::make_unique<ast::Expression>(std::move(expr));
 
-    for (auto op = getBinaryOperation(_currentToken.type); op != BinOp::NOT_AN_OPERATION; op = getBinaryOperation(_currentToken.type)) {
+    for (auto op = getBinaryOperation(_currentToken.type); getBinaryPrecedence(op) >= minPrecedence; op = getBinaryOperation(_currentToken.type)) {
       nextToken();
-      auto rhs = std::make_unique<ast::Expression>(parseTerm());
+      auto rhs = std::make_unique<ast::Expression>(parseExpression(getBinaryPrecedence(op) + 1));
       lhs = std::make_unique<ast::Expression>(ast::BinaryOperation(op, std::move(lhs), std::move(rhs)));
     }
 
@@ -388,20 +618,42 @@ private:
     return ast::ReturnStatement(std::move(expression));
   }
 
-  ast::InlineAsmStatement::BindingRequest parseBindingRequest()
+  // "reg"(var) as an input, "=reg"(var) or "+reg"(var) as an output
+  ast::InlineAsmStatement::BindingRequest parseBindingRequest(bool output)
   {
-    scopes::Register registerTo = parseRegisterName();
+    using Constraint = ast::InlineAsmStatement::BindingRequest::Constraint;
+    std::string_view raw = parseRawSingleStringLiteral();
+    Constraint constraint = Constraint::INPUT;
+    if (output)
+    {
+      USER_ASSERT(!raw.empty() && (raw[0] == '=' || raw[0] == '+'), "Output operands are written \"={register}\" or \"+{register}\"", _currentToken.position);
+      constraint = raw[0] == '=' ? Constraint::OUTPUT : Constraint::READ_WRITE;
+      raw.remove_prefix(1);
+    }
+    scopes::Register registerTo = parseAsmRegisterName(raw);
     match(lexer::TT_LPAR);
     auto ident = match(TT_IDENT);
+    auto members = parseMemberPath();
     match(lexer::TT_RPAR);
 
     // plain old data
     return {
+      .constraint=constraint,
       .registerTo=registerTo,
-      .varIdentifier=std::string(ident),
+      .variable=ast::Variable(std::move(ident), std::move(members)),
     };
   }
 
+  // Each section may be empty: it ends at the next colon or at the closing parenthesis
+  template <typename T>
+  std::vector<T> parseInlineAsmSection(std::function<T()> parseElement)
+  {
+    if (_currentToken.type == lexer::TT_COLON || _currentToken.type == lexer::TT_RPAR) return {};
+    return parseSeparatedList<T, lexer::TT_COMMA, TRAILING_FORBIDDEN, TT_NONE>(std::move(parseElement));
+  }
+
+  // asm("code" : outputs : inputs : clobbers), every section being optional. "memory" and "cc" are accepted as
+  // clobbers: no value is kept in memory or in the flags across a statement anyway.
   ast::InlineAsmStatement parseInlineAsmStatement()
   {
     match(lexer::TT_K_ASM);
@@ -410,15 +662,38 @@ private:
     ast::StringLiteral asmBlock = parseStringLiteral();
 
     std::vector<ast::InlineAsmStatement::BindingRequest> requests;
+    std::optional<scopes::RegisterMask> clobbers;
+    scopes::RegisterMask bound[2];
+    for (bool output : {true, false})
+    {
+      if (_currentToken.type != lexer::TT_COLON) break;
+      match(TT_COLON);
+      clobbers = scopes::RegisterMask();
+      for (auto &request : parseInlineAsmSection<ast::InlineAsmStatement::BindingRequest>([this, output]() { return parseBindingRequest(output); }))
+      {
+        auto reg = static_cast<size_t>(scopes::getGPRegisterID(request.registerTo));
+        for (bool written : {true, false})
+        {
+          if (written ? !request.isWritten() : !request.isRead()) continue;
+          USER_ASSERT(!bound[written].test(reg), "Register " << request.registerTo << " is bound to several asm " << (written ? "outputs" : "inputs"), _currentToken.position);
+          bound[written].set(reg);
+        }
+        requests.push_back(std::move(request));
+      }
+    }
     if (_currentToken.type == lexer::TT_COLON)
     {
       match(TT_COLON);
-      requests = parseSeparatedList<ast::InlineAsmStatement::BindingRequest, lexer::TT_COMMA, TRAILING_OPTIONAL, lexer::TT_RPAR>([this](){ return parseBindingRequest(); });
+      for (auto name : parseInlineAsmSection<std::string_view>([this]() { return parseRawSingleStringLiteral(); }))
+      {
+        if (name == "memory" || name == "cc") continue;
+        *clobbers |= scopes::toMask(scopes::getGPRegisterID(parseAsmRegisterName(name)));
+      }
     }
 
     match(lexer::TT_RPAR);
 
-    return ast::InlineAsmStatement(std::move(asmBlock), std::move(requests));
+    return ast::InlineAsmStatement(std::move(asmBlock), std::move(requests), clobbers);
   }
 
   ast::Instruction parseSingleInstruction()
@@ -429,11 +704,19 @@ private:
         return ast::Instruction(parseReturnStatement());
       case lexer::TT_K_ASM:
         return ast::Instruction(parseInlineAsmStatement());
+      case lexer::TT_K_BREAK:
+        USER_ASSERT(_breakableDepth > 0, "break statement not within a loop or switch", _currentToken.position);
+        match(TT_K_BREAK);
+        return ast::Instruction(ast::BreakStatement());
       case lexer::TT_IDENT:
+        // Without lookahead, a declaration of an object is told apart by its type: classes precede their uses
+        if (_classNames.contains(_currentToken.value)) return ast::Instruction(parseDeclaration());
         return ast::Instruction(parseExpression());
       /* case lexer::TT_K_INT: return ast::Instruction(...); */
       /* case lexer::TT_K_VOID: return ast::Instruction(...); */
       /* ... */
+      case lexer::TT_K_CONST:
+        return ast::Instruction(parseDeclaration());
       #define X(token, str) \
         case token: return ast::Instruction(parseDeclaration());
         PURE_TYPES_TOKEN_LIST
@@ -447,6 +730,7 @@ private:
   {
     ast::Type type = parseType();
     std::string_view name = match(TT_IDENT);
+    parseArrayLength(type);
     if (_currentToken.type == TT_EQUAL)
     {
       match(TT_EQUAL);
@@ -480,6 +764,15 @@ private:
     if (_currentToken.type == TT_K_WHILE) return ast::Statement(parseWhileStatement());
     if (_currentToken.type == TT_K_DO) return ast::Statement(parseDoStatement());
     if (_currentToken.type == TT_K_FOR) return ast::Statement(parseForStatement());
+    if (_currentToken.type == TT_K_SWITCH) return ast::Statement(parseSwitchStatement());
+    if (_currentToken.type == TT_HASH)
+    {
+      auto position = _currentToken.position;
+      auto unrollCount = parsePragma();
+      if (!unrollCount) return parseStatement();
+      USER_ASSERT(_currentToken.type == TT_K_FOR, "#pragma unroll must be followed by a for loop", position);
+      return ast::Statement(parseForStatement(unrollCount));
+    }
     auto statement = ast::Statement(parseSingleInstruction());
     match(lexer::TT_SEMI);
     return statement;
@@ -501,6 +794,9 @@ private:
 private:
   Lexer _lexer;
   Token _currentToken;
+  // Loops and switches being parsed: break is only valid inside one
+  size_t _breakableDepth = 0;
+  std::set<std::string_view> _classNames;
 };
 
 } /* namespace parser */
@@ -10,6 +10,20 @@
 #include "dbg/iohelper.hpp"
 #include "ast/nodes/nodes.ipp"
 
+static inline codegen::CodegenOptions getCodegenOptions(const argparse::CompilerOptions &options) {
+  return codegen::CodegenOptions{
+    .omitFramePointer = options.omitFramePointer,
+    .unrollLoops = options.unrollLoops,
+    .avx2 = options.avx2,
+  };
+}
+
+static inline ast::ConstantEvaluationOptions getConstantEvaluationOptions(const argparse::CompilerOptions &options) {
+  return ast::ConstantEvaluationOptions{
+    .evaluatePureFunctions = options.optimize,
+  };
+}
+
 static inline int fullDebugExec(argparse::CompilerOptions &options) {
   static constexpr const char *asmFilePath = "./a.asm";
   static constexpr const char *objFilePath = "./a.o";
@@ -22,14 +36,25 @@ static inline int fullDebugExec(argparse::CompilerOptions &options) {
   translationUnitHandle.debug();
   LOG("");
   LOG("== Decorating");
-  translationUnitHandle.decorate();
+  translationUnitHandle.decorate(getConstantEvaluationOptions(options));
+  translationUnitHandle.debugInlining();
+  translationUnitHandle.debugSpecialization();
+  translationUnitHandle.debugConstantEvaluation();
+  translationUnitHandle.debugClassLayout();
   translationUnitHandle.debugScopeStack();
   LOG("");
   LOG("== Done decorating");
   translationUnitHandle.debug();
   LOG("");
+  LOG("== Allocating registers");
+  translationUnitHandle.allocateRegisters();
+  translationUnitHandle.debugRegisterAllocation();
+  LOG("");
   LOG("== Generating code");
-  std::string generatedAsm = translationUnitHandle.genAsm_x86_64();
+  std::string generatedAsm = translationUnitHandle.genAsm_x86_64(getCodegenOptions(options));
+  translationUnitHandle.debugPeephole();
+  translationUnitHandle.debugStringPool();
+  translationUnitHandle.debugVectorization();
   LOG("== Generated asm to a.asm:");
   std::cout << generatedAsm;
   utils::fs::safeOfStream(asmFilePath) << generatedAsm;
@@ -57,8 +82,12 @@ int main(int argc, char** argv)
   }
 
   auto tu = core::TranslationUnitHandle(options.inputFiles.at(0));
-  tu.decorate();
-  auto generatedAsm = tu.genAsm_x86_64();
+  tu.decorate(getConstantEvaluationOptions(options));
+  if (options.dumpClassLayout) {
+    tu.dumpClassLayout(std::cout);
+  }
+  tu.allocateRegisters();
+  auto generatedAsm = tu.genAsm_x86_64(getCodegenOptions(options));
 
   if (options.compileOnly) {
     utils::fs::safeOfStream(options.outputFile) << generatedAsm;
@@ -5,17 +5,75 @@ section .rodata
 section .bss
 
 section .text
+
 	global print:function
+	global printnum:function
+
 
 print:
 ;-- START -- asm binding requests
-	mov rsi, rax
+	mov rsi, rdi
 ;-- START -- user defined
-	mov rax, 1			; syscall number for write
-	mov rdi, 1			; fd = 1 (stdout)
-	; mov rsi, ?			; put the string pointer into rsi (already done)
-	mov rdx, 5
+	mov rdi, rsi            ; Aligned block holding the first byte
+	and rdi, -16
+	mov ecx, esi
+	and ecx, 15             ; Bytes of the block before the string
+	pxor xmm0, xmm0
+	movdqa xmm1, [rdi]
+	pcmpeqb xmm1, xmm0      ; 0xFF for each NUL byte
+	pmovmskb edx, xmm1
+	shr edx, cl
+	shl edx, cl
+	test edx, edx
+	jnz .found
+.next_block:
+	add rdi, 16
+	movdqa xmm1, [rdi]
+	pcmpeqb xmm1, xmm0
+	pmovmskb edx, xmm1
+	test edx, edx
+	jz .next_block
+.found:
+	bsf edx, edx            ; First NUL byte of the block
+	add rdx, rdi
+	sub rdx, rsi            ; Length of the string
+	mov eax, 1              ; syscall number for write
+	mov edi, 1              ; fd = 1 (stdout)
 	syscall
 
 ;-- END -- user defined
+._U0_return:
+	ret
+printnum:
+	push rbx
+;-- START -- asm binding requests
+	mov eax, edi
+;-- START -- user defined
+	mov rsi, rsp            ; Use stack as buffer
+	sub rsi, 32             ; Move buffer to a safe place
+	mov byte [rsi], 0       ; Null-terminate
+	mov rbx, 10             ; Divisor
+	mov rcx, rsi            ; RCX will point to the current position in the buffer
+	; Convert number to string in reverse
+.reverse_loop:
+	xor rdx, rdx            ; Clear rdx for division
+	div rbx                 ; RAX / 10, result in RAX, remainder in RDX
+	add dl, '0'             ; Convert remainder to ASCII
+	dec rcx                 ; Move back in the buffer
+	mov [rcx], dl           ; Store the character
+	test rax, rax           ; Check if quotient is zero
+	jnz .reverse_loop        ; Continue if not zero
+	dec rcx                 ; Move back in the buffer
+	mov byte [rcx], 0x0A     ; newline
+	; Prepare to call write
+	mov rdx, rsi            ; End of string position
+	sub rdx, rcx            ; Calculate length of the string
+	mov rsi, rcx            ; String start position
+	mov rdi, 1              ; File descriptor 1 (stdout)
+	mov eax, 1              ; Syscall number (sys_write)
+	syscall                 ; Perform syscall
+
+;-- END -- user defined
+._U1_return:
+	pop rbx
 	ret
@@ -7,27 +7,49 @@
 //   );
 // }
 
-// void strlen(const char *) {}
-
 void print(char *str) // not in the C nor C++ standard, just useful for us...
 {
   // later will be something like this
   // return write(0, message, strlen(str));
 
   asm(
-    "\tmov rax, 1\t\t\t; syscall number for write\n"
-    "\tmov rdi, 1\t\t\t; fd = 1 (stdout)\n"
-    "\t; mov rsi, ?\t\t\t; put the string pointer into rsi (already done)\n"
-    "\tmov rdx, 5\n" // the size of the str is hardcoded
+    // strlen 16 bytes at a time: aligned loads never cross into the next page, and the first block ignores the bytes
+    // before the string
+    "\tmov rdi, rsi            ; Aligned block holding the first byte\n"
+    "\tand rdi, -16\n"
+    "\tmov ecx, esi\n"
+    "\tand ecx, 15             ; Bytes of the block before the string\n"
+    "\tpxor xmm0, xmm0\n"
+    "\tmovdqa xmm1, [rdi]\n"
+    "\tpcmpeqb xmm1, xmm0      ; 0xFF for each NUL byte\n"
+    "\tpmovmskb edx, xmm1\n"
+    "\tshr edx, cl\n"
+    "\tshl edx, cl\n"
+    "\ttest edx, edx\n"
+    "\tjnz .found\n"
+".next_block:\n"
+    "\tadd rdi, 16\n"
+    "\tmovdqa xmm1, [rdi]\n"
+    "\tpcmpeqb xmm1, xmm0\n"
+    "\tpmovmskb edx, xmm1\n"
+    "\ttest edx, edx\n"
+    "\tjz .next_block\n"
+".found:\n"
+    "\tbsf edx, edx            ; First NUL byte of the block\n"
+    "\tadd rdx, rdi\n"
+    "\tsub rdx, rsi            ; Length of the string\n"
+    "\tmov eax, 1              ; syscall number for write\n"
+    "\tmov edi, 1              ; fd = 1 (stdout)\n"
     "\tsyscall\n"
-    : "=rsi"(str) // ask the compiler to put the char* in the rsi register before doing this code block
+    : // no output
+    : "rsi"(str) // ask the compiler to put the char* in the rsi register before doing this code block
+    : "rax", "rcx", "rdx", "rdi", "r11", "memory" // syscall also overwrites rcx and r11, xmm0 and xmm1 are caller-saved
   );
 }
 
 void printnum(int num) {
   asm(
     // nasm elf64 asm here
-    "\tmov rax, rdi            ; currently, rdi is the first argument register\n"
     "\tmov rsi, rsp            ; Use stack as buffer\n"
     "\tsub rsi, 32             ; Move buffer to a safe place\n"
     "\tmov byte [rsi], 0       ; Null-terminate\n"
@@ -51,6 +73,8 @@ void printnum(int num) {
     "\tmov rdi, 1              ; File descriptor 1 (stdout)\n"
     "\tmov eax, 1              ; Syscall number (sys_write)\n"
     "\tsyscall                 ; Perform syscall\n"
-    : "=rax"(num)
+    :
+    : "rax"(num)
+    : "rbx", "rcx", "rdx", "rsi", "rdi", "r11", "memory"
   );
 }
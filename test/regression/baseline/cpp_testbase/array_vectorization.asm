@@ -0,0 +1,795 @@
+section .data
+
+section .rodata
+
+section .bss
+	alignb 16
+	global a:data 148
+a:
+a.local:
+	resb 148
+	alignb 16
+	global b:data 148
+b:
+b.local:
+	resb 148
+	alignb 16
+	global c:data 148
+c:
+c.local:
+	resb 148
+	alignb 16
+	global small:data 40
+small:
+small.local:
+	resb 40
+
+section .text
+	extern printnum:function
+
+	global sumOf:function
+	global main:function
+	global _start:function
+
+_start:
+	call main
+	mov rdi, rax            ; Exit code (0) expects return of main to be put in rax for now
+	mov rax, 60                  ; Syscall number for exit (60)
+	syscall                      ; Make the syscall
+
+sumOf:
+	xor r10d, r10d
+	xor r11d, r11d
+	movsxd rax, r11d
+	movsxd rcx, edi
+	sub rcx, 3
+	lea rdx, [rel c.local]
+	pxor xmm0, xmm0
+	cmp rax, rcx
+	jge ._U3_for.vector.end
+._U2_for.vector:
+	movdqu xmm1, [rdx+rax*4]
+	paddd xmm0, xmm1
+	add rax, 4
+	cmp rax, rcx
+	jl ._U2_for.vector
+._U3_for.vector.end:
+	mov r11d, eax
+	movdqa xmm1, xmm0
+	psrldq xmm1, 8
+	paddd xmm0, xmm1
+	movdqa xmm1, xmm0
+	psrldq xmm1, 4
+	paddd xmm0, xmm1
+	movd eax, xmm0
+	add r10d, eax
+	cmp r11d, edi
+	jge ._U1_for.end
+._U4_for:
+	mov eax, r11d
+	lea rcx, [rel c.local]
+	mov eax, dword [rcx+rax*4]
+	add eax, r10d
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	cmp r11d, edi
+	jl ._U4_for
+._U1_for.end:
+	mov eax, r10d
+._U0_return:
+	ret
+main:
+	push r12
+	push r13
+	push r14
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 120 ; Creating space on the stack
+	xor r10d, r10d
+._U7_for:
+	mov eax, r10d
+	imul eax, eax, 7
+	movsxd rcx, eax
+	imul rcx, rcx, 1321528399
+	sar rcx, 32
+	sar ecx, 2
+	mov edx, eax
+	shr edx, 31
+	add ecx, edx
+	imul ecx, ecx, 13
+	sub eax, ecx
+	sub eax, 6
+	mov ecx, r10d
+	lea rdx, [rel a.local]
+	mov dword [rdx+rcx*4], eax
+	mov ecx, r10d
+	lea ecx, [rcx+rcx*2]
+	movsxd rdx, ecx
+	imul rdx, rdx, 780903145
+	sar rdx, 32
+	sar edx, 1
+	mov esi, ecx
+	shr esi, 31
+	add edx, esi
+	imul edx, edx, 11
+	sub ecx, edx
+	mov eax, 20 ; Loading number literal
+	sub eax, ecx
+	mov ecx, r10d
+	lea rdx, [rel b.local]
+	mov dword [rdx+rcx*4], eax
+	lea eax, [r10+1]
+	mov r10d, eax
+	cmp r10d, 37
+	jl ._U7_for
+._U6_for.end:
+	mov r12d, 37 ; Loading number literal
+	mov r10d, 3 ; Loading number literal
+	xor r11d, r11d
+	movsxd rax, r11d
+	movsxd rcx, r12d
+	sub rcx, 3
+	lea rdx, [rel c.local]
+	lea rsi, [rel a.local]
+	lea rdi, [rel b.local]
+	mov r8d, r10d
+	movd xmm0, r8d
+	pshufd xmm0, xmm0, 0
+	cmp rax, rcx
+	jge ._U10_for.vector.end
+._U9_for.vector:
+	movdqu xmm1, [rsi+rax*4]
+	movdqu xmm2, [rdi+rax*4]
+	paddd xmm1, xmm2
+	psubd xmm1, xmm0
+	movdqu [rdx+rax*4], xmm1
+	add rax, 4
+	cmp rax, rcx
+	jl ._U9_for.vector
+._U10_for.vector.end:
+	mov r11d, eax
+	cmp r11d, r12d
+	jge ._U8_for.end
+._U11_for:
+	mov eax, r11d
+	lea rcx, [rel a.local]
+	mov eax, dword [rcx+rax*4]
+	mov ecx, r11d
+	lea rdx, [rel b.local]
+	mov ecx, dword [rdx+rcx*4]
+	add eax, ecx
+	sub eax, r10d
+	mov ecx, r11d
+	lea rdx, [rel c.local]
+	mov dword [rdx+rcx*4], eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	cmp r11d, r12d
+	jl ._U11_for
+._U8_for.end:
+	mov edi, dword [rel c.local]
+	call printnum
+	mov edi, dword [rel c.local+144]
+	call printnum
+	mov edi, r12d
+	call sumOf
+	mov edi, eax
+	call printnum
+	mov edi, 6 ; Loading number literal
+	call sumOf
+	mov edi, eax
+	call printnum
+	xor r10d, r10d
+	movsxd rax, r10d
+	movsxd rcx, r12d
+	sub rcx, 3
+	lea rdx, [rel a.local]
+	lea rsi, [rel b.local]
+	lea rdi, [rel c.local]
+	mov r8d, 20
+	movd xmm0, r8d
+	pshufd xmm0, xmm0, 0
+	cmp rax, rcx
+	jge ._U14_for.vector.end
+._U13_for.vector:
+	movdqu xmm1, [rdx+rax*4]
+	movdqu xmm2, [rsi+rax*4]
+	psubd xmm2, xmm0
+	pcmpgtd xmm1, xmm2
+	movdqu xmm2, [rdx+rax*4]
+	pand xmm2, xmm1
+	movdqu xmm3, [rsi+rax*4]
+	movdqu xmm4, [rdx+rax*4]
+	psubd xmm3, xmm4
+	pandn xmm1, xmm3
+	por xmm1, xmm2
+	movdqu [rdi+rax*4], xmm1
+	add rax, 4
+	cmp rax, rcx
+	jl ._U13_for.vector
+._U14_for.vector.end:
+	mov r10d, eax
+	cmp r10d, r12d
+	jge ._U12_for.end
+._U15_for:
+	mov eax, r10d
+	lea rcx, [rel a.local]
+	mov eax, dword [rcx+rax*4]
+	mov ecx, r10d
+	lea rdx, [rel b.local]
+	mov ecx, dword [rdx+rcx*4]
+	sub ecx, 20
+	cmp eax, ecx
+	jle ._U16_else
+	mov eax, r10d
+	lea rcx, [rel a.local]
+	mov eax, dword [rcx+rax*4]
+	mov ecx, r10d
+	lea rdx, [rel c.local]
+	mov dword [rdx+rcx*4], eax
+	jmp ._U17_end_if
+._U16_else:
+	mov eax, r10d
+	lea rcx, [rel b.local]
+	mov eax, dword [rcx+rax*4]
+	mov ecx, r10d
+	lea rdx, [rel a.local]
+	mov ecx, dword [rdx+rcx*4]
+	sub eax, ecx
+	mov ecx, r10d
+	lea rdx, [rel c.local]
+	mov dword [rdx+rcx*4], eax
+._U17_end_if:
+	lea eax, [r10+1]
+	mov r10d, eax
+	cmp r10d, r12d
+	jl ._U15_for
+._U12_for.end:
+	mov edi, r12d
+	call sumOf
+	mov edi, eax
+	call printnum
+	xor r10d, r10d
+	movsxd rax, r10d
+	movsxd rcx, r12d
+	sub rcx, 3
+	lea rdx, [rel a.local]
+	lea rsi, [rel b.local]
+	lea rdi, [rel c.local]
+	pxor xmm0, xmm0
+	mov r8d, 12
+	movd xmm1, r8d
+	pshufd xmm1, xmm1, 0
+	mov r8d, 2
+	movd xmm2, r8d
+	pshufd xmm2, xmm2, 0
+	pcmpeqd xmm3, xmm3
+	mov r8d, 100
+	movd xmm4, r8d
+	pshufd xmm4, xmm4, 0
+	cmp rax, rcx
+	jge ._U20_for.vector.end
+._U19_for.vector:
+	movdqu xmm5, [rdx+rax*4]
+	pcmpeqd xmm5, xmm0
+	movdqa xmm6, xmm1
+	movdqu xmm7, [rsi+rax*4]
+	pcmpgtd xmm6, xmm7
+	movdqa xmm7, xmm2
+	movdqu xmm8, [rdx+rax*4]
+	pcmpgtd xmm7, xmm8
+	pxor xmm7, xmm3
+	pand xmm6, xmm7
+	por xmm5, xmm6
+	movdqa xmm6, xmm4
+	pand xmm6, xmm5
+	movdqu xmm7, [rdi+rax*4]
+	pandn xmm5, xmm7
+	por xmm5, xmm6
+	movdqu [rdi+rax*4], xmm5
+	add rax, 4
+	cmp rax, rcx
+	jl ._U19_for.vector
+._U20_for.vector.end:
+	mov r10d, eax
+	cmp r10d, r12d
+	jge ._U18_for.end
+._U21_for:
+	mov eax, r10d
+	lea rcx, [rel a.local]
+	mov eax, dword [rcx+rax*4]
+	cmp eax, 0
+	je ._U24_logical.skip
+	mov eax, r10d
+	lea rcx, [rel b.local]
+	mov eax, dword [rcx+rax*4]
+	cmp eax, 12
+	jge ._U23_end_if
+	mov eax, r10d
+	lea rcx, [rel a.local]
+	mov eax, dword [rcx+rax*4]
+	cmp eax, 2
+	jl ._U23_end_if
+._U24_logical.skip:
+	mov eax, 100 ; Loading number literal
+	mov ecx, r10d
+	lea rdx, [rel c.local]
+	mov dword [rdx+rcx*4], eax
+._U23_end_if:
+	lea eax, [r10+1]
+	mov r10d, eax
+	cmp r10d, r12d
+	jl ._U21_for
+._U18_for.end:
+	mov edi, r12d
+	call sumOf
+	mov edi, eax
+	call printnum
+	xor r10d, r10d
+	movsxd rax, r10d
+	movsxd rcx, r12d
+	sub rcx, 3
+	lea rdx, [rel c.local]
+	lea rsi, [rel a.local]
+	lea rdi, [rel b.local]
+	mov r8d, 15
+	movd xmm0, r8d
+	pshufd xmm0, xmm0, 0
+	pxor xmm1, xmm1
+	pcmpeqd xmm2, xmm2
+	cmp rax, rcx
+	jge ._U27_for.vector.end
+._U26_for.vector:
+	movdqa xmm3, xmm1
+	movdqu xmm4, [rdi+rax*4]
+	psubd xmm4, xmm0
+	movdqu xmm5, [rsi+rax*4]
+	pcmpgtd xmm4, xmm5
+	psubd xmm3, xmm4
+	movdqa xmm4, xmm1
+	movdqu xmm5, [rsi+rax*4]
+	pcmpeqd xmm5, xmm1
+	pxor xmm5, xmm2
+	pxor xmm5, xmm2
+	psubd xmm4, xmm5
+	paddd xmm3, xmm4
+	movdqu [rdx+rax*4], xmm3
+	add rax, 4
+	cmp rax, rcx
+	jl ._U26_for.vector
+._U27_for.vector.end:
+	mov r10d, eax
+	cmp r10d, r12d
+	jge ._U25_for.end
+._U28_for:
+	mov eax, r10d
+	lea rcx, [rel a.local]
+	mov eax, dword [rcx+rax*4]
+	mov ecx, r10d
+	lea rdx, [rel b.local]
+	mov ecx, dword [rdx+rcx*4]
+	sub ecx, 15
+	cmp eax, ecx
+	setl al
+	movzx eax, al
+	mov ecx, r10d
+	lea rdx, [rel a.local]
+	mov ecx, dword [rdx+rcx*4]
+	test rcx, rcx
+	sete cl
+	movzx ecx, cl
+	add eax, ecx
+	mov ecx, r10d
+	lea rdx, [rel c.local]
+	mov dword [rdx+rcx*4], eax
+	lea eax, [r10+1]
+	mov r10d, eax
+	cmp r10d, r12d
+	jl ._U28_for
+._U25_for.end:
+	mov edi, r12d
+	call sumOf
+	mov edi, eax
+	call printnum
+	xor r10d, r10d
+	lea r11d, [r12-1]
+	movsxd rax, r10d
+	movsxd rcx, r11d
+	sub rcx, 3
+	lea rdx, [rel c.local]
+	lea rsi, [rel a.local]
+	cmp rax, rcx
+	jge ._U31_for.vector.end
+._U30_for.vector:
+	movdqu xmm0, [rsi+rax*4+4]
+	movdqu xmm1, [rsi+rax*4]
+	psubd xmm0, xmm1
+	movdqu [rdx+rax*4], xmm0
+	add rax, 4
+	cmp rax, rcx
+	jl ._U30_for.vector
+._U31_for.vector.end:
+	mov r10d, eax
+	cmp r10d, r11d
+	jge ._U29_for.end
+._U32_for:
+	lea eax, [r10+1]
+	lea rcx, [rel a.local]
+	mov eax, dword [rcx+rax*4]
+	mov ecx, r10d
+	lea rdx, [rel a.local]
+	mov ecx, dword [rdx+rcx*4]
+	sub eax, ecx
+	mov ecx, r10d
+	lea rdx, [rel c.local]
+	mov dword [rdx+rcx*4], eax
+	lea eax, [r10+1]
+	mov r10d, eax
+	cmp r10d, r11d
+	jl ._U32_for
+._U29_for.end:
+	lea edi, [r12-1]
+	call sumOf
+	mov edi, eax
+	call printnum
+	mov r10d, 1000 ; Loading number literal
+	mov r13d, 4294966296 ; Loading number literal
+	xor r14d, r14d
+	xor r11d, r11d
+	movsxd rax, r11d
+	movsxd rcx, r12d
+	sub rcx, 3
+	lea rdx, [rel a.local]
+	lea rsi, [rel b.local]
+	mov edi, 2147483647
+	movd xmm0, edi
+	pshufd xmm0, xmm0, 0
+	mov edi, -2147483648
+	movd xmm1, edi
+	pshufd xmm1, xmm1, 0
+	pxor xmm2, xmm2
+	cmp rax, rcx
+	jge ._U35_for.vector.end
+._U34_for.vector:
+	movdqu xmm3, [rdx+rax*4]
+	movdqa xmm4, xmm3
+	pcmpgtd xmm4, xmm0
+	pxor xmm0, xmm3
+	pand xmm0, xmm4
+	pxor xmm0, xmm3
+	movdqu xmm3, [rsi+rax*4]
+	movdqu xmm4, [rdx+rax*4]
+	psubd xmm3, xmm4
+	movdqa xmm4, xmm1
+	pcmpgtd xmm4, xmm3
+	pxor xmm1, xmm3
+	pand xmm1, xmm4
+	pxor xmm1, xmm3
+	movdqu xmm3, [rdx+rax*4]
+	paddd xmm2, xmm3
+	add rax, 4
+	cmp rax, rcx
+	jl ._U34_for.vector
+._U35_for.vector.end:
+	mov r11d, eax
+	movdqa xmm3, xmm0
+	psrldq xmm3, 8
+	movdqa xmm4, xmm3
+	pcmpgtd xmm4, xmm0
+	pxor xmm0, xmm3
+	pand xmm0, xmm4
+	pxor xmm0, xmm3
+	movdqa xmm3, xmm0
+	psrldq xmm3, 4
+	movdqa xmm4, xmm3
+	pcmpgtd xmm4, xmm0
+	pxor xmm0, xmm3
+	pand xmm0, xmm4
+	pxor xmm0, xmm3
+	movd eax, xmm0
+	mov ecx, r10d
+	cmp ecx, eax
+	cmovg ecx, eax
+	mov r10d, ecx
+	movdqa xmm3, xmm1
+	psrldq xmm3, 8
+	movdqa xmm4, xmm1
+	pcmpgtd xmm4, xmm3
+	pxor xmm1, xmm3
+	pand xmm1, xmm4
+	pxor xmm1, xmm3
+	movdqa xmm3, xmm1
+	psrldq xmm3, 4
+	movdqa xmm4, xmm1
+	pcmpgtd xmm4, xmm3
+	pxor xmm1, xmm3
+	pand xmm1, xmm4
+	pxor xmm1, xmm3
+	movd eax, xmm1
+	mov ecx, r13d
+	cmp ecx, eax
+	cmovl ecx, eax
+	mov r13d, ecx
+	movdqa xmm3, xmm2
+	psrldq xmm3, 8
+	paddd xmm2, xmm3
+	movdqa xmm3, xmm2
+	psrldq xmm3, 4
+	paddd xmm2, xmm3
+	movd eax, xmm2
+	sub r14d, eax
+	cmp r11d, r12d
+	jge ._U33_for.end
+._U36_for:
+	mov eax, r11d
+	lea rcx, [rel a.local]
+	mov eax, dword [rcx+rax*4]
+	cmp eax, r10d
+	jge ._U38_end_if
+	mov eax, r11d
+	lea rcx, [rel a.local]
+	mov eax, dword [rcx+rax*4]
+	mov r10d, eax
+._U38_end_if:
+	mov ecx, r11d
+	lea rdx, [rel b.local]
+	mov ecx, dword [rdx+rcx*4]
+	mov edx, r11d
+	lea rsi, [rel a.local]
+	mov edx, dword [rsi+rdx*4]
+	sub ecx, edx
+	mov eax, r13d
+	cmp eax, ecx
+	jge ._U40_end_if
+	mov eax, r11d
+	lea rcx, [rel b.local]
+	mov eax, dword [rcx+rax*4]
+	mov ecx, r11d
+	lea rdx, [rel a.local]
+	mov ecx, dword [rdx+rcx*4]
+	sub eax, ecx
+	mov r13d, eax
+._U40_end_if:
+	mov ecx, r11d
+	lea rdx, [rel a.local]
+	mov ecx, dword [rdx+rcx*4]
+	mov eax, r14d
+	sub eax, ecx
+	mov r14d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	cmp r11d, r12d
+	jl ._U36_for
+._U33_for.end:
+	mov edi, r10d
+	call printnum
+	mov edi, r13d
+	call printnum
+	mov edi, r14d
+	call printnum
+	mov eax, 5 ; Loading number literal
+	mov byte [rbp-40], al
+	movsx eax, al
+	mov r12d, 1 ; Loading number literal
+	mov eax, 4294967289 ; Loading number literal
+	mov ecx, r12d
+	mov byte [rbp+rcx*1-40], al
+	movsx eax, al
+	mov r10d, 2 ; Loading number literal
+._U42_for:
+	lea eax, [r10-1]
+	movsx eax, byte [rbp+rax*1-40]
+	lea eax, [rax+rax*2]
+	lea ecx, [r10-2]
+	movsx ecx, byte [rbp+rcx*1-40]
+	add eax, ecx
+	mov ecx, r10d
+	mov byte [rbp+rcx*1-40], al
+	movsx eax, al
+	mov eax, r10d
+	mov ecx, r10d
+	mov byte [rbp+rcx*1-80], al
+	movsx eax, al
+	lea eax, [r10+1]
+	mov r10d, eax
+	cmp r10d, 40
+	jl ._U42_for
+._U41_for.end:
+	mov eax, 100 ; Loading number literal
+	mov byte [rbp-80], al
+	movsx eax, al
+	mov eax, 4294967196 ; Loading number literal
+	mov byte [rbp-79], al
+	movsx eax, al
+	movsx edi, byte [rbp-38]
+	call printnum
+	lea edi, [r12+38]
+	movsx edi, byte [rbp+rdi*1-40]
+	call printnum
+	xor r10d, r10d
+	movsxd rax, r10d
+	mov ecx, 1
+	movd xmm0, ecx
+	punpcklbw xmm0, xmm0
+	pshuflw xmm0, xmm0, 0
+	pshufd xmm0, xmm0, 0
+	cmp rax, 25
+	jge ._U45_for.vector.end
+._U44_for.vector:
+	movdqu xmm1, [rbp+rax*1-80]
+	movdqu xmm2, [rbp+rax*1-40]
+	pcmpgtb xmm1, xmm2
+	movdqu xmm2, [rbp+rax*1-40]
+	pand xmm2, xmm1
+	movdqu xmm3, [rbp+rax*1-80]
+	paddb xmm3, xmm0
+	pandn xmm1, xmm3
+	por xmm1, xmm2
+	movdqu [rbp+rax*1-120], xmm1
+	add rax, 16
+	cmp rax, 25
+	jl ._U44_for.vector
+._U45_for.vector.end:
+	mov r10d, eax
+	cmp r10d, 40
+	jge ._U43_for.end
+._U46_for:
+	mov eax, r10d
+	movsx eax, byte [rbp+rax*1-40]
+	mov ecx, r10d
+	movsx ecx, byte [rbp+rcx*1-80]
+	cmp eax, ecx
+	jge ._U47_else
+	mov eax, r10d
+	movsx eax, byte [rbp+rax*1-40]
+	mov ecx, r10d
+	mov byte [rbp+rcx*1-120], al
+	movsx eax, al
+	jmp ._U48_end_if
+._U47_else:
+	mov eax, r10d
+	movsx eax, byte [rbp+rax*1-80]
+	add eax, 1
+	mov ecx, r10d
+	mov byte [rbp+rcx*1-120], al
+	movsx eax, al
+._U48_end_if:
+	lea eax, [r10+1]
+	mov r10d, eax
+	cmp r10d, 40
+	jl ._U46_for
+._U43_for.end:
+	mov r10d, 4294967168 ; Loading number literal
+	xor r11d, r11d
+	movsxd rax, r11d
+	mov ecx, -128
+	movd xmm0, ecx
+	punpcklbw xmm0, xmm0
+	pshuflw xmm0, xmm0, 0
+	pshufd xmm0, xmm0, 0
+	cmp rax, 25
+	jge ._U51_for.vector.end
+._U50_for.vector:
+	movdqu xmm1, [rbp+rax*1-120]
+	movdqa xmm2, xmm0
+	pcmpgtb xmm2, xmm1
+	pxor xmm0, xmm1
+	pand xmm0, xmm2
+	pxor xmm0, xmm1
+	add rax, 16
+	cmp rax, 25
+	jl ._U50_for.vector
+._U51_for.vector.end:
+	mov r11d, eax
+	movdqa xmm1, xmm0
+	psrldq xmm1, 8
+	movdqa xmm2, xmm0
+	pcmpgtb xmm2, xmm1
+	pxor xmm0, xmm1
+	pand xmm0, xmm2
+	pxor xmm0, xmm1
+	movdqa xmm1, xmm0
+	psrldq xmm1, 4
+	movdqa xmm2, xmm0
+	pcmpgtb xmm2, xmm1
+	pxor xmm0, xmm1
+	pand xmm0, xmm2
+	pxor xmm0, xmm1
+	movdqa xmm1, xmm0
+	psrldq xmm1, 2
+	movdqa xmm2, xmm0
+	pcmpgtb xmm2, xmm1
+	pxor xmm0, xmm1
+	pand xmm0, xmm2
+	pxor xmm0, xmm1
+	movdqa xmm1, xmm0
+	psrldq xmm1, 1
+	movdqa xmm2, xmm0
+	pcmpgtb xmm2, xmm1
+	pxor xmm0, xmm1
+	pand xmm0, xmm2
+	pxor xmm0, xmm1
+	movd eax, xmm0
+	movsx eax, al
+	movsx ecx, r10b
+	cmp ecx, eax
+	cmovl ecx, eax
+	mov r10d, ecx
+	cmp r11d, 40
+	jge ._U49_for.end
+._U52_for:
+	mov eax, r11d
+	movsx eax, byte [rbp+rax*1-120]
+	movsx ecx, r10b
+	cmp eax, ecx
+	jle ._U54_end_if
+	mov eax, r11d
+	movsx eax, byte [rbp+rax*1-120]
+	mov r10d, eax
+	movsx eax, r10b
+._U54_end_if:
+	lea eax, [r11+1]
+	mov r11d, eax
+	cmp r11d, 40
+	jl ._U52_for
+._U49_for.end:
+	movsx edi, r10b
+	call printnum
+	mov r10d, 3 ; Loading number literal
+	movsxd rax, r10d
+	lea rcx, [rel small.local]
+	cmp rax, 25
+	jge ._U57_for.vector.end
+._U56_for.vector:
+	movdqu xmm0, [rbp+rax*1-120]
+	movdqu xmm1, [rbp+rax*1-40]
+	paddb xmm0, xmm1
+	movdqu [rcx+rax*1], xmm0
+	add rax, 16
+	cmp rax, 25
+	jl ._U56_for.vector
+._U57_for.vector.end:
+	mov r10d, eax
+	cmp r10d, 40
+	jge ._U55_for.end
+._U58_for:
+	mov eax, r10d
+	movsx eax, byte [rbp+rax*1-120]
+	mov ecx, r10d
+	movsx ecx, byte [rbp+rcx*1-40]
+	add eax, ecx
+	mov ecx, r10d
+	lea rdx, [rel small.local]
+	mov byte [rdx+rcx*1], al
+	movsx eax, al
+	lea eax, [r10+1]
+	mov r10d, eax
+	cmp r10d, 40
+	jl ._U58_for
+._U55_for.end:
+	xor r10d, r10d
+	xor r11d, r11d
+._U60_for:
+	mov ecx, r11d
+	lea rdx, [rel small.local]
+	movsx ecx, byte [rdx+rcx*1]
+	mov eax, r10d
+	lea eax, [rax+rax*2]
+	add eax, ecx
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	cmp r11d, 40
+	jl ._U60_for
+._U59_for.end:
+	mov edi, r10d
+	call printnum
+	xor eax, eax
+._U5_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop r14
+	pop r13
+	pop r12
+	ret
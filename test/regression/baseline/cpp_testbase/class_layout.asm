@@ -0,0 +1,150 @@
+section .data
+
+section .rodata
+
+section .bss
+
+section .text
+	extern printnum:function
+
+	global length:function
+	global main:function
+	global _start:function
+
+_start:
+	call main
+	mov rdi, rax            ; Exit code (0) expects return of main to be put in rax for now
+	mov rax, 60                  ; Syscall number for exit (60)
+	syscall                      ; Make the syscall
+
+length:
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	mov eax, 1 ; Loading number literal
+	mov [rbp-28], eax ; Storing value in memory
+	mov eax, 2 ; Loading number literal
+	mov [rbp-24], eax ; Storing value in memory
+	mov eax, 10 ; Loading number literal
+	mov [rbp-12], eax ; Storing value in memory
+	mov eax, 20 ; Loading number literal
+	mov [rbp-8], eax ; Storing value in memory
+	mov eax, 3 ; Loading number literal
+	mov [rbp-16], al ; Storing value in memory
+	movsx eax, byte [rbp-16] ; Loading value from memory
+	xor r10d, r10d
+	cmp r10d, edi
+	jge ._U2_while.end
+._U1_while:
+	movsx eax, byte [rbp-16] ; Loading value from memory
+	add eax, dword [rbp-28]
+	mov [rbp-28], eax ; Storing value in memory
+	mov eax, [rbp-8] ; Loading value from memory
+	sub eax, 1
+	mov [rbp-8], eax ; Storing value in memory
+	lea eax, [r10+1]
+	mov r10d, eax
+	cmp r10d, edi
+	jl ._U1_while
+._U2_while.end:
+	mov eax, [rbp-12] ; Loading value from memory
+	sub eax, dword [rbp-28]
+	imul eax, eax, 100
+	add eax, dword [rbp-8]
+._U0_return:
+	pop rbp ; Restore the base pointer
+	ret
+length.k3:
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	mov eax, 1 ; Loading number literal
+	mov [rbp-28], eax ; Storing value in memory
+	mov eax, 2 ; Loading number literal
+	mov [rbp-24], eax ; Storing value in memory
+	mov eax, 10 ; Loading number literal
+	mov [rbp-12], eax ; Storing value in memory
+	mov eax, 20 ; Loading number literal
+	mov [rbp-8], eax ; Storing value in memory
+	mov eax, 3 ; Loading number literal
+	mov [rbp-16], al ; Storing value in memory
+	movsx eax, byte [rbp-16] ; Loading value from memory
+	xor r10d, r10d
+	cmp r10d, 3
+	jge ._U5_while.end
+._U4_while:
+	movsx eax, byte [rbp-16] ; Loading value from memory
+	add eax, dword [rbp-28]
+	mov [rbp-28], eax ; Storing value in memory
+	mov eax, [rbp-8] ; Loading value from memory
+	sub eax, 1
+	mov [rbp-8], eax ; Storing value in memory
+	lea eax, [r10+1]
+	mov r10d, eax
+	cmp r10d, 3
+	jl ._U4_while
+._U5_while.end:
+	mov eax, [rbp-12] ; Loading value from memory
+	sub eax, dword [rbp-28]
+	imul eax, eax, 100
+	add eax, dword [rbp-8]
+._U3_return:
+	pop rbp ; Restore the base pointer
+	ret
+main:
+	push r12
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 40 ; Creating space on the stack
+	mov eax, 7 ; Loading number literal
+	mov [rbp-8], al ; Storing value in memory
+	movsx eax, byte [rbp-8] ; Loading value from memory
+	mov eax, 40 ; Loading number literal
+	mov [rbp-16], eax ; Storing value in memory
+	mov eax, 2 ; Loading number literal
+	mov [rbp-7], al ; Storing value in memory
+	movsx eax, byte [rbp-7] ; Loading value from memory
+	movsx eax, byte [rbp-8] ; Loading value from memory
+	add eax, dword [rbp-16]
+	mov [rbp-12], eax ; Storing value in memory
+	movsx edi, byte [rbp-7] ; Loading value from memory
+	add edi, dword [rbp-16]
+	call printnum
+	mov edi, [rbp-12] ; Loading value from memory
+	call printnum
+	mov eax, 5 ; Loading number literal
+	mov [rbp-36], eax ; Storing value in memory
+	mov eax, 6 ; Loading number literal
+	mov [rbp-32], eax ; Storing value in memory
+	mov eax, 1 ; Loading number literal
+	mov [rbp-28], al ; Storing value in memory
+	movsx eax, byte [rbp-28] ; Loading value from memory
+	xor r12d, r12d
+	xor r10d, r10d
+	cmp r10d, 10
+	jge ._U8_while.end
+._U7_while:
+	mov eax, [rbp-36] ; Loading value from memory
+	add eax, r10d
+	mov [rbp-36], eax ; Storing value in memory
+	movsx eax, byte [rbp-28] ; Loading value from memory
+	imul eax, dword [rbp-36]
+	add eax, r12d
+	mov r12d, eax
+	lea eax, [r10+1]
+	mov r10d, eax
+	cmp r10d, 10
+	jl ._U7_while
+._U8_while.end:
+	mov edi, [rbp-36] ; Loading value from memory
+	call printnum
+	mov edi, r12d
+	add edi, dword [rbp-32]
+	call printnum
+	call length.k3
+	mov edi, eax
+	call printnum
+	xor eax, eax
+._U6_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop r12
+	ret
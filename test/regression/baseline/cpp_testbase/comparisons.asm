@@ -17,504 +17,290 @@ _start:
 	syscall                      ; Make the syscall
 
 main:
-	push rbp                 ; Save the base pointer
-	mov rbp, rsp              ; Set base pointer to current stack pointer
-	sub rsp, 4 ; Creating space on the stack
-	mov rax, 5 ; Loading number literal
-	mov [rbp-4], eax ; Storing value in memory
-	sub rsp, 4 ; Creating space on the stack
-	mov rax, 4 ; Loading number literal
-	mov [rbp-8], eax ; Storing value in memory
-	sub rsp, 4 ; Creating space on the stack
-	mov rax, 4 ; Loading number literal
-	mov [rbp-12], eax ; Storing value in memory
-	mov eax, [rbp-4] ; Loading value from memory
-	mov ebx, [rbp-8] ; Loading value from memory
-	cmp rax,rbx
-	sete al
-	test rax,rax
-	jz ._U1_end_if
-	mov rdi, 1 ; Loading number literal
-	call printnum
-._U1_end_if:
-	mov eax, [rbp-4] ; Loading value from memory
-	mov ebx, [rbp-12] ; Loading value from memory
-	cmp rax,rbx
-	sete al
-	test rax,rax
-	jz ._U3_end_if
-	mov rdi, 2 ; Loading number literal
-	call printnum
-._U3_end_if:
-	mov eax, [rbp-4] ; Loading value from memory
-	mov ebx, [rbp-4] ; Loading value from memory
-	cmp rax,rbx
-	sete al
-	test rax,rax
-	jz ._U5_end_if
-	mov rdi, 3 ; Loading number literal
-	call printnum
-._U5_end_if:
-	mov eax, [rbp-4] ; Loading value from memory
-	mov ebx, [rbp-8] ; Loading value from memory
-	cmp rax,rbx
-	setne al
-	test rax,rax
-	jz ._U7_end_if
-	mov rdi, 4 ; Loading number literal
-	call printnum
-._U7_end_if:
-	mov eax, [rbp-4] ; Loading value from memory
-	mov ebx, [rbp-12] ; Loading value from memory
-	cmp rax,rbx
-	setne al
-	test rax,rax
-	jz ._U9_end_if
-	mov rdi, 5 ; Loading number literal
-	call printnum
-._U9_end_if:
-	mov eax, [rbp-4] ; Loading value from memory
-	mov ebx, [rbp-4] ; Loading value from memory
-	cmp rax,rbx
-	setne al
-	test rax,rax
-	jz ._U11_end_if
-	mov rdi, 6 ; Loading number literal
-	call printnum
-._U11_end_if:
-	mov eax, [rbp-4] ; Loading value from memory
-	mov ebx, [rbp-8] ; Loading value from memory
-	cmp rax,rbx
-	setle al
-	test rax,rax
-	jz ._U13_end_if
-	mov rdi, 7 ; Loading number literal
-	call printnum
-._U13_end_if:
-	mov eax, [rbp-4] ; Loading value from memory
-	mov ebx, [rbp-12] ; Loading value from memory
-	cmp rax,rbx
-	setle al
-	test rax,rax
-	jz ._U15_end_if
-	mov rdi, 8 ; Loading number literal
-	call printnum
-._U15_end_if:
-	mov eax, [rbp-4] ; Loading value from memory
-	mov ebx, [rbp-4] ; Loading value from memory
-	cmp rax,rbx
-	setle al
-	test rax,rax
-	jz ._U17_end_if
-	mov rdi, 9 ; Loading number literal
-	call printnum
-._U17_end_if:
-	mov eax, [rbp-4] ; Loading value from memory
-	mov ebx, [rbp-8] ; Loading value from memory
-	cmp rax,rbx
-	setge al
-	test rax,rax
-	jz ._U19_end_if
-	mov rdi, 10 ; Loading number literal
-	call printnum
-._U19_end_if:
-	mov eax, [rbp-4] ; Loading value from memory
-	mov ebx, [rbp-12] ; Loading value from memory
-	cmp rax,rbx
-	setge al
-	test rax,rax
-	jz ._U21_end_if
-	mov rdi, 11 ; Loading number literal
-	call printnum
-._U21_end_if:
-	mov eax, [rbp-4] ; Loading value from memory
-	mov ebx, [rbp-4] ; Loading value from memory
-	cmp rax,rbx
-	setge al
-	test rax,rax
-	jz ._U23_end_if
-	mov rdi, 12 ; Loading number literal
-	call printnum
-._U23_end_if:
-	mov eax, [rbp-4] ; Loading value from memory
-	mov ebx, [rbp-8] ; Loading value from memory
-	cmp rax,rbx
-	setl al
-	test rax,rax
-	jz ._U25_end_if
-	mov rdi, 13 ; Loading number literal
-	call printnum
-._U25_end_if:
-	mov eax, [rbp-4] ; Loading value from memory
-	mov ebx, [rbp-12] ; Loading value from memory
-	cmp rax,rbx
-	setl al
-	test rax,rax
-	jz ._U27_end_if
-	mov rdi, 14 ; Loading number literal
-	call printnum
-._U27_end_if:
-	mov eax, [rbp-4] ; Loading value from memory
-	mov ebx, [rbp-4] ; Loading value from memory
-	cmp rax,rbx
-	setl al
-	test rax,rax
-	jz ._U29_end_if
-	mov rdi, 15 ; Loading number literal
-	call printnum
-._U29_end_if:
-	mov eax, [rbp-4] ; Loading value from memory
-	mov ebx, [rbp-8] ; Loading value from memory
-	cmp rax,rbx
-	setg al
-	test rax,rax
-	jz ._U31_end_if
-	mov rdi, 16 ; Loading number literal
-	call printnum
-._U31_end_if:
-	mov eax, [rbp-4] ; Loading value from memory
-	mov ebx, [rbp-12] ; Loading value from memory
-	cmp rax,rbx
-	setg al
-	test rax,rax
-	jz ._U33_end_if
-	mov rdi, 17 ; Loading number literal
-	call printnum
-._U33_end_if:
-	mov eax, [rbp-4] ; Loading value from memory
-	mov ebx, [rbp-4] ; Loading value from memory
-	cmp rax,rbx
-	setg al
-	test rax,rax
-	jz ._U35_end_if
-	mov rdi, 18 ; Loading number literal
-	call printnum
-._U35_end_if:
-	mov eax, [rbp-8] ; Loading value from memory
-	mov ebx, [rbp-8] ; Loading value from memory
-	cmp rax,rbx
-	sete al
-	test rax,rax
-	jz ._U37_end_if
-	mov rdi, 19 ; Loading number literal
-	call printnum
-._U37_end_if:
-	mov eax, [rbp-8] ; Loading value from memory
-	mov ebx, [rbp-12] ; Loading value from memory
-	cmp rax,rbx
-	sete al
-	test rax,rax
-	jz ._U39_end_if
-	mov rdi, 20 ; Loading number literal
-	call printnum
-._U39_end_if:
-	mov eax, [rbp-8] ; Loading value from memory
-	mov ebx, [rbp-4] ; Loading value from memory
-	cmp rax,rbx
-	sete al
-	test rax,rax
-	jz ._U41_end_if
-	mov rdi, 21 ; Loading number literal
-	call printnum
-._U41_end_if:
-	mov eax, [rbp-8] ; Loading value from memory
-	mov ebx, [rbp-8] ; Loading value from memory
-	cmp rax,rbx
-	setne al
-	test rax,rax
-	jz ._U43_end_if
-	mov rdi, 22 ; Loading number literal
-	call printnum
-._U43_end_if:
-	mov eax, [rbp-8] ; Loading value from memory
-	mov ebx, [rbp-12] ; Loading value from memory
-	cmp rax,rbx
-	setne al
-	test rax,rax
-	jz ._U45_end_if
-	mov rdi, 23 ; Loading number literal
-	call printnum
-._U45_end_if:
-	mov eax, [rbp-8] ; Loading value from memory
-	mov ebx, [rbp-4] ; Loading value from memory
-	cmp rax,rbx
-	setne al
-	test rax,rax
-	jz ._U47_end_if
-	mov rdi, 24 ; Loading number literal
-	call printnum
-._U47_end_if:
-	mov eax, [rbp-8] ; Loading value from memory
-	mov ebx, [rbp-8] ; Loading value from memory
-	cmp rax,rbx
-	setle al
-	test rax,rax
-	jz ._U49_end_if
-	mov rdi, 25 ; Loading number literal
-	call printnum
-._U49_end_if:
-	mov eax, [rbp-8] ; Loading value from memory
-	mov ebx, [rbp-12] ; Loading value from memory
-	cmp rax,rbx
-	setle al
-	test rax,rax
-	jz ._U51_end_if
-	mov rdi, 26 ; Loading number literal
-	call printnum
-._U51_end_if:
-	mov eax, [rbp-8] ; Loading value from memory
-	mov ebx, [rbp-4] ; Loading value from memory
-	cmp rax,rbx
-	setle al
-	test rax,rax
-	jz ._U53_end_if
-	mov rdi, 27 ; Loading number literal
-	call printnum
-._U53_end_if:
-	mov eax, [rbp-8] ; Loading value from memory
-	mov ebx, [rbp-8] ; Loading value from memory
-	cmp rax,rbx
-	setge al
-	test rax,rax
-	jz ._U55_end_if
-	mov rdi, 28 ; Loading number literal
-	call printnum
-._U55_end_if:
-	mov eax, [rbp-8] ; Loading value from memory
-	mov ebx, [rbp-12] ; Loading value from memory
-	cmp rax,rbx
-	setge al
-	test rax,rax
-	jz ._U57_end_if
-	mov rdi, 29 ; Loading number literal
-	call printnum
-._U57_end_if:
-	mov eax, [rbp-8] ; Loading value from memory
-	mov ebx, [rbp-4] ; Loading value from memory
-	cmp rax,rbx
-	setge al
-	test rax,rax
-	jz ._U59_end_if
-	mov rdi, 30 ; Loading number literal
-	call printnum
-._U59_end_if:
-	mov eax, [rbp-8] ; Loading value from memory
-	mov ebx, [rbp-8] ; Loading value from memory
-	cmp rax,rbx
-	setl al
-	test rax,rax
-	jz ._U61_end_if
-	mov rdi, 31 ; Loading number literal
-	call printnum
-._U61_end_if:
-	mov eax, [rbp-8] ; Loading value from memory
-	mov ebx, [rbp-12] ; Loading value from memory
-	cmp rax,rbx
-	setl al
-	test rax,rax
-	jz ._U63_end_if
-	mov rdi, 32 ; Loading number literal
-	call printnum
-._U63_end_if:
-	mov eax, [rbp-8] ; Loading value from memory
-	mov ebx, [rbp-4] ; Loading value from memory
-	cmp rax,rbx
-	setl al
-	test rax,rax
-	jz ._U65_end_if
-	mov rdi, 33 ; Loading number literal
-	call printnum
-._U65_end_if:
-	mov eax, [rbp-8] ; Loading value from memory
-	mov ebx, [rbp-8] ; Loading value from memory
-	cmp rax,rbx
-	setg al
-	test rax,rax
-	jz ._U67_end_if
-	mov rdi, 34 ; Loading number literal
-	call printnum
-._U67_end_if:
-	mov eax, [rbp-8] ; Loading value from memory
-	mov ebx, [rbp-12] ; Loading value from memory
-	cmp rax,rbx
-	setg al
-	test rax,rax
-	jz ._U69_end_if
-	mov rdi, 35 ; Loading number literal
-	call printnum
-._U69_end_if:
-	mov eax, [rbp-8] ; Loading value from memory
-	mov ebx, [rbp-4] ; Loading value from memory
-	cmp rax,rbx
-	setg al
-	test rax,rax
-	jz ._U71_end_if
-	mov rdi, 36 ; Loading number literal
-	call printnum
-._U71_end_if:
-	mov eax, [rbp-12] ; Loading value from memory
-	mov ebx, [rbp-8] ; Loading value from memory
-	cmp rax,rbx
-	sete al
-	test rax,rax
-	jz ._U73_end_if
-	mov rdi, 37 ; Loading number literal
-	call printnum
-._U73_end_if:
-	mov eax, [rbp-12] ; Loading value from memory
-	mov ebx, [rbp-12] ; Loading value from memory
-	cmp rax,rbx
-	sete al
-	test rax,rax
-	jz ._U75_end_if
-	mov rdi, 38 ; Loading number literal
-	call printnum
-._U75_end_if:
-	mov eax, [rbp-12] ; Loading value from memory
-	mov ebx, [rbp-4] ; Loading value from memory
-	cmp rax,rbx
-	sete al
-	test rax,rax
-	jz ._U77_end_if
-	mov rdi, 39 ; Loading number literal
-	call printnum
-._U77_end_if:
-	mov eax, [rbp-12] ; Loading value from memory
-	mov ebx, [rbp-8] ; Loading value from memory
-	cmp rax,rbx
-	setne al
-	test rax,rax
-	jz ._U79_end_if
-	mov rdi, 40 ; Loading number literal
-	call printnum
-._U79_end_if:
-	mov eax, [rbp-12] ; Loading value from memory
-	mov ebx, [rbp-12] ; Loading value from memory
-	cmp rax,rbx
-	setne al
-	test rax,rax
-	jz ._U81_end_if
-	mov rdi, 41 ; Loading number literal
-	call printnum
-._U81_end_if:
-	mov eax, [rbp-12] ; Loading value from memory
-	mov ebx, [rbp-4] ; Loading value from memory
-	cmp rax,rbx
-	setne al
-	test rax,rax
-	jz ._U83_end_if
-	mov rdi, 42 ; Loading number literal
-	call printnum
-._U83_end_if:
-	mov eax, [rbp-12] ; Loading value from memory
-	mov ebx, [rbp-8] ; Loading value from memory
-	cmp rax,rbx
-	setle al
-	test rax,rax
-	jz ._U85_end_if
-	mov rdi, 43 ; Loading number literal
-	call printnum
-._U85_end_if:
-	mov eax, [rbp-12] ; Loading value from memory
-	mov ebx, [rbp-12] ; Loading value from memory
-	cmp rax,rbx
-	setle al
-	test rax,rax
-	jz ._U87_end_if
-	mov rdi, 44 ; Loading number literal
-	call printnum
-._U87_end_if:
-	mov eax, [rbp-12] ; Loading value from memory
-	mov ebx, [rbp-4] ; Loading value from memory
-	cmp rax,rbx
-	setle al
-	test rax,rax
-	jz ._U89_end_if
-	mov rdi, 45 ; Loading number literal
-	call printnum
-._U89_end_if:
-	mov eax, [rbp-12] ; Loading value from memory
-	mov ebx, [rbp-8] ; Loading value from memory
-	cmp rax,rbx
-	setge al
-	test rax,rax
-	jz ._U91_end_if
-	mov rdi, 46 ; Loading number literal
-	call printnum
-._U91_end_if:
-	mov eax, [rbp-12] ; Loading value from memory
-	mov ebx, [rbp-12] ; Loading value from memory
-	cmp rax,rbx
-	setge al
-	test rax,rax
-	jz ._U93_end_if
-	mov rdi, 47 ; Loading number literal
-	call printnum
-._U93_end_if:
-	mov eax, [rbp-12] ; Loading value from memory
-	mov ebx, [rbp-4] ; Loading value from memory
-	cmp rax,rbx
-	setge al
-	test rax,rax
-	jz ._U95_end_if
-	mov rdi, 48 ; Loading number literal
-	call printnum
-._U95_end_if:
-	mov eax, [rbp-12] ; Loading value from memory
-	mov ebx, [rbp-8] ; Loading value from memory
-	cmp rax,rbx
-	setl al
-	test rax,rax
-	jz ._U97_end_if
-	mov rdi, 49 ; Loading number literal
-	call printnum
-._U97_end_if:
-	mov eax, [rbp-12] ; Loading value from memory
-	mov ebx, [rbp-12] ; Loading value from memory
-	cmp rax,rbx
-	setl al
-	test rax,rax
-	jz ._U99_end_if
-	mov rdi, 50 ; Loading number literal
-	call printnum
-._U99_end_if:
-	mov eax, [rbp-12] ; Loading value from memory
-	mov ebx, [rbp-4] ; Loading value from memory
-	cmp rax,rbx
-	setl al
-	test rax,rax
-	jz ._U101_end_if
-	mov rdi, 51 ; Loading number literal
-	call printnum
-._U101_end_if:
-	mov eax, [rbp-12] ; Loading value from memory
-	mov ebx, [rbp-8] ; Loading value from memory
-	cmp rax,rbx
-	setg al
-	test rax,rax
-	jz ._U103_end_if
-	mov rdi, 52 ; Loading number literal
-	call printnum
-._U103_end_if:
-	mov eax, [rbp-12] ; Loading value from memory
-	mov ebx, [rbp-12] ; Loading value from memory
-	cmp rax,rbx
-	setg al
-	test rax,rax
-	jz ._U105_end_if
-	mov rdi, 53 ; Loading number literal
-	call printnum
-._U105_end_if:
-	mov eax, [rbp-12] ; Loading value from memory
-	mov ebx, [rbp-4] ; Loading value from memory
-	cmp rax,rbx
-	setg al
-	test rax,rax
-	jz ._U107_end_if
-	mov rdi, 54 ; Loading number literal
-	call printnum
-._U107_end_if:
-	mov rax, 0 ; Loading number literal
-	mov rsp, rbp              ; Restoring stack pointer
-	pop rbp                   ; Restore the base pointer
+	push r12
+	push r13
+	push r14
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 8 ; Creating space on the stack
+	mov r12d, 5 ; Loading number literal
+	mov r13d, 4 ; Loading number literal
+	mov r14d, 4 ; Loading number literal
+	cmp r12d, r13d
+	jne ._U2_end_if
+	mov edi, 1 ; Loading number literal
+	call printnum
+._U2_end_if:
+	cmp r12d, r14d
+	jne ._U4_end_if
+	mov edi, 2 ; Loading number literal
+	call printnum
+._U4_end_if:
+	cmp r12d, r12d
+	jne ._U6_end_if
+	mov edi, 3 ; Loading number literal
+	call printnum
+._U6_end_if:
+	cmp r12d, r13d
+	je ._U8_end_if
+	mov edi, 4 ; Loading number literal
+	call printnum
+._U8_end_if:
+	cmp r12d, r14d
+	je ._U10_end_if
+	mov edi, 5 ; Loading number literal
+	call printnum
+._U10_end_if:
+	cmp r12d, r12d
+	je ._U12_end_if
+	mov edi, 6 ; Loading number literal
+	call printnum
+._U12_end_if:
+	cmp r12d, r13d
+	jg ._U14_end_if
+	mov edi, 7 ; Loading number literal
+	call printnum
+._U14_end_if:
+	cmp r12d, r14d
+	jg ._U16_end_if
+	mov edi, 8 ; Loading number literal
+	call printnum
+._U16_end_if:
+	cmp r12d, r12d
+	jg ._U18_end_if
+	mov edi, 9 ; Loading number literal
+	call printnum
+._U18_end_if:
+	cmp r12d, r13d
+	jl ._U20_end_if
+	mov edi, 10 ; Loading number literal
+	call printnum
+._U20_end_if:
+	cmp r12d, r14d
+	jl ._U22_end_if
+	mov edi, 11 ; Loading number literal
+	call printnum
+._U22_end_if:
+	cmp r12d, r12d
+	jl ._U24_end_if
+	mov edi, 12 ; Loading number literal
+	call printnum
+._U24_end_if:
+	cmp r12d, r13d
+	jge ._U26_end_if
+	mov edi, 13 ; Loading number literal
+	call printnum
+._U26_end_if:
+	cmp r12d, r14d
+	jge ._U28_end_if
+	mov edi, 14 ; Loading number literal
+	call printnum
+._U28_end_if:
+	cmp r12d, r12d
+	jge ._U30_end_if
+	mov edi, 15 ; Loading number literal
+	call printnum
+._U30_end_if:
+	cmp r12d, r13d
+	jle ._U32_end_if
+	mov edi, 16 ; Loading number literal
+	call printnum
+._U32_end_if:
+	cmp r12d, r14d
+	jle ._U34_end_if
+	mov edi, 17 ; Loading number literal
+	call printnum
+._U34_end_if:
+	cmp r12d, r12d
+	jle ._U36_end_if
+	mov edi, 18 ; Loading number literal
+	call printnum
+._U36_end_if:
+	cmp r13d, r13d
+	jne ._U38_end_if
+	mov edi, 19 ; Loading number literal
+	call printnum
+._U38_end_if:
+	cmp r13d, r14d
+	jne ._U40_end_if
+	mov edi, 20 ; Loading number literal
+	call printnum
+._U40_end_if:
+	cmp r13d, r12d
+	jne ._U42_end_if
+	mov edi, 21 ; Loading number literal
+	call printnum
+._U42_end_if:
+	cmp r13d, r13d
+	je ._U44_end_if
+	mov edi, 22 ; Loading number literal
+	call printnum
+._U44_end_if:
+	cmp r13d, r14d
+	je ._U46_end_if
+	mov edi, 23 ; Loading number literal
+	call printnum
+._U46_end_if:
+	cmp r13d, r12d
+	je ._U48_end_if
+	mov edi, 24 ; Loading number literal
+	call printnum
+._U48_end_if:
+	cmp r13d, r13d
+	jg ._U50_end_if
+	mov edi, 25 ; Loading number literal
+	call printnum
+._U50_end_if:
+	cmp r13d, r14d
+	jg ._U52_end_if
+	mov edi, 26 ; Loading number literal
+	call printnum
+._U52_end_if:
+	cmp r13d, r12d
+	jg ._U54_end_if
+	mov edi, 27 ; Loading number literal
+	call printnum
+._U54_end_if:
+	cmp r13d, r13d
+	jl ._U56_end_if
+	mov edi, 28 ; Loading number literal
+	call printnum
+._U56_end_if:
+	cmp r13d, r14d
+	jl ._U58_end_if
+	mov edi, 29 ; Loading number literal
+	call printnum
+._U58_end_if:
+	cmp r13d, r12d
+	jl ._U60_end_if
+	mov edi, 30 ; Loading number literal
+	call printnum
+._U60_end_if:
+	cmp r13d, r13d
+	jge ._U62_end_if
+	mov edi, 31 ; Loading number literal
+	call printnum
+._U62_end_if:
+	cmp r13d, r14d
+	jge ._U64_end_if
+	mov edi, 32 ; Loading number literal
+	call printnum
+._U64_end_if:
+	cmp r13d, r12d
+	jge ._U66_end_if
+	mov edi, 33 ; Loading number literal
+	call printnum
+._U66_end_if:
+	cmp r13d, r13d
+	jle ._U68_end_if
+	mov edi, 34 ; Loading number literal
+	call printnum
+._U68_end_if:
+	cmp r13d, r14d
+	jle ._U70_end_if
+	mov edi, 35 ; Loading number literal
+	call printnum
+._U70_end_if:
+	cmp r13d, r12d
+	jle ._U72_end_if
+	mov edi, 36 ; Loading number literal
+	call printnum
+._U72_end_if:
+	cmp r14d, r13d
+	jne ._U74_end_if
+	mov edi, 37 ; Loading number literal
+	call printnum
+._U74_end_if:
+	cmp r14d, r14d
+	jne ._U76_end_if
+	mov edi, 38 ; Loading number literal
+	call printnum
+._U76_end_if:
+	cmp r14d, r12d
+	jne ._U78_end_if
+	mov edi, 39 ; Loading number literal
+	call printnum
+._U78_end_if:
+	cmp r14d, r13d
+	je ._U80_end_if
+	mov edi, 40 ; Loading number literal
+	call printnum
+._U80_end_if:
+	cmp r14d, r14d
+	je ._U82_end_if
+	mov edi, 41 ; Loading number literal
+	call printnum
+._U82_end_if:
+	cmp r14d, r12d
+	je ._U84_end_if
+	mov edi, 42 ; Loading number literal
+	call printnum
+._U84_end_if:
+	cmp r14d, r13d
+	jg ._U86_end_if
+	mov edi, 43 ; Loading number literal
+	call printnum
+._U86_end_if:
+	cmp r14d, r14d
+	jg ._U88_end_if
+	mov edi, 44 ; Loading number literal
+	call printnum
+._U88_end_if:
+	cmp r14d, r12d
+	jg ._U90_end_if
+	mov edi, 45 ; Loading number literal
+	call printnum
+._U90_end_if:
+	cmp r14d, r13d
+	jl ._U92_end_if
+	mov edi, 46 ; Loading number literal
+	call printnum
+._U92_end_if:
+	cmp r14d, r14d
+	jl ._U94_end_if
+	mov edi, 47 ; Loading number literal
+	call printnum
+._U94_end_if:
+	cmp r14d, r12d
+	jl ._U96_end_if
+	mov edi, 48 ; Loading number literal
+	call printnum
+._U96_end_if:
+	cmp r14d, r13d
+	jge ._U98_end_if
+	mov edi, 49 ; Loading number literal
+	call printnum
+._U98_end_if:
+	cmp r14d, r14d
+	jge ._U100_end_if
+	mov edi, 50 ; Loading number literal
+	call printnum
+._U100_end_if:
+	cmp r14d, r12d
+	jge ._U102_end_if
+	mov edi, 51 ; Loading number literal
+	call printnum
+._U102_end_if:
+	cmp r14d, r13d
+	jle ._U104_end_if
+	mov edi, 52 ; Loading number literal
+	call printnum
+._U104_end_if:
+	cmp r14d, r14d
+	jle ._U106_end_if
+	mov edi, 53 ; Loading number literal
+	call printnum
+._U106_end_if:
+	cmp r14d, r12d
+	jle ._U108_end_if
+	mov edi, 54 ; Loading number literal
+	call printnum
+._U108_end_if:
+	xor eax, eax
+._U0_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop r14
+	pop r13
+	pop r12
 	ret
@@ -0,0 +1,64 @@
+section .data
+
+section .rodata
+
+section .bss
+
+section .text
+	extern printnum:function
+
+	global main:function
+	global _start:function
+
+_start:
+	call main
+	mov rdi, rax            ; Exit code (0) expects return of main to be put in rax for now
+	mov rax, 60                  ; Syscall number for exit (60)
+	syscall                      ; Make the syscall
+
+main:
+	push r12
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 8 ; Creating space on the stack
+	xor r12d, r12d
+	cmp r12d, 1000
+	jge ._U2_while.end
+._U1_while:
+	lea eax, [r12+1]
+	mov r12d, eax
+	cmp r12d, 1000
+	jl ._U1_while
+._U2_while.end:
+	mov edi, r12d
+	call printnum
+	cmp r12d, 999
+	setg r10b
+	movzx r10d, r10b
+	cmp r12d, 10
+	setle al
+	movzx eax, al
+	mov r12d, eax
+	mov edi, r10d
+	call printnum
+	mov edi, r12d
+	call printnum
+	xor r10d, r10d
+	xor r11d, r11d
+._U4_for:
+	lea eax, [r10+1]
+	cmp r11d, 0
+	cmovge r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	cmp r11d, 3
+	jne ._U4_for
+._U3_for.end:
+	mov edi, r10d
+	call printnum
+	xor eax, eax
+._U0_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop r12
+	ret
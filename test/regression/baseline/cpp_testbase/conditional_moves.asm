@@ -0,0 +1,154 @@
+section .data
+
+section .rodata
+
+section .bss
+
+section .text
+	extern printnum:function
+
+	global main:function
+	global _start:function
+
+_start:
+	call main
+	mov rdi, rax            ; Exit code (0) expects return of main to be put in rax for now
+	mov rax, 60                  ; Syscall number for exit (60)
+	syscall                      ; Make the syscall
+
+main:
+	push r12
+	push r13
+	push r14
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 8 ; Creating space on the stack
+	mov r12d, 17 ; Loading number literal
+	mov r13d, 4294967292 ; Loading number literal
+	xor r14d, r14d
+	mov eax, r13d
+	cmp r12d, r13d
+	cmovl eax, r12d
+	mov r14d, eax
+	mov edi, r14d
+	call printnum
+	mov eax, r13d
+	cmp r12d, r13d
+	cmovg eax, r12d
+	mov r14d, eax
+	mov edi, r14d
+	call printnum
+	lea r14d, [r12+20]
+	mov eax, 30 ; Loading number literal
+	cmp r14d, 30
+	cmovg r14d, eax
+	mov edi, r14d
+	call printnum
+	xor eax, eax
+	cmp r14d, 0
+	cmovl r14d, eax
+	mov edi, r14d
+	call printnum
+	mov r10d, r13d
+	xor eax, eax
+	sub eax, r13d
+	cmp r13d, 0
+	cmovl r10d, eax
+	mov edi, r10d
+	call printnum
+	mov r10d, 5 ; Loading number literal
+	movsx eax, r10b
+	mov ecx, 300 ; Loading number literal
+	mov edx, r12d
+	test rdx, rdx
+	cmovne eax, ecx
+	mov r10d, eax
+	movsx edi, r10b
+	call printnum
+	xor r10d, r10d
+	xor r11d, r11d
+	cmp r10d, 0
+	je ._U1_else
+	mov eax, r12d
+	mov ecx, r10d
+	cdq
+	idiv ecx
+	mov r11d, eax
+	jmp ._U2_end_if
+._U1_else:
+	mov eax, 4294967295 ; Loading number literal
+	mov r11d, eax
+._U2_end_if:
+	mov edi, r11d
+	call printnum
+	xor r10d, r10d
+	xor r11d, r11d
+._U4_for:
+	mov eax, r11d
+	movsxd rcx, eax
+	imul rcx, rcx, 1431655766
+	sar rcx, 32
+	mov edx, eax
+	shr edx, 31
+	add ecx, edx
+	imul ecx, ecx, 3
+	sub eax, ecx
+	cmp eax, 0
+	jne ._U5_else
+	mov eax, r11d
+	imul eax, eax, 7
+	imul eax, r12d
+	add eax, r10d
+	mov ecx, r13d
+	imul ecx, r11d
+	lea ecx, [rcx+rcx*2]
+	add eax, ecx
+	mov r10d, eax
+	jmp ._U6_end_if
+._U5_else:
+	mov eax, r10d
+	sub eax, r11d
+	mov r10d, eax
+._U6_end_if:
+	lea eax, [r11+1]
+	mov r11d, eax
+	cmp r11d, 10
+	jl ._U4_for
+._U3_for.end:
+	mov edi, r10d
+	call printnum
+	xor r10d, r10d
+	mov r11d, 12345 ; Loading number literal
+	xor esi, esi
+._U8_for:
+	mov eax, r11d
+	imul eax, eax, 1103
+	add eax, 12345
+	mov r11d, eax
+	mov edi, r11d
+	movsxd rax, edi
+	imul rax, rax, 274877907
+	sar rax, 32
+	sar eax, 6
+	mov ecx, edi
+	shr ecx, 31
+	add eax, ecx
+	imul eax, eax, 1000
+	sub edi, eax
+	cmp edi, r10d
+	cmovg r10d, edi
+	lea eax, [rsi+1]
+	mov esi, eax
+	cmp esi, 20
+	jl ._U8_for
+._U7_for.end:
+	mov edi, r10d
+	call printnum
+	xor eax, eax
+._U0_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop r14
+	pop r13
+	pop r12
+	ret
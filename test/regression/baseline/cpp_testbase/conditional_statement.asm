@@ -17,55 +17,55 @@ _start:
 	syscall                      ; Make the syscall
 
 main:
-	push rbp                 ; Save the base pointer
-	mov rbp, rsp              ; Set base pointer to current stack pointer
-	mov rax, 1 ; Loading number literal
-	test rax,rax
-	jz ._U0_else
-	mov rdi, 0 ; Loading number literal
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	mov eax, 1 ; Loading number literal
+	test rax, rax
+	je ._U1_else
+	xor edi, edi
 	call printnum
-	jmp ._U1_end_if
-._U0_else:
-	mov rdi, 1 ; Loading number literal
+	jmp ._U2_end_if
+._U1_else:
+	mov edi, 1 ; Loading number literal
 	call printnum
-._U1_end_if:
-	mov rax, 0 ; Loading number literal
-	test rax,rax
-	jz ._U2_else
-	mov rdi, 2 ; Loading number literal
+._U2_end_if:
+	xor eax, eax
+	test rax, rax
+	je ._U3_else
+	mov edi, 2 ; Loading number literal
 	call printnum
-	jmp ._U3_end_if
-._U2_else:
-	mov rax, 1 ; Loading number literal
-	test rax,rax
-	jz ._U4_else
-	mov rdi, 3 ; Loading number literal
+	jmp ._U4_end_if
+._U3_else:
+	mov eax, 1 ; Loading number literal
+	test rax, rax
+	je ._U5_else
+	mov edi, 3 ; Loading number literal
 	call printnum
-	jmp ._U5_end_if
-._U4_else:
-	mov rdi, 4 ; Loading number literal
+	jmp ._U6_end_if
+._U5_else:
+	mov edi, 4 ; Loading number literal
 	call printnum
-._U5_end_if:
-._U3_end_if:
-	mov rax, 1 ; Loading number literal
-	test rax,rax
-	jz ._U7_end_if
-	mov rdi, 5 ; Loading number literal
+._U6_end_if:
+._U4_end_if:
+	mov eax, 1 ; Loading number literal
+	test rax, rax
+	je ._U8_end_if
+	mov edi, 5 ; Loading number literal
 	call printnum
-._U7_end_if:
-	mov rdi, 6 ; Loading number literal
+._U8_end_if:
+	mov edi, 6 ; Loading number literal
 	call printnum
-	mov rax, 0 ; Loading number literal
-	test rax,rax
-	jz ._U8_else
-	mov rdi, 7 ; Loading number literal
+	xor eax, eax
+	test rax, rax
+	je ._U9_else
+	mov edi, 7 ; Loading number literal
 	call printnum
-	jmp ._U9_end_if
-._U8_else:
-	mov rdi, 8 ; Loading number literal
+	jmp ._U10_end_if
+._U9_else:
+	mov edi, 8 ; Loading number literal
 	call printnum
-._U9_end_if:
-	mov rax, 0 ; Loading number literal
-	mov rsp, rbp              ; Restoring stack pointer
-	pop rbp                   ; Restore the base pointer
+._U10_end_if:
+	xor eax, eax
+._U0_return:
+	pop rbp ; Restore the base pointer
 	ret
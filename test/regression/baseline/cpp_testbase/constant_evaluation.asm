@@ -0,0 +1,192 @@
+section .data
+
+section .rodata
+
+section .bss
+
+section .text
+	extern printnum:function
+
+	global factorial10:function
+	global collatzSteps:function
+	global wrapped:function
+	global fallThrough:function
+	global sumOfBoth:function
+	global spin:function
+	global divideByZero:function
+	global forever:function
+	global notConstexpr:function
+	global main:function
+	global _start:function
+
+_start:
+	call main
+	mov rdi, rax            ; Exit code (0) expects return of main to be put in rax for now
+	mov rax, 60                  ; Syscall number for exit (60)
+	syscall                      ; Make the syscall
+
+factorial10:
+	mov r10d, 1 ; Loading number literal
+	mov r11d, 2 ; Loading number literal
+._U2_for:
+	mov eax, r10d
+	imul eax, r11d
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	cmp r11d, 10
+	jle ._U2_for
+._U1_for.end:
+	mov eax, r10d
+._U0_return:
+	ret
+collatzSteps:
+	mov r10d, 27 ; Loading number literal
+	xor r11d, r11d
+	cmp r10d, 1
+	je ._U5_while.end
+._U4_while:
+	mov eax, r10d
+	mov ecx, eax
+	sar ecx, 31
+	shr ecx, 31
+	add ecx, eax
+	sar ecx, 1
+	shl ecx, 1
+	sub eax, ecx
+	cmp eax, 0
+	jne ._U6_else
+	mov eax, r10d
+	mov ecx, eax
+	sar ecx, 31
+	shr ecx, 31
+	add ecx, eax
+	sar ecx, 1
+	mov eax, ecx
+	mov r10d, eax
+	jmp ._U7_end_if
+._U6_else:
+	mov eax, r10d
+	lea eax, [rax+rax*2]
+	add eax, 1
+	mov r10d, eax
+._U7_end_if:
+	lea eax, [r11+1]
+	mov r11d, eax
+	cmp r10d, 1
+	jne ._U4_while
+._U5_while.end:
+	mov eax, r11d
+._U3_return:
+	ret
+wrapped:
+	mov r10d, 100 ; Loading number literal
+	movsx eax, r10b
+	add eax, 100
+	mov r10d, eax
+	movsx eax, r10b
+	movsx eax, r10b
+._U8_return:
+	ret
+fallThrough:
+	xor r10d, r10d
+	mov eax, 3 ; Loading number literal
+	cmp eax, 1
+	je ._U11_case
+	cmp eax, 3
+	je ._U12_case
+	cmp eax, 4
+	je ._U13_case
+	jmp ._U14_default
+._U11_case:
+	mov eax, 10 ; Loading number literal
+	mov r10d, eax
+	jmp ._U10_switch.end
+._U12_case:
+	mov eax, 30 ; Loading number literal
+	mov r10d, eax
+._U13_case:
+	lea eax, [r10+1]
+	mov r10d, eax
+	jmp ._U10_switch.end
+._U14_default:
+	mov eax, 99 ; Loading number literal
+	mov r10d, eax
+._U10_switch.end:
+	mov eax, r10d
+._U9_return:
+	ret
+sumOfBoth:
+	mov eax, 3628911 ; Loading number literal
+._U15_return:
+	ret
+spin:
+	xor r10d, r10d
+	cmp r10d, 3000000
+	jge ._U18_while.end
+._U17_while:
+	lea eax, [r10+1]
+	mov r10d, eax
+	cmp r10d, 3000000
+	jl ._U17_while
+._U18_while.end:
+	mov eax, r10d
+._U16_return:
+	ret
+divideByZero:
+	xor r10d, r10d
+	mov eax, 1 ; Loading number literal
+	mov ecx, r10d
+	cdq
+	idiv ecx
+._U19_return:
+	ret
+forever:
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	call forever
+	add eax, 1
+._U20_return:
+	pop rbp ; Restore the base pointer
+	ret
+notConstexpr:
+	mov eax, 42 ; Loading number literal
+._U21_return:
+	ret
+main:
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	mov edi, 3628800 ; Loading number literal
+	call printnum
+	mov edi, 111 ; Loading number literal
+	call printnum
+	mov edi, 4294967240 ; Loading number literal
+	call printnum
+	mov edi, 31 ; Loading number literal
+	call printnum
+	mov edi, 3628911 ; Loading number literal
+	call printnum
+	call spin
+	mov edi, eax
+	call printnum
+	call notConstexpr
+	mov edi, eax
+	call printnum
+	xor r10d, r10d
+	mov eax, r10d
+	test rax, rax
+	je ._U24_end_if
+	call divideByZero
+	mov edi, eax
+	call printnum
+	call forever
+	mov edi, eax
+	call printnum
+._U24_end_if:
+	mov r10d, 3629 ; Loading number literal
+	mov edi, r10d
+	call printnum
+	xor eax, eax
+._U22_return:
+	pop rbp ; Restore the base pointer
+	ret
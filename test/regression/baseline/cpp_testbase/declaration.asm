@@ -16,15 +16,7 @@ _start:
 	syscall                      ; Make the syscall
 
 main:
-	push rbp                 ; Save the base pointer
-	mov rbp, rsp              ; Set base pointer to current stack pointer
-	sub rsp, 4 ; Creating space on the stack
-	mov rax, 1 ; Loading number literal
-	mov [rbp-4], eax ; Storing value in memory
-	sub rsp, 4 ; Creating space on the stack
-	sub rsp, 4 ; Creating space on the stack
-	mov rax, 42 ; Loading number literal
-	mov [rbp-12], eax ; Storing value in memory
-	mov rsp, rbp              ; Restoring stack pointer
-	pop rbp                   ; Restore the base pointer
+	mov r10d, 1 ; Loading number literal
+	mov r10d, 42 ; Loading number literal
+._U0_return:
 	ret
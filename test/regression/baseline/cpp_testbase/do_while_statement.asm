@@ -17,22 +17,23 @@ _start:
 	syscall                      ; Make the syscall
 
 main:
-	push rbp                 ; Save the base pointer
-	mov rbp, rsp              ; Set base pointer to current stack pointer
-	sub rsp, 4 ; Creating space on the stack
-	mov rax, 5 ; Loading number literal
-	mov [rbp-4], eax ; Storing value in memory
-._U0_do-while:
-	mov edi, [rbp-4] ; Loading value from memory
+	push r12
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 8 ; Creating space on the stack
+	mov r12d, 5 ; Loading number literal
+._U1_do_while:
+	mov edi, r12d
 	call printnum
-	mov eax, [rbp-4] ; Loading value from memory
-	mov rbx, 1 ; Loading number literal
-	sub rax, rbx
-	mov [rbp-4], rax ; Storing value in memory
-	mov eax, [rbp-4] ; Loading value from memory
-	test rax,rax
-	jnz._U0_do-while
-	mov rax, 0 ; Loading number literal
-	mov rsp, rbp              ; Restoring stack pointer
-	pop rbp                   ; Restore the base pointer
+	lea eax, [r12-1]
+	mov r12d, eax
+	mov eax, r12d
+	test rax, rax
+	jne ._U1_do_while
+._U2_do_while.end:
+	xor eax, eax
+._U0_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop r12
 	ret
@@ -0,0 +1,168 @@
+section .data
+
+section .rodata
+
+section .bss
+
+section .text
+	extern printnum:function
+
+	global main:function
+	global _start:function
+
+_start:
+	call main
+	mov rdi, rax            ; Exit code (0) expects return of main to be put in rax for now
+	mov rax, 60                  ; Syscall number for exit (60)
+	syscall                      ; Make the syscall
+
+main:
+	push r12
+	push r13
+	push r14
+	push r15
+	push rbx
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 8 ; Creating space on the stack
+	mov r12d, 3 ; Loading number literal
+	mov r13d, 7 ; Loading number literal
+	mov r14d, 11 ; Loading number literal
+	mov r15d, 13 ; Loading number literal
+	mov ebx, 17 ; Loading number literal
+	mov ecx, r14d
+	mov edx, r15d
+	sub edx, ebx
+	sub ecx, edx
+	mov eax, r13d
+	sub eax, ecx
+	mov r10d, r12d
+	sub r10d, eax
+	mov edi, r10d
+	push r10
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop r10
+	mov eax, r15d
+	imul eax, ebx
+	add eax, r14d
+	imul eax, r13d
+	add eax, r12d
+	mov r10d, eax
+	mov edi, r10d
+	push r10
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop r10
+	mov ecx, r13d
+	imul ecx, r14d
+	mov edx, r15d
+	imul edx, ebx
+	sub ecx, edx
+	mov eax, r12d
+	sub eax, ecx
+	mov r10d, eax
+	mov edi, r10d
+	push r10
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop r10
+	lea eax, [r12+r13*1]
+	mov ecx, r14d
+	sub ecx, r15d
+	imul eax, ecx
+	lea ecx, [r15+rbx*1]
+	mov edx, r12d
+	sub edx, r14d
+	imul ecx, edx
+	sub eax, ecx
+	mov r10d, eax
+	mov edi, r10d
+	push r10
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop r10
+	mov ecx, ebx
+	lea edx, [r13+r14*1]
+	imul edx, r12d
+	sub ecx, edx
+	imul ecx, r15d
+	mov eax, r12d
+	imul eax, r13d
+	add eax, r14d
+	sub eax, ecx
+	mov r10d, eax
+	mov edi, r10d
+	push r10
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop r10
+	mov ecx, r13d
+	mov edx, r12d
+	sub edx, r14d
+	sub ecx, edx
+	mov eax, ebx
+	imul eax, r15d
+	cdq
+	idiv ecx
+	mov r10d, eax
+	mov edi, r10d
+	push r10
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop r10
+	mov eax, ebx
+	imul eax, r15d
+	imul eax, r14d
+	mov ecx, r14d
+	sub ecx, r15d
+	imul ecx, r13d
+	add ecx, r12d
+	cdq
+	idiv ecx
+	mov eax, edx
+	mov r10d, eax
+	mov edi, r10d
+	push r10
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop r10
+	mov ecx, r14d
+	lea edx, [r15+rbx*1]
+	sub ecx, edx
+	imul ecx, r13d
+	mov eax, r12d
+	cmp eax, ecx
+	setl al
+	movzx eax, al
+	mov r10d, eax
+	mov edi, r10d
+	call printnum
+	mov edx, r15d
+	lea esi, [rbx+r12*1]
+	sub edx, esi
+	mov ecx, r14d
+	sub ecx, edx
+	lea eax, [r12+r13*1]
+	cmp eax, ecx
+	jle ._U2_end_if
+	mov edi, 1 ; Loading number literal
+	call printnum
+._U2_end_if:
+	xor eax, eax
+._U0_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop rbx
+	pop r15
+	pop r14
+	pop r13
+	pop r12
+	ret
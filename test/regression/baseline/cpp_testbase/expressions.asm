@@ -17,15 +17,13 @@ _start:
 	syscall                      ; Make the syscall
 
 main:
-	push rbp                 ; Save the base pointer
-	mov rbp, rsp              ; Set base pointer to current stack pointer
-	mov rdi, 12345 ; Loading number literal
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	mov edi, 12345 ; Loading number literal
 	call printnum
-	mov rdi, 41 ; Loading number literal
-	mov rax, 1 ; Loading number literal
-	add rdi, rax
+	mov edi, 42 ; Loading number literal
 	call printnum
-	mov rax, 0 ; Loading number literal
-	mov rsp, rbp              ; Restoring stack pointer
-	pop rbp                   ; Restore the base pointer
+	xor eax, eax
+._U0_return:
+	pop rbp ; Restore the base pointer
 	ret
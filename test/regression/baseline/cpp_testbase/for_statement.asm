@@ -17,24 +17,26 @@ _start:
 	syscall                      ; Make the syscall
 
 main:
-	push rbp                 ; Save the base pointer
-	mov rbp, rsp              ; Set base pointer to current stack pointer
-	sub rsp, 4 ; Creating space on the stack
-	mov rax, 5 ; Loading number literal
-	mov [rbp-4], eax ; Storing value in memory
-._U0_for:
-	mov eax, [rbp-4] ; Loading value from memory
-	test rax,rax
-	jz ._U1_for.end
-	mov edi, [rbp-4] ; Loading value from memory
+	push r12
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 8 ; Creating space on the stack
+	mov r12d, 5 ; Loading number literal
+	mov eax, r12d
+	test rax, rax
+	je ._U1_for.end
+._U2_for:
+	mov edi, r12d
 	call printnum
-	mov eax, [rbp-4] ; Loading value from memory
-	mov rbx, 1 ; Loading number literal
-	sub rax, rbx
-	mov [rbp-4], rax ; Storing value in memory
-	jmp ._U0_for
+	lea eax, [r12-1]
+	mov r12d, eax
+	mov eax, r12d
+	test rax, rax
+	jne ._U2_for
 ._U1_for.end:
-	mov rax, 0 ; Loading number literal
-	mov rsp, rbp              ; Restoring stack pointer
-	pop rbp                   ; Restore the base pointer
+	xor eax, eax
+._U0_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop r12
 	ret
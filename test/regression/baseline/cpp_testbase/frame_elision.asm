@@ -0,0 +1,85 @@
+section .data
+
+section .rodata
+
+section .bss
+
+section .text
+	extern printnum:function
+
+	global constant:function
+	global early:function
+	global leaf:function
+	global main:function
+	global _start:function
+
+_start:
+	call main
+	mov rdi, rax            ; Exit code (0) expects return of main to be put in rax for now
+	mov rax, 60                  ; Syscall number for exit (60)
+	syscall                      ; Make the syscall
+
+constant:
+	mov eax, 42 ; Loading number literal
+._U0_return:
+	ret
+early:
+	xor eax, eax
+	test rax, rax
+	je ._U2_end_if
+	mov eax, 1 ; Loading number literal
+	ret
+._U2_end_if:
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	mov r10d, 4 ; Loading number literal
+	mov r11d, 5 ; Loading number literal
+	lea edi, [r10+r11*1]
+	call printnum
+	xor eax, eax
+._U3_return:
+	pop rbp ; Restore the base pointer
+	ret
+leaf:
+	mov r10d, 3 ; Loading number literal
+	mov r11d, 9 ; Loading number literal
+	mov eax, r11d
+	test rax, rax
+	je ._U6_end_if
+	lea eax, [r10+r11*1]
+	jmp ._U4_return
+._U6_end_if:
+	xor eax, eax
+._U4_return:
+	ret
+main:
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+._U8_inlined_return:
+	mov r10d, 7 ; Loading number literal
+	mov edi, r10d
+	call printnum
+	xor eax, eax
+	test rax, rax
+	je ._U11_end_if
+	jmp ._U9_inlined_return
+._U11_end_if:
+	mov r10d, 4 ; Loading number literal
+	mov r11d, 5 ; Loading number literal
+	lea edi, [r10+r11*1]
+	call printnum
+._U9_inlined_return:
+	mov r10d, 12 ; Loading number literal
+	mov r11d, 3 ; Loading number literal
+	mov esi, 9 ; Loading number literal
+	mov eax, esi
+	test rax, rax
+	je ._U14_end_if
+._U14_end_if:
+._U12_inlined_return:
+	mov edi, r10d
+	call printnum
+	xor eax, eax
+._U7_return:
+	pop rbp ; Restore the base pointer
+	ret
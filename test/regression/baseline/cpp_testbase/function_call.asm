@@ -17,24 +17,14 @@ _start:
 	syscall                      ; Make the syscall
 
 fn:
-	push rbp                 ; Save the base pointer
-	mov rbp, rsp              ; Set base pointer to current stack pointer
-	sub rsp, 4 ; Creating space on the stack
-	mov rax, 42 ; Loading number literal
-	mov [rbp-4], eax ; Storing value in memory
-	mov rax, 1 ; Loading number literal
-	mov rsp, rbp              ; Restoring stack pointer
-	pop rbp                   ; Restore the base pointer
+	mov r10d, 42 ; Loading number literal
+	mov eax, 1 ; Loading number literal
+._U0_return:
 	ret
 main:
-	push rbp                 ; Save the base pointer
-	mov rbp, rsp              ; Set base pointer to current stack pointer
-	sub rsp, 4 ; Creating space on the stack
-	mov rax, 1 ; Loading number literal
-	mov [rbp-4], eax ; Storing value in memory
-	mov edi, [rbp-4] ; Loading value from memory
-	call fn
-	mov rax, 1 ; Loading number literal
-	mov rsp, rbp              ; Restoring stack pointer
-	pop rbp                   ; Restore the base pointer
+	mov r10d, 1 ; Loading number literal
+	mov r10d, 42 ; Loading number literal
+._U2_inlined_return:
+	mov eax, 1 ; Loading number literal
+._U1_return:
 	ret
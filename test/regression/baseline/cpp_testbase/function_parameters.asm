@@ -0,0 +1,477 @@
+section .data
+
+section .rodata
+
+section .bss
+
+section .text
+	extern printnum:function
+
+	global add:function
+	global fib:function
+	global weighted:function
+	global narrow:function
+	global countdown:function
+	global clamp:function
+	global nested:function
+	global crowded:function
+	global main:function
+	global _start:function
+
+_start:
+	call main
+	mov rdi, rax            ; Exit code (0) expects return of main to be put in rax for now
+	mov rax, 60                  ; Syscall number for exit (60)
+	syscall                      ; Make the syscall
+
+add:
+	lea eax, [rdi+rsi*1]
+._U0_return:
+	ret
+fib:
+	push r12
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 8 ; Creating space on the stack
+	mov r12d, edi
+	cmp r12d, 2
+	jge ._U3_end_if
+	mov eax, r12d
+	jmp ._U1_return
+._U3_end_if:
+	lea edi, [r12-1]
+	call fib
+	lea edi, [r12-2]
+	push rax
+	sub rsp, 8 ; Aligning the stack for the call
+	call fib
+	add rsp, 8
+	mov ecx, eax
+	pop rax
+	add eax, ecx
+._U1_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop r12
+	ret
+weighted:
+	push rbx
+	mov r10d, dword [rsp+16] ; Loading stack argument
+	mov r11d, dword [rsp+24] ; Loading stack argument
+	mov eax, esi
+	shl eax, 1
+	add eax, edi
+	mov ebx, edx
+	lea ebx, [rbx+rbx*2]
+	add eax, ebx
+	mov ebx, ecx
+	shl ebx, 2
+	add eax, ebx
+	mov ebx, r8d
+	lea ebx, [rbx+rbx*4]
+	add eax, ebx
+	mov ebx, r9d
+	lea ebx, [rbx+rbx*2]
+	shl ebx, 1
+	add eax, ebx
+	mov ebx, r10d
+	imul ebx, ebx, 7
+	add eax, ebx
+	mov ebx, r11d
+	shl ebx, 3
+	add eax, ebx
+._U4_return:
+	pop rbx
+	ret
+narrow:
+	push r12
+	push rbx
+	movsx r10d, byte [rsp+24] ; Loading stack argument
+	mov r11d, dword [rsp+32] ; Loading stack argument
+	movsx r12d, byte [rsp+40] ; Loading stack argument
+	movsx eax, dil
+	imul eax, eax, 100
+	movsx ebx, r10b
+	lea ebx, [rbx+rbx*4]
+	shl ebx, 1
+	add eax, ebx
+	movsx ebx, r12b
+	add eax, ebx
+	add eax, r11d
+	sub eax, esi
+	sub eax, edx
+	sub eax, ecx
+	sub eax, r8d
+	sub eax, r9d
+._U5_return:
+	pop rbx
+	pop r12
+	ret
+narrow._.k1.k1.k1.k1.k1._.k5:
+	movsx eax, dil
+	imul eax, eax, 100
+	movsx ecx, sil
+	lea ecx, [rcx+rcx*4]
+	shl ecx, 1
+	add eax, ecx
+	movsx ecx, dl
+	add eax, ecx
+	add eax, 5
+	sub eax, 1
+	sub eax, 1
+	sub eax, 1
+	sub eax, 1
+	sub eax, 1
+._U6_return:
+	ret
+countdown:
+	xor r10d, r10d
+	cmp edi, 0
+	jle ._U9_while.end
+._U8_while:
+	lea eax, [r10+rdi*1]
+	mov r10d, eax
+	mov eax, edi
+	sub eax, esi
+	mov edi, eax
+	cmp edi, 0
+	jg ._U8_while
+._U9_while.end:
+	mov eax, r10d
+._U7_return:
+	ret
+countdown._.k3:
+	xor r10d, r10d
+	cmp edi, 0
+	jle ._U12_while.end
+._U11_while:
+	lea eax, [r10+rdi*1]
+	mov r10d, eax
+	lea eax, [rdi-3]
+	mov edi, eax
+	cmp edi, 0
+	jg ._U11_while
+._U12_while.end:
+	mov eax, r10d
+._U10_return:
+	ret
+clamp:
+	cmp edi, esi
+	jge ._U14_end_if
+	mov eax, esi
+	ret
+._U14_end_if:
+	cmp edi, edx
+	jle ._U16_end_if
+	mov eax, edx
+	ret
+._U16_end_if:
+	mov eax, edi
+._U17_return:
+	ret
+clamp._.k10.k20:
+	cmp edi, 10
+	jge ._U19_end_if
+	mov eax, 10 ; Loading number literal
+	ret
+._U19_end_if:
+	cmp edi, 20
+	jle ._U21_end_if
+	mov eax, 20 ; Loading number literal
+	ret
+._U21_end_if:
+	mov eax, edi
+._U22_return:
+	ret
+nested:
+	push r12
+	push r13
+	push r14
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 8 ; Creating space on the stack
+	mov r12d, edi
+	mov r13d, r12d
+	lea r13d, [r13+r13*2]
+	mov edi, r12d
+	mov esi, r13d
+	push rdi ; Spilling register
+	mov edi, r12d
+	push rsi ; Spilling register
+	mov esi, r13d
+	call add
+	mov edx, eax
+	pop rsi ; Reloading spilled register
+	pop rdi ; Reloading spilled register
+	push rdi ; Spilling register
+	mov edi, r12d
+	push rsi
+	push rdx
+	sub rsp, 8 ; Aligning the stack for the call
+	call fib
+	add rsp, 8
+	mov ecx, eax
+	pop rdx
+	pop rsi
+	pop rdi ; Reloading spilled register
+	mov r8d, 1 ; Loading number literal
+	mov r9d, 2 ; Loading number literal
+	sub rsp, 16 ; Reserving the stack arguments
+	push rdi ; Spilling register
+	mov edi, r13d
+	push rsi ; Spilling register
+	mov esi, 1 ; Loading number literal
+	push r8
+	push r9
+	push rdx
+	push rcx
+	call add
+	pop rcx
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi ; Reloading spilled register
+	pop rdi ; Reloading spilled register
+	mov [rsp], rax ; Stack argument
+	push rdi ; Spilling register
+	lea edi, [r13-10]
+	push rsi
+	push r8
+	push r9
+	push rdx
+	push rcx
+	call fib
+	pop rcx
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop rdi ; Reloading spilled register
+	mov [rsp+8], rax ; Stack argument
+	call weighted
+	add rsp, 16
+	mov r14d, eax
+	lea eax, [r14+r13*1]
+._U23_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop r14
+	pop r13
+	pop r12
+	ret
+nested.k5:
+	push r12
+	push r13
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	mov r12d, 15 ; Loading number literal
+	mov edi, 5 ; Loading number literal
+	mov esi, r12d
+	push rdi ; Spilling register
+	mov edi, 5 ; Loading number literal
+	push rsi ; Spilling register
+	mov esi, r12d
+	call add
+	mov edx, eax
+	pop rsi ; Reloading spilled register
+	pop rdi ; Reloading spilled register
+	push rdi ; Spilling register
+	mov edi, 5 ; Loading number literal
+	push rsi
+	push rdx
+	sub rsp, 8 ; Aligning the stack for the call
+	call fib
+	add rsp, 8
+	mov ecx, eax
+	pop rdx
+	pop rsi
+	pop rdi ; Reloading spilled register
+	mov r8d, 1 ; Loading number literal
+	mov r9d, 2 ; Loading number literal
+	sub rsp, 16 ; Reserving the stack arguments
+	push rdi ; Spilling register
+	mov edi, r12d
+	push rsi ; Spilling register
+	mov esi, 1 ; Loading number literal
+	push r8
+	push r9
+	push rdx
+	push rcx
+	call add
+	pop rcx
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi ; Reloading spilled register
+	pop rdi ; Reloading spilled register
+	mov [rsp], rax ; Stack argument
+	push rdi ; Spilling register
+	lea edi, [r12-10]
+	push rsi
+	push r8
+	push r9
+	push rdx
+	push rcx
+	call fib
+	pop rcx
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop rdi ; Reloading spilled register
+	mov [rsp+8], rax ; Stack argument
+	call weighted
+	add rsp, 16
+	mov r13d, eax
+	lea eax, [r13+r12*1]
+._U24_return:
+	pop rbp ; Restore the base pointer
+	pop r13
+	pop r12
+	ret
+crowded:
+	push r12
+	push r13
+	push r14
+	push r15
+	push rbx
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 8 ; Creating space on the stack
+	mov r10d, edi
+	mov r12d, esi
+	lea r13d, [r10+1]
+	lea r14d, [r10+2]
+	lea r15d, [r10+3]
+	lea ebx, [r10+4]
+	lea eax, [r10+5]
+	mov [rbp-4], eax ; Storing value in memory
+	cmp r13d, r12d
+	setl r11b
+	movzx r11d, r11b
+	mov edi, r10d
+	mov esi, r12d
+	mov edx, r13d
+	mov ecx, r14d
+	mov r8d, r15d
+	mov r9d, ebx
+	push r11
+	sub rsp, 24 ; Reserving the stack arguments
+	push rax ; Spilling register
+	cmp dword [rbp-4], r12d
+	setl al
+	movzx eax, al
+	mov [rsp+8], rax ; Stack argument
+	pop rax ; Reloading spilled register
+	push rax ; Spilling register
+	cmp r12d, r13d
+	setl al
+	movzx eax, al
+	mov [rsp+16], rax ; Stack argument
+	pop rax ; Reloading spilled register
+	call weighted
+	add rsp, 24
+	pop r11
+	add r11d, eax
+	lea eax, [r11+r13*1]
+	add eax, r14d
+	add eax, r15d
+	add eax, ebx
+	add eax, dword [rbp-4]
+._U25_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop rbx
+	pop r15
+	pop r14
+	pop r13
+	pop r12
+	ret
+main:
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	mov edi, 40 ; Loading number literal
+	mov esi, 2 ; Loading number literal
+	call add
+	mov edi, eax
+	call printnum
+	mov edi, 15 ; Loading number literal
+	call fib
+	mov edi, eax
+	call printnum
+	mov edi, 1 ; Loading number literal
+	mov esi, 2 ; Loading number literal
+	mov edx, 3 ; Loading number literal
+	mov ecx, 4 ; Loading number literal
+	mov r8d, 5 ; Loading number literal
+	mov r9d, 6 ; Loading number literal
+	sub rsp, 16 ; Reserving the stack arguments
+	mov eax, 7 ; Loading number literal
+	mov [rsp], rax ; Stack argument
+	mov eax, 8 ; Loading number literal
+	mov [rsp+8], rax ; Stack argument
+	call weighted
+	add rsp, 16
+	mov edi, eax
+	call printnum
+	mov edi, 3 ; Loading number literal
+	mov esi, 4 ; Loading number literal
+	mov edx, 6 ; Loading number literal
+	call narrow._.k1.k1.k1.k1.k1._.k5
+	mov edi, eax
+	call printnum
+	mov edi, 10 ; Loading number literal
+	call countdown._.k3
+	mov edi, eax
+	call printnum
+	mov edi, 5 ; Loading number literal
+	call clamp._.k10.k20
+	mov edi, eax
+	push rdi ; Spilling register
+	mov edi, 15 ; Loading number literal
+	sub rsp, 8 ; Aligning the stack for the call
+	call clamp._.k10.k20
+	add rsp, 8
+	pop rdi ; Reloading spilled register
+	add edi, eax
+	push rdi ; Spilling register
+	mov edi, 25 ; Loading number literal
+	sub rsp, 8 ; Aligning the stack for the call
+	call clamp._.k10.k20
+	add rsp, 8
+	pop rdi ; Reloading spilled register
+	add edi, eax
+	call printnum
+	call nested.k5
+	mov edi, eax
+	call printnum
+	mov r10d, 7 ; Loading number literal
+	mov edi, r10d
+	lea esi, [r10+1]
+	lea edx, [r10+2]
+	lea ecx, [r10+3]
+	lea r8d, [r10+4]
+	lea r9d, [r10+5]
+	sub rsp, 16 ; Reserving the stack arguments
+	lea eax, [r10+6]
+	mov [rsp], rax ; Stack argument
+	lea eax, [r10+7]
+	mov [rsp+8], rax ; Stack argument
+	call weighted
+	add rsp, 16
+	mov edi, eax
+	call printnum
+	xor edi, edi
+	mov esi, 1 ; Loading number literal
+	call crowded
+	mov edi, eax
+	call printnum
+	mov edi, 1 ; Loading number literal
+	mov esi, 9 ; Loading number literal
+	call crowded
+	mov edi, eax
+	call printnum
+	xor eax, eax
+._U26_return:
+	pop rbp ; Restore the base pointer
+	ret
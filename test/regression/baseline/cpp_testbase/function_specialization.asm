@@ -0,0 +1,252 @@
+section .data
+
+section .rodata
+
+section .bss
+
+section .text
+	extern printnum:function
+
+	global scaled:function
+	global banner:function
+	global ticks:function
+	global mix:function
+	global product:function
+	global bump:function
+	global main:function
+	global _start:function
+
+_start:
+	call main
+	mov rdi, rax            ; Exit code (0) expects return of main to be put in rax for now
+	mov rax, 60                  ; Syscall number for exit (60)
+	syscall                      ; Make the syscall
+
+scaled:
+	mov r10d, 7 ; Loading number literal
+	mov eax, r10d
+	lea eax, [rax+rax*2]
+	shl eax, 1
+	mov r10d, eax
+	mov eax, r10d
+._U0_return:
+	ret
+scaled.d.d:
+	mov r10d, 7 ; Loading number literal
+	mov eax, r10d
+	lea eax, [rax+rax*2]
+	shl eax, 1
+	mov r10d, eax
+	mov eax, r10d
+._U1_return:
+	ret
+scaled._.d:
+	mov r10d, 7 ; Loading number literal
+	mov eax, r10d
+	lea eax, [rax+rax*2]
+	shl eax, 1
+	mov r10d, eax
+	mov eax, r10d
+._U2_return:
+	ret
+banner:
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	mov edi, 100 ; Loading number literal
+	call printnum
+._U3_return:
+	pop rbp ; Restore the base pointer
+	ret
+banner.d:
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	mov edi, 100 ; Loading number literal
+	call printnum
+._U4_return:
+	pop rbp ; Restore the base pointer
+	ret
+ticks:
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	mov edi, 5 ; Loading number literal
+	call printnum
+	mov eax, 2 ; Loading number literal
+._U5_return:
+	pop rbp ; Restore the base pointer
+	ret
+mix:
+	mov r10d, 17 ; Loading number literal
+	xor r11d, r11d
+._U8_for:
+	mov eax, r10d
+	imul eax, eax, 31
+	add eax, r11d
+	mov r10d, eax
+	mov eax, r10d
+	movsxd rcx, eax
+	imul rcx, rcx, 274877907
+	sar rcx, 32
+	sar ecx, 6
+	mov edx, eax
+	shr edx, 31
+	add ecx, edx
+	imul ecx, ecx, 1000
+	sub eax, ecx
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	cmp r11d, 4
+	jl ._U8_for
+._U7_for.end:
+	mov eax, r10d
+._U6_return:
+	ret
+mix.d:
+	mov r10d, 17 ; Loading number literal
+	xor r11d, r11d
+._U11_for:
+	mov eax, r10d
+	imul eax, eax, 31
+	add eax, r11d
+	mov r10d, eax
+	mov eax, r10d
+	movsxd rcx, eax
+	imul rcx, rcx, 274877907
+	sar rcx, 32
+	sar ecx, 6
+	mov edx, eax
+	shr edx, 31
+	add ecx, edx
+	imul ecx, ecx, 1000
+	sub eax, ecx
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	cmp r11d, 4
+	jl ._U11_for
+._U10_for.end:
+	mov eax, r10d
+._U9_return:
+	ret
+product:
+	mov r10d, edi
+	imul r10d, esi
+	xor r11d, r11d
+	lea eax, [r10+r11*1]
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	lea eax, [r10+r11*1]
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	lea eax, [r10+r11*1]
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+._U15_for.end:
+	mov eax, r10d
+._U12_return:
+	ret
+product.k6.k7:
+	mov r10d, 42 ; Loading number literal
+	xor r11d, r11d
+	lea eax, [r10+r11*1]
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	lea eax, [r10+r11*1]
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	lea eax, [r10+r11*1]
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+._U19_for.end:
+	mov eax, r10d
+._U16_return:
+	ret
+bump:
+	lea eax, [rsi+1]
+	mov esi, eax
+	lea eax, [rdi+rsi*1]
+._U20_return:
+	ret
+main:
+	push r12
+	push r13
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	xor r12d, r12d
+	xor r13d, r13d
+	call scaled.d.d
+	add eax, r12d
+	mov r12d, eax
+	lea eax, [r13+1]
+	mov r13d, eax
+	call scaled.d.d
+	add eax, r12d
+	mov r12d, eax
+	lea eax, [r13+1]
+	mov r13d, eax
+	call scaled.d.d
+	add eax, r12d
+	mov r12d, eax
+	lea eax, [r13+1]
+	mov r13d, eax
+	call scaled.d.d
+	add eax, r12d
+	mov r12d, eax
+	lea eax, [r13+1]
+	mov r13d, eax
+	call scaled.d.d
+	add eax, r12d
+	mov r12d, eax
+	lea eax, [r13+1]
+	mov r13d, eax
+._U24_for.end:
+	mov edi, r12d
+	call printnum
+	call banner.d
+	call banner.d
+	call ticks
+	mov edi, eax
+	call scaled._.d
+	mov edi, eax
+	call printnum
+	call mix.d
+	mov edi, eax
+	push rdi
+	sub rsp, 8 ; Aligning the stack for the call
+	call mix.d
+	add rsp, 8
+	pop rdi
+	add edi, eax
+	call printnum
+	call product.k6.k7
+	mov edi, eax
+	call printnum
+	mov r12d, 3 ; Loading number literal
+	xor r13d, r13d
+	mov edi, r12d
+	mov esi, 2 ; Loading number literal
+	call bump
+	mov r12d, eax
+	lea eax, [r13+1]
+	mov r13d, eax
+	mov edi, r12d
+	mov esi, 2 ; Loading number literal
+	call bump
+	mov r12d, eax
+	lea eax, [r13+1]
+	mov r13d, eax
+._U27_for.end:
+	mov edi, r12d
+	call printnum
+	xor eax, eax
+._U21_return:
+	pop rbp ; Restore the base pointer
+	pop r13
+	pop r12
+	ret
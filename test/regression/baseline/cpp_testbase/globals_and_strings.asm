@@ -0,0 +1,143 @@
+section .data
+	align 4
+	global base:data 4
+base:
+base.local:
+	dd 10
+	align 1
+	global sign:data 1
+sign:
+sign.local:
+	db -2
+	align 8
+	global greeting:data 8
+greeting:
+greeting.local:
+	dq __zpp_str.0
+
+section .rodata
+	align 4
+	global scale:data 4
+scale:
+scale.local:
+	dd 3
+	align 4
+	global limit:data 4
+limit:
+limit.local:
+	dd 13
+	align 16, db 0
+__zpp_str.0:
+	db 'Hello, '
+__zpp_str.1:
+	db 'wor'
+__zpp_str.2:
+	db 'ld', 10, 0
+	align 16, db 0
+__zpp_str.3:
+	db 'A literal longer than one sixteen byte block', 10, 0
+
+section .bss
+	alignb 4
+	global counter:data 4
+counter:
+counter.local:
+	resb 4
+	alignb 4
+	global origin:data 12
+origin:
+origin.local:
+	resb 12
+
+section .text
+	extern print:function
+	extern printnum:function
+
+	global bump:function
+	global readBase:function
+	global resetBase:function
+	global main:function
+	global _start:function
+
+_start:
+	call main
+	mov rdi, rax            ; Exit code (0) expects return of main to be put in rax for now
+	mov rax, 60                  ; Syscall number for exit (60)
+	syscall                      ; Make the syscall
+
+bump:
+	mov eax, [rel counter.local] ; Loading value from memory
+	add eax, dword [rel base.local]
+	mov [rel counter.local], eax ; Storing value in memory
+._U0_return:
+	ret
+readBase:
+	mov eax, [rel base.local] ; Loading value from memory
+._U1_return:
+	ret
+resetBase:
+	mov eax, 4 ; Loading number literal
+	mov [rel base.local], eax ; Storing value in memory
+._U2_return:
+	ret
+main:
+	push r12
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 8 ; Creating space on the stack
+	mov rdi, [rel greeting.local] ; Loading value from memory
+	call print
+	lea rdi, [rel __zpp_str.1]
+	call print
+	lea rdi, [rel __zpp_str.1]
+	call print
+	lea rdi, [rel __zpp_str.2]
+	call print
+	lea rdi, [rel __zpp_str.3]
+	call print
+	xor r12d, r12d
+	cmp dword [rel counter.local], 25
+	jge ._U5_while.end
+._U4_while:
+	call bump
+	mov eax, [rel counter.local] ; Loading value from memory
+	shl eax, 1
+	add eax, r12d
+	add eax, 3
+	mov r12d, eax
+	cmp dword [rel counter.local], 25
+	jl ._U4_while
+._U5_while.end:
+	mov edi, r12d
+	call printnum
+	mov edi, [rel counter.local] ; Loading value from memory
+	call printnum
+	mov edi, 13 ; Loading number literal
+	call printnum
+	movsx edi, byte [rel sign.local] ; Loading value from memory
+	add edi, 5
+	call printnum
+	mov eax, 7 ; Loading number literal
+	mov [rel origin.local], eax ; Storing value in memory
+	mov eax, 2 ; Loading number literal
+	mov [rel origin.local+4], al ; Storing value in memory
+	movsx eax, byte [rel origin.local+4] ; Loading value from memory
+	mov eax, [rel origin.local] ; Loading value from memory
+	lea eax, [rax+rax*2]
+	movsx ecx, byte [rel origin.local+4] ; Loading value from memory
+	add eax, ecx
+	mov [rel origin.local+8], eax ; Storing value in memory
+	mov edi, eax
+	call printnum
+	mov r12d, 100 ; Loading number literal
+	call resetBase
+	call readBase
+	mov edi, eax
+	add edi, r12d
+	call printnum
+	xor eax, eax
+._U3_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop r12
+	ret
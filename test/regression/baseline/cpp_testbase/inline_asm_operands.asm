@@ -0,0 +1,174 @@
+section .data
+
+section .rodata
+
+section .bss
+
+section .text
+	extern printnum:function
+
+	global triple:function
+	global bump:function
+	global difference:function
+	global keep:function
+	global narrow:function
+	global outputs:function
+	global loop:function
+	global main:function
+	global _start:function
+
+_start:
+	call main
+	mov rdi, rax            ; Exit code (0) expects return of main to be put in rax for now
+	mov rax, 60                  ; Syscall number for exit (60)
+	syscall                      ; Make the syscall
+
+triple:
+	mov r10d, 0 ; Loading number literal
+;-- START -- asm binding requests
+;-- START -- user defined
+	lea eax, [rdi+rdi*2]
+
+;-- END -- user defined
+	mov r10d, eax
+	mov eax, r10d
+._U0_return:
+	ret
+bump:
+;-- START -- asm binding requests
+	mov ecx, edi
+;-- START -- user defined
+	add ecx, 100
+
+;-- END -- user defined
+	mov edi, ecx
+	mov eax, edi
+._U1_return:
+	ret
+difference:
+	mov r10d, 0 ; Loading number literal
+;-- START -- asm binding requests
+	xchg rsi, rdi
+;-- START -- user defined
+	mov eax, esi
+	sub eax, edi
+
+;-- END -- user defined
+	mov r10d, eax
+	mov eax, r10d
+._U2_return:
+	ret
+keep:
+	push rbx
+	lea r10d, [rdi+rsi*1]
+	mov r11d, 0 ; Loading number literal
+;-- START -- asm binding requests
+;-- START -- user defined
+	mov edx, 7
+	mov r8d, 9
+	mov eax, edx
+	add eax, r8d
+
+;-- END -- user defined
+	mov r11d, eax
+;-- START -- asm binding requests
+;-- START -- user defined
+	mov ebx, 1000
+
+;-- END -- user defined
+	mov eax, r10d
+	imul eax, eax, 100
+	add eax, r11d
+._U3_return:
+	pop rbx
+	ret
+narrow:
+	mov r10d, 0 ; Loading number literal
+;-- START -- asm binding requests
+;-- START -- user defined
+	mov al, -3
+
+;-- END -- user defined
+	movsx r10d, al
+	movsx eax, r10b
+	add eax, 10
+._U4_return:
+	ret
+outputs:
+	mov r10d, 0 ; Loading number literal
+	mov r11d, 0 ; Loading number literal
+;-- START -- asm binding requests
+;-- START -- user defined
+	mov eax, 1
+	mov ecx, 2
+
+;-- END -- user defined
+	mov r10d, eax
+	mov r11d, ecx
+	mov eax, r10d
+	lea eax, [rax+rax*4]
+	shl eax, 1
+	add eax, r11d
+._U5_return:
+	ret
+loop:
+	xor r10d, r10d
+	xor r11d, r11d
+	cmp r11d, edi
+	jge ._U10_while.end
+._U9_while:
+	mov esi, 0 ; Loading number literal
+;-- START -- asm binding requests
+;-- START -- user defined
+	mov eax, 11
+
+;-- END -- user defined
+	mov esi, eax
+	mov eax, esi
+	imul eax, r11d
+	add eax, r10d
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	cmp r11d, edi
+	jl ._U9_while
+._U10_while.end:
+	mov eax, r10d
+._U6_return:
+	ret
+main:
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	mov edi, 14 ; Loading number literal
+	call triple
+	mov edi, eax
+	call printnum
+	mov edi, 5 ; Loading number literal
+	call bump
+	mov edi, eax
+	call printnum
+	mov edi, 50 ; Loading number literal
+	mov esi, 8 ; Loading number literal
+	call difference
+	mov edi, eax
+	call printnum
+	mov edi, 3 ; Loading number literal
+	mov esi, 4 ; Loading number literal
+	call keep
+	mov edi, eax
+	call printnum
+	call narrow
+	mov edi, eax
+	call printnum
+	call outputs
+	mov edi, eax
+	call printnum
+	mov edi, 10 ; Loading number literal
+	call loop
+	mov edi, eax
+	add edi, 550
+	call printnum
+	xor eax, eax
+._U11_return:
+	pop rbp ; Restore the base pointer
+	ret
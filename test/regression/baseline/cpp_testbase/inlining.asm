@@ -0,0 +1,259 @@
+section .data
+
+section .rodata
+
+section .bss
+
+section .text
+	extern printnum:function
+
+	global report:function
+	global reportTwice:function
+	global classify:function
+	global consume:function
+	global outOfLine:function
+	global withAsm:function
+	global forcedAsm:function
+	global main:function
+	global _start:function
+
+_start:
+	call main
+	mov rdi, rax            ; Exit code (0) expects return of main to be put in rax for now
+	mov rax, 60                  ; Syscall number for exit (60)
+	syscall                      ; Make the syscall
+
+report:
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	mov r10d, 7 ; Loading number literal
+	mov edi, r10d
+	lea edi, [rdi+rdi*2]
+	shl edi, 1
+	call printnum
+._U0_return:
+	pop rbp ; Restore the base pointer
+	ret
+reportTwice:
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	mov r10d, 7 ; Loading number literal
+	mov edi, r10d
+	lea edi, [rdi+rdi*2]
+	shl edi, 1
+	call printnum
+._U2_inlined_return:
+	mov r10d, 7 ; Loading number literal
+	mov edi, r10d
+	lea edi, [rdi+rdi*2]
+	shl edi, 1
+	call printnum
+._U3_inlined_return:
+._U1_return:
+	pop rbp ; Restore the base pointer
+	ret
+classify:
+	push r12
+	push r13
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	mov r12d, 3 ; Loading number literal
+	mov r13d, 8 ; Loading number literal
+	cmp r12d, r13d
+	jle ._U6_end_if
+	mov edi, 100 ; Loading number literal
+	call printnum
+	mov eax, 1 ; Loading number literal
+	jmp ._U4_return
+._U6_end_if:
+	mov eax, r13d
+	sub eax, r12d
+	cmp eax, 5
+	jne ._U8_end_if
+	mov edi, 200 ; Loading number literal
+	call printnum
+	mov eax, 2 ; Loading number literal
+	jmp ._U4_return
+._U8_end_if:
+	mov edi, 300 ; Loading number literal
+	call printnum
+	mov eax, 3 ; Loading number literal
+._U4_return:
+	pop rbp ; Restore the base pointer
+	pop r13
+	pop r12
+	ret
+consume:
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	mov r10d, 11 ; Loading number literal
+	mov edi, r10d
+	call printnum
+._U9_return:
+	pop rbp ; Restore the base pointer
+	ret
+outOfLine:
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	mov edi, 1000 ; Loading number literal
+	call printnum
+._U10_return:
+	pop rbp ; Restore the base pointer
+	ret
+withAsm:
+	push r12
+	push r13
+	push r14
+	push r15
+	push rbx
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 8 ; Creating space on the stack
+;-- START -- asm binding requests
+;-- START -- user defined
+nop
+;-- END -- user defined
+	mov edi, 2000 ; Loading number literal
+	call printnum
+._U11_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop rbx
+	pop r15
+	pop r14
+	pop r13
+	pop r12
+	ret
+forcedAsm:
+	push r12
+	push r13
+	push r14
+	push r15
+	push rbx
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 8 ; Creating space on the stack
+;-- START -- asm binding requests
+;-- START -- user defined
+nop
+;-- END -- user defined
+	mov edi, 3000 ; Loading number literal
+	call printnum
+._U12_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop rbx
+	pop r15
+	pop r14
+	pop r13
+	pop r12
+	ret
+main:
+	push r12
+	push r13
+	push r14
+	push r15
+	push rbx
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 8 ; Creating space on the stack
+	mov r10d, 7 ; Loading number literal
+	mov edi, r10d
+	lea edi, [rdi+rdi*2]
+	shl edi, 1
+	call printnum
+._U14_inlined_return:
+	mov r10d, 7 ; Loading number literal
+	mov edi, r10d
+	lea edi, [rdi+rdi*2]
+	shl edi, 1
+	call printnum
+._U16_inlined_return:
+	mov r10d, 7 ; Loading number literal
+	mov edi, r10d
+	lea edi, [rdi+rdi*2]
+	shl edi, 1
+	call printnum
+._U17_inlined_return:
+._U15_inlined_return:
+	mov r12d, 3 ; Loading number literal
+	mov r13d, 8 ; Loading number literal
+	cmp r12d, r13d
+	jle ._U20_end_if
+	mov edi, 100 ; Loading number literal
+	call printnum
+	jmp ._U18_inlined_return
+._U20_end_if:
+	mov eax, r13d
+	sub eax, r12d
+	cmp eax, 5
+	jne ._U22_end_if
+	mov edi, 200 ; Loading number literal
+	call printnum
+	jmp ._U18_inlined_return
+._U22_end_if:
+	mov edi, 300 ; Loading number literal
+	call printnum
+._U18_inlined_return:
+	mov r12d, 1 ; Loading number literal
+	mov r13d, 2 ; Loading number literal
+	mov r10d, r13d
+	mov r10d, r12d
+	mov r10d, 11 ; Loading number literal
+	mov edi, r10d
+	call printnum
+._U23_inlined_return:
+	mov edi, r12d
+	call printnum
+	mov edi, r13d
+	call printnum
+	call outOfLine
+	call withAsm
+;-- START -- asm binding requests
+;-- START -- user defined
+nop
+;-- END -- user defined
+	mov edi, 3000 ; Loading number literal
+	call printnum
+._U24_inlined_return:
+	xor r12d, r12d
+	xor r13d, r13d
+._U26_for:
+	mov r14d, 3 ; Loading number literal
+	mov r15d, 8 ; Loading number literal
+	cmp r14d, r15d
+	jle ._U29_end_if
+	mov edi, 100 ; Loading number literal
+	call printnum
+	jmp ._U27_inlined_return
+._U29_end_if:
+	mov eax, r15d
+	sub eax, r14d
+	cmp eax, 5
+	jne ._U31_end_if
+	mov edi, 200 ; Loading number literal
+	call printnum
+	jmp ._U27_inlined_return
+._U31_end_if:
+	mov edi, 300 ; Loading number literal
+	call printnum
+._U27_inlined_return:
+	lea eax, [r12+r13*1]
+	mov r12d, eax
+	lea eax, [r13+1]
+	mov r13d, eax
+	cmp r13d, 3
+	jl ._U26_for
+._U25_for.end:
+	mov edi, r12d
+	call printnum
+	xor eax, eax
+._U13_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop rbx
+	pop r15
+	pop r14
+	pop r13
+	pop r12
+	ret
@@ -0,0 +1,130 @@
+section .data
+
+section .rodata
+
+section .bss
+
+section .text
+	extern printnum:function
+
+	global main:function
+	global _start:function
+
+_start:
+	call main
+	mov rdi, rax            ; Exit code (0) expects return of main to be put in rax for now
+	mov rax, 60                  ; Syscall number for exit (60)
+	syscall                      ; Make the syscall
+
+main:
+	push r12
+	push r13
+	push r14
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 8 ; Creating space on the stack
+	mov r12d, 4294967291 ; Loading number literal
+	mov r13d, 3 ; Loading number literal
+	cmp r12d, r13d
+	setl r14b
+	movzx r14d, r14b
+	mov edi, r14d
+	call printnum
+	cmp r12d, r13d
+	setg al
+	movzx eax, al
+	mov r14d, eax
+	mov edi, r14d
+	call printnum
+	cmp r12d, 0
+	jge ._U2_end_if
+	mov edi, 1 ; Loading number literal
+	call printnum
+._U2_end_if:
+	xor r10d, r10d
+	mov r11d, 4294967286 ; Loading number literal
+	cmp r11d, 10
+	jge ._U3_for.end
+._U4_for:
+	lea eax, [r10+1]
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	cmp r11d, 10
+	jl ._U4_for
+._U3_for.end:
+	mov edi, r10d
+	call printnum
+	mov r12d, 100 ; Loading number literal
+	mov r13d, 200 ; Loading number literal
+	movsx eax, r12b
+	movsx ecx, r13b
+	add eax, ecx
+	mov r14d, eax
+	mov edi, r14d
+	call printnum
+	movsx eax, r13b
+	mov r14d, eax
+	mov edi, r14d
+	call printnum
+	movsx eax, r13b
+	movsx ecx, r12b
+	cmp eax, ecx
+	setl al
+	movzx eax, al
+	mov r14d, eax
+	mov edi, r14d
+	call printnum
+	movsx eax, r12b
+	movsx ecx, r12b
+	add eax, ecx
+	mov r12d, eax
+	movsx edi, r12b
+	call printnum
+	movsx eax, r12b
+	shl eax, 1
+	movsxd rcx, eax
+	imul rcx, rcx, 1431655766
+	sar rcx, 32
+	shr eax, 31
+	add eax, ecx
+	mov r14d, eax
+	mov edi, r14d
+	call printnum
+	xor r12d, r12d
+	mov eax, 300 ; Loading number literal
+	mov r12d, eax
+	movsx eax, r12b
+	mov r14d, eax
+	mov edi, r14d
+	call printnum
+	mov r10d, 70000 ; Loading number literal
+	mov eax, r10d
+	mov r12d, eax
+	movsx eax, r12b
+	movsx edi, r12b
+	call printnum
+	movsx eax, r12b
+	mov r12d, eax
+	mov edi, r12d
+	call printnum
+	mov r12d, 2147483647 ; Loading number literal
+	lea eax, [r12+1]
+	mov r14d, eax
+	mov edi, r14d
+	call printnum
+	lea eax, [r12+1]
+	cmp eax, r12d
+	setl al
+	movzx eax, al
+	mov r14d, eax
+	mov edi, r14d
+	call printnum
+	xor eax, eax
+._U0_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop r14
+	pop r13
+	pop r12
+	ret
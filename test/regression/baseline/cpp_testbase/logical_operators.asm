@@ -0,0 +1,553 @@
+section .data
+
+section .rodata
+
+section .bss
+
+section .text
+	extern printnum:function
+
+	global crowdedLogic:function
+	global main:function
+	global _start:function
+
+_start:
+	call main
+	mov rdi, rax            ; Exit code (0) expects return of main to be put in rax for now
+	mov rax, 60                  ; Syscall number for exit (60)
+	syscall                      ; Make the syscall
+
+crowdedLogic:
+	push r12
+	push r13
+	push r14
+	push r15
+	push rbx
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 24 ; Creating space on the stack
+	mov [rbp-4], edi ; Storing value in memory
+	mov [rbp-8], r8d ; Storing value in memory
+	mov r13d, edx
+	mov r14d, dword [rsp+80] ; Loading stack argument
+	xor eax, eax
+	mov [rbp-12], eax ; Storing value in memory
+	xor ebx, ebx
+	mov r10d, ecx
+	movsxd rax, r10d
+	imul rax, rax, 1717986919
+	sar rax, 32
+	sar eax, 1
+	mov edx, r10d
+	shr edx, 31
+	add eax, edx
+	imul eax, eax, 5
+	sub r10d, eax
+	add r10d, 6
+	mov r11d, r14d
+	movsxd rax, r11d
+	imul rax, rax, 1717986919
+	sar rax, 32
+	sar eax, 1
+	mov edx, r11d
+	shr edx, 31
+	add eax, edx
+	imul eax, eax, 5
+	sub r11d, eax
+	add r11d, 6
+	mov r8d, esi
+	movsxd rax, r8d
+	imul rax, rax, 1431655766
+	sar rax, 32
+	mov edx, r8d
+	shr edx, 31
+	add eax, edx
+	imul eax, eax, 3
+	sub r8d, eax
+._U2_for:
+	mov r12d, [rbp-4] ; Loading value from memory
+	sub r12d, ebx
+	lea r15d, [rsi+rbx*1]
+	mov eax, r13d
+	mov edi, r10d
+	cdq
+	idiv edi
+	mov eax, edx
+	test rax, rax
+	je ._U6_logical.skip
+	mov eax, [rbp-8] ; Loading value from memory
+	imul eax, r9d
+	mov edi, r11d
+	cdq
+	idiv edi
+	test rax, rax
+	jne ._U5_logical.skip
+._U6_logical.skip:
+	cmp ebx, 3
+	jne ._U4_end_if
+._U5_logical.skip:
+	push rsi ; Spilling register
+	mov esi, [rbp-8] ; Loading value from memory
+	push rax ; Spilling register
+	movsxd rax, esi
+	imul rax, rax, 1717986919
+	sar rax, 32
+	sar eax, 1
+	push rdx ; Spilling register
+	mov edx, esi
+	shr edx, 31
+	add eax, edx
+	imul eax, eax, 5
+	sub esi, eax
+	pop rdx ; Reloading spilled register
+	pop rax ; Reloading spilled register
+	add esi, 6
+	mov edi, r13d
+	push rax
+	push rdx
+	mov eax, edi
+	cdq
+	idiv esi
+	mov edi, edx
+	pop rdx
+	pop rax
+	pop rsi ; Reloading spilled register
+	test rdi, rdi
+	jne ._U7_logical.shortcut
+	push rsi ; Spilling register
+	mov esi, r12d
+	push rax ; Spilling register
+	movsxd rax, esi
+	imul rax, rax, 1717986919
+	sar rax, 32
+	sar eax, 1
+	push rdx ; Spilling register
+	mov edx, esi
+	shr edx, 31
+	add eax, edx
+	imul eax, eax, 5
+	sub esi, eax
+	pop rdx ; Reloading spilled register
+	pop rax ; Reloading spilled register
+	add esi, 6
+	mov edi, ecx
+	push rax
+	push rdx
+	mov eax, edi
+	cdq
+	idiv esi
+	mov edi, eax
+	pop rdx
+	pop rax
+	pop rsi ; Reloading spilled register
+	test rdi, rdi
+	je ._U9_logical.shortcut
+	mov edx, r14d
+	test rdx, rdx
+	setne dl
+	movzx edx, dl
+	jmp ._U10_logical.end
+._U9_logical.shortcut:
+	xor edx, edx
+._U10_logical.end:
+	test rdx, rdx
+	setne dl
+	movzx edx, dl
+	jmp ._U8_logical.end
+._U7_logical.shortcut:
+	mov edx, 1 ; Loading number literal
+._U8_logical.end:
+	mov edi, r15d
+	test rdi, rdi
+	je ._U11_logical.shortcut
+	mov eax, r9d
+	test rax, rax
+	setne al
+	movzx eax, al
+	jmp ._U12_logical.end
+._U11_logical.shortcut:
+	xor eax, eax
+._U12_logical.end:
+	push rax ; Spilling register
+	mov eax, r12d
+	test rax, rax
+	pop rax ; Reloading spilled register
+	je ._U13_logical.shortcut
+	mov edi, 7 ; Loading number literal
+	test rdi, rdi
+	setne dil
+	movzx edi, dil
+	jmp ._U14_logical.end
+._U13_logical.shortcut:
+	xor edi, edi
+._U14_logical.end:
+	add eax, edi
+	lea eax, [rax+rax*4]
+	shl eax, 1
+	add eax, edx
+	add eax, dword [rbp-12]
+	mov [rbp-12], eax ; Storing value in memory
+._U4_end_if:
+	mov edi, [rbp-12] ; Loading value from memory
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	cmp r14d, ebx
+	setg al
+	movzx eax, al
+	add eax, dword [rbp-4]
+	sub eax, r8d
+	mov [rbp-4], eax ; Storing value in memory
+	mov edx, r12d
+	test rdx, rdx
+	jne ._U15_logical.shortcut
+	mov eax, r15d
+	test rax, rax
+	setne al
+	movzx eax, al
+	jmp ._U16_logical.end
+._U15_logical.shortcut:
+	mov eax, 1 ; Loading number literal
+._U16_logical.end:
+	shl eax, 1
+	add eax, dword [rbp-8]
+	mov [rbp-8], eax ; Storing value in memory
+	lea eax, [rbx+1]
+	mov ebx, eax
+	cmp ebx, 4
+	jl ._U2_for
+._U1_for.end:
+	mov eax, [rbp-12] ; Loading value from memory
+	add eax, dword [rbp-4]
+	add eax, dword [rbp-8]
+._U0_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop rbx
+	pop r15
+	pop r14
+	pop r13
+	pop r12
+	ret
+main:
+	push r12
+	push r13
+	push r14
+	push r15
+	push rbx
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 8 ; Creating space on the stack
+	mov r12d, 5 ; Loading number literal
+	xor r13d, r13d
+	mov r14d, 4294967293 ; Loading number literal
+	xor r15d, r15d
+	cmp r12d, 0
+	jle ._U19_end_if
+	cmp r14d, 0
+	jge ._U19_end_if
+	mov edi, 1 ; Loading number literal
+	call printnum
+._U19_end_if:
+	cmp r13d, 0
+	je ._U20_else
+	mov eax, r12d
+	mov ecx, r13d
+	cdq
+	idiv ecx
+	cmp eax, 1
+	jle ._U20_else
+	mov edi, 2 ; Loading number literal
+	call printnum
+	jmp ._U21_end_if
+._U20_else:
+	mov edi, 3 ; Loading number literal
+	call printnum
+._U21_end_if:
+	cmp r15d, 0
+	je ._U24_logical.skip
+	mov eax, r12d
+	mov ecx, r15d
+	cdq
+	idiv ecx
+	cmp eax, 1
+	jle ._U23_end_if
+._U24_logical.skip:
+	mov edi, 4 ; Loading number literal
+	call printnum
+._U23_end_if:
+	cmp r12d, 3
+	jle ._U27_logical.skip
+	mov eax, r13d
+	test rax, rax
+	je ._U25_else
+._U27_logical.skip:
+	mov edi, 5 ; Loading number literal
+	call printnum
+	jmp ._U26_end_if
+._U25_else:
+	mov edi, 6 ; Loading number literal
+	call printnum
+._U26_end_if:
+	mov eax, r13d
+	test rax, rax
+	jne ._U29_end_if
+	cmp r14d, 0
+	jg ._U29_end_if
+	mov edi, 7 ; Loading number literal
+	call printnum
+._U29_end_if:
+	mov eax, r13d
+	test rax, rax
+	jne ._U32_logical.skip
+	cmp r12d, 5
+	jne ._U31_end_if
+	mov eax, r14d
+	mov ecx, 4294967293 ; Loading number literal
+	cmp eax, ecx
+	jne ._U31_end_if
+._U32_logical.skip:
+	mov edi, 8 ; Loading number literal
+	call printnum
+._U31_end_if:
+	mov eax, r13d
+	test rax, rax
+	jne ._U35_logical.skip
+	cmp r12d, 5
+	jne ._U33_else
+._U35_logical.skip:
+	cmp r14d, 0
+	jle ._U33_else
+	mov edi, 9 ; Loading number literal
+	call printnum
+	jmp ._U34_end_if
+._U33_else:
+	mov edi, 10 ; Loading number literal
+	call printnum
+._U34_end_if:
+	mov eax, r12d
+	test rax, rax
+	je ._U36_logical.shortcut
+	mov ebx, r14d
+	test rbx, rbx
+	setne bl
+	movzx ebx, bl
+	jmp ._U37_logical.end
+._U36_logical.shortcut:
+	xor ebx, ebx
+._U37_logical.end:
+	mov edi, ebx
+	call printnum
+	mov ecx, r12d
+	test rcx, rcx
+	je ._U38_logical.shortcut
+	mov eax, r13d
+	test rax, rax
+	setne al
+	movzx eax, al
+	jmp ._U39_logical.end
+._U38_logical.shortcut:
+	xor eax, eax
+._U39_logical.end:
+	mov ebx, eax
+	mov edi, ebx
+	call printnum
+	mov ecx, r13d
+	test rcx, rcx
+	jne ._U40_logical.shortcut
+	mov eax, r15d
+	test rax, rax
+	setne al
+	movzx eax, al
+	jmp ._U41_logical.end
+._U40_logical.shortcut:
+	mov eax, 1 ; Loading number literal
+._U41_logical.end:
+	mov ebx, eax
+	mov edi, ebx
+	call printnum
+	mov ecx, r13d
+	test rcx, rcx
+	jne ._U42_logical.shortcut
+	mov eax, r14d
+	test rax, rax
+	setne al
+	movzx eax, al
+	jmp ._U43_logical.end
+._U42_logical.shortcut:
+	mov eax, 1 ; Loading number literal
+._U43_logical.end:
+	mov ebx, eax
+	mov edi, ebx
+	call printnum
+	mov eax, r12d
+	test rax, rax
+	sete al
+	movzx eax, al
+	mov ebx, eax
+	mov edi, ebx
+	call printnum
+	mov eax, r13d
+	test rax, rax
+	sete al
+	movzx eax, al
+	mov ecx, r15d
+	test rcx, rcx
+	sete cl
+	movzx ecx, cl
+	add eax, ecx
+	mov ecx, r12d
+	test rcx, rcx
+	setne cl
+	movzx ecx, cl
+	add eax, ecx
+	mov ebx, eax
+	mov edi, ebx
+	call printnum
+	cmp r12d, 4
+	jle ._U44_logical.shortcut
+	cmp r14d, 0
+	setl al
+	movzx eax, al
+	jmp ._U45_logical.end
+._U44_logical.shortcut:
+	xor eax, eax
+._U45_logical.end:
+	cmp r12d, 4
+	jl ._U46_logical.shortcut
+	cmp r13d, 0
+	sete cl
+	movzx ecx, cl
+	jmp ._U47_logical.end
+._U46_logical.shortcut:
+	mov ecx, 1 ; Loading number literal
+._U47_logical.end:
+	lea ecx, [rcx+rcx*4]
+	shl ecx, 1
+	add eax, ecx
+	mov ebx, eax
+	mov edi, ebx
+	call printnum
+	xor r10d, r10d
+	xor r14d, r14d
+	cmp r10d, 10
+	jge ._U49_while.end
+	cmp r14d, 20
+	jge ._U49_while.end
+._U48_while:
+	lea eax, [r14+r10*1]
+	mov r14d, eax
+	lea eax, [r10+1]
+	mov r10d, eax
+	cmp r10d, 10
+	jge ._U50_logical.skip
+	cmp r14d, 20
+	jl ._U48_while
+._U50_logical.skip:
+._U49_while.end:
+	mov edi, r10d
+	call printnum
+	mov edi, r14d
+	call printnum
+	xor r14d, r14d
+	cmp r14d, 6
+	jl ._U53_logical.skip
+	cmp r14d, 8
+	jne ._U51_for.end
+._U53_logical.skip:
+._U52_for:
+	cmp r14d, 2
+	je ._U55_end_if
+	cmp r14d, 4
+	je ._U55_end_if
+	mov edi, r14d
+	imul edi, edi, 100
+	call printnum
+._U55_end_if:
+	lea eax, [r14+1]
+	mov r14d, eax
+	cmp r14d, 6
+	jl ._U52_for
+	cmp r14d, 8
+	je ._U52_for
+._U51_for.end:
+	xor r14d, r14d
+	mov eax, r13d
+	test rax, rax
+	je ._U57_end_if
+	lea eax, [r14+1]
+	mov r14d, eax
+	test rax, rax
+	je ._U57_end_if
+	mov edi, 11 ; Loading number literal
+	call printnum
+._U57_end_if:
+	mov eax, r12d
+	test rax, rax
+	jne ._U60_logical.skip
+	lea eax, [r14+10]
+	mov r14d, eax
+	test rax, rax
+	je ._U59_end_if
+._U60_logical.skip:
+	mov edi, 12 ; Loading number literal
+	call printnum
+._U59_end_if:
+	mov eax, r12d
+	test rax, rax
+	je ._U62_end_if
+	lea eax, [r14+100]
+	mov r14d, eax
+	test rax, rax
+	je ._U62_end_if
+	mov edi, 13 ; Loading number literal
+	call printnum
+._U62_end_if:
+	mov edi, r14d
+	call printnum
+	mov edi, 2 ; Loading number literal
+	mov esi, 1 ; Loading number literal
+	mov edx, 15 ; Loading number literal
+	mov ecx, 4 ; Loading number literal
+	mov r8d, 15 ; Loading number literal
+	mov r9d, 4 ; Loading number literal
+	sub rsp, 16 ; Reserving the stack arguments
+	mov eax, 16 ; Loading number literal
+	mov [rsp], rax ; Stack argument
+	call crowdedLogic
+	add rsp, 16
+	mov edi, eax
+	call printnum
+	xor edi, edi
+	xor esi, esi
+	xor edx, edx
+	mov ecx, 13 ; Loading number literal
+	mov r8d, 4 ; Loading number literal
+	xor r9d, r9d
+	sub rsp, 16 ; Reserving the stack arguments
+	mov eax, 6 ; Loading number literal
+	mov [rsp], rax ; Stack argument
+	call crowdedLogic
+	add rsp, 16
+	mov edi, eax
+	call printnum
+	xor eax, eax
+._U17_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop rbx
+	pop r15
+	pop r14
+	pop r13
+	pop r12
+	ret
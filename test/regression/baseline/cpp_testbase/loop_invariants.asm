@@ -0,0 +1,179 @@
+section .data
+
+section .rodata
+
+section .bss
+
+section .text
+	extern printnum:function
+
+	global main:function
+	global _start:function
+
+_start:
+	call main
+	mov rdi, rax            ; Exit code (0) expects return of main to be put in rax for now
+	mov rax, 60                  ; Syscall number for exit (60)
+	syscall                      ; Make the syscall
+
+main:
+	push r12
+	push r13
+	push r14
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 8 ; Creating space on the stack
+	mov r12d, 6 ; Loading number literal
+	mov r13d, 3 ; Loading number literal
+	mov r14d, 10 ; Loading number literal
+	xor r10d, r10d
+	xor r11d, r11d
+	mov esi, r12d
+	shl esi, 1
+	sub esi, 1
+	lea edi, [r13+r14*1]
+	cmp r10d, esi
+	jge ._U2_while.end
+._U1_while:
+	mov eax, r10d
+	imul eax, edi
+	add eax, r11d
+	mov r11d, eax
+	lea eax, [r10+1]
+	mov r10d, eax
+	cmp r10d, esi
+	jl ._U1_while
+._U2_while.end:
+	mov edi, r11d
+	call printnum
+	xor r10d, r10d
+	xor r11d, r11d
+	lea esi, [r12+r12*1]
+	mov edi, r14d
+	sub edi, r13d
+	shl edi, 1
+	cmp r11d, esi
+	jge ._U3_for.end
+._U4_for:
+	lea eax, [r10+rdi*1]
+	add eax, r11d
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	cmp r11d, esi
+	jl ._U4_for
+._U3_for.end:
+	mov edi, r10d
+	call printnum
+	xor r10d, r10d
+	mov r11d, r13d
+	imul r11d, r13d
+	mov esi, r12d
+	imul esi, r14d
+._U5_do_while:
+	lea eax, [r10+r11*1]
+	mov r10d, eax
+	cmp r10d, esi
+	jl ._U5_do_while
+._U6_do_while.end:
+	mov edi, r10d
+	call printnum
+	xor r10d, r10d
+	xor r11d, r11d
+	lea esi, [r12-2]
+	mov edi, r12d
+	sub edi, r14d
+._U8_for:
+	xor r8d, r8d
+	mov r9d, r11d
+	imul r9d, r13d
+	cmp r8d, esi
+	jge ._U9_for.end
+._U10_for:
+	lea eax, [r10+r9*1]
+	add eax, edi
+	add eax, r8d
+	mov r10d, eax
+	lea eax, [r8+1]
+	mov r8d, eax
+	cmp r8d, esi
+	jl ._U10_for
+._U9_for.end:
+	lea eax, [r11+1]
+	mov r11d, eax
+	cmp r11d, 4
+	jl ._U8_for
+._U7_for.end:
+	mov edi, r10d
+	call printnum
+	mov r10d, 1 ; Loading number literal
+	xor r11d, r11d
+	cmp r11d, 100
+	jge ._U12_while.end
+._U11_while:
+	mov eax, r10d
+	shl eax, 1
+	add eax, r11d
+	mov r11d, eax
+	lea eax, [r10+1]
+	mov r10d, eax
+	cmp r11d, 100
+	jl ._U11_while
+._U12_while.end:
+	mov edi, r11d
+	call printnum
+	xor r10d, r10d
+	mov r11d, 5 ; Loading number literal
+	cmp r10d, 0
+	setg sil
+	movzx esi, sil
+	mov eax, esi
+	test rax, rax
+	je ._U14_while.end
+._U13_while:
+	mov eax, r12d
+	mov ecx, r10d
+	cdq
+	idiv ecx
+	add eax, r11d
+	mov r11d, eax
+	mov eax, esi
+	test rax, rax
+	jne ._U13_while
+._U14_while.end:
+	mov edi, r11d
+	call printnum
+	xor r10d, r10d
+	cmp r13d, r14d
+	jge ._U17_logical.shortcut
+	cmp r12d, 0
+	setg r11b
+	movzx r11d, r11b
+	jmp ._U18_logical.end
+._U17_logical.shortcut:
+	xor r11d, r11d
+._U18_logical.end:
+	mov eax, r11d
+	test rax, rax
+	je ._U16_while.end
+._U15_while:
+	lea eax, [r10+1]
+	mov r10d, eax
+	cmp r10d, 7
+	jne ._U20_end_if
+	jmp ._U16_while.end
+._U20_end_if:
+	mov eax, r11d
+	test rax, rax
+	jne ._U15_while
+._U16_while.end:
+	mov edi, r10d
+	call printnum
+	xor eax, eax
+._U0_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop r14
+	pop r13
+	pop r12
+	ret
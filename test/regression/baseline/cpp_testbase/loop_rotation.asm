@@ -0,0 +1,135 @@
+section .data
+
+section .rodata
+
+section .bss
+
+section .text
+	extern printnum:function
+
+	global main:function
+	global _start:function
+
+_start:
+	call main
+	mov rdi, rax            ; Exit code (0) expects return of main to be put in rax for now
+	mov rax, 60                  ; Syscall number for exit (60)
+	syscall                      ; Make the syscall
+
+main:
+	push r12
+	push r13
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	xor r10d, r10d
+	xor r11d, r11d
+	cmp r11d, 0
+	setg al
+	movzx eax, al
+	mov r11d, eax
+	mov eax, r11d
+	test rax, rax
+	je ._U2_while.end
+._U1_while:
+	lea eax, [r10+1]
+	mov r10d, eax
+	mov eax, r11d
+	test rax, rax
+	jne ._U1_while
+._U2_while.end:
+	mov r11d, 10 ; Loading number literal
+._U5_for.end:
+	mov edi, r10d
+	call printnum
+	xor r12d, r12d
+	mov r13d, 4 ; Loading number literal
+	lea eax, [r12+1]
+	mov r12d, eax
+	cmp eax, r13d
+	jg ._U7_while.end
+._U6_while:
+	mov edi, r12d
+	call printnum
+	lea eax, [r12+1]
+	mov r12d, eax
+	cmp eax, r13d
+	jle ._U6_while
+._U7_while.end:
+	mov edi, r12d
+	call printnum
+	mov r10d, 1 ; Loading number literal
+	mov r11d, 1 ; Loading number literal
+	mov eax, r10d
+	imul eax, r11d
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	mov eax, r10d
+	imul eax, r11d
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	mov eax, r10d
+	imul eax, r11d
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	mov eax, r10d
+	imul eax, r11d
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	mov eax, r10d
+	imul eax, r11d
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+._U10_for.end:
+	mov edi, r10d
+	call printnum
+	xor r10d, r10d
+	cmp r10d, 100
+	jge ._U12_while.end
+._U11_while:
+	lea eax, [r10+7]
+	mov r10d, eax
+	mov eax, r10d
+	movsxd rcx, eax
+	imul rcx, rcx, 1717986919
+	sar rcx, 32
+	sar ecx, 1
+	mov edx, eax
+	shr edx, 31
+	add ecx, edx
+	imul ecx, ecx, 5
+	sub eax, ecx
+	cmp eax, 0
+	jne ._U14_end_if
+	jmp ._U12_while.end
+._U14_end_if:
+	cmp r10d, 100
+	jl ._U11_while
+._U12_while.end:
+	mov edi, r10d
+	call printnum
+	xor r10d, r10d
+	xor r11d, r11d
+._U16_for:
+	lea eax, [r10+r11*1]
+	mov r10d, eax
+	cmp r11d, 6
+	jne ._U18_end_if
+	jmp ._U15_for.end
+._U18_end_if:
+	lea eax, [r11+1]
+	mov r11d, eax
+	jmp ._U16_for
+._U15_for.end:
+	mov edi, r10d
+	call printnum
+	xor eax, eax
+._U0_return:
+	pop rbp ; Restore the base pointer
+	pop r13
+	pop r12
+	ret
@@ -0,0 +1,454 @@
+section .data
+
+section .rodata
+
+section .bss
+
+section .text
+	extern printnum:function
+
+	global main:function
+	global _start:function
+
+_start:
+	call main
+	mov rdi, rax            ; Exit code (0) expects return of main to be put in rax for now
+	mov rax, 60                  ; Syscall number for exit (60)
+	syscall                      ; Make the syscall
+
+main:
+	push r12
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 8 ; Creating space on the stack
+	xor r10d, r10d
+	xor r11d, r11d
+._U2_for:
+	mov eax, r11d
+	imul eax, r11d
+	add eax, r10d
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	cmp r11d, 6
+	jl ._U2_for
+._U1_for.end:
+	mov edi, r10d
+	call printnum
+	xor r10d, r10d
+	mov r11d, 1 ; Loading number literal
+._U4_for:
+	mov eax, r11d
+	lea eax, [rax+rax*2]
+	cmp eax, 14
+	jle ._U6_end_if
+	mov eax, r11d
+	mov r10d, eax
+	jmp ._U3_for.end
+._U6_end_if:
+	lea eax, [r11+1]
+	mov r11d, eax
+	cmp r11d, 8
+	jle ._U4_for
+._U3_for.end:
+	mov edi, r10d
+	call printnum
+	xor r12d, r12d
+._U8_for:
+	xor r10d, r10d
+	xor r11d, r11d
+._U9_for.unrolled:
+	movsxd rax, r11d
+	add rax, 3
+	movsxd rcx, r12d
+	cmp rax, rcx
+	jge ._U10_for.remainder
+	lea eax, [r10+r11*1]
+	add eax, 1
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	lea eax, [r10+r11*1]
+	add eax, 1
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	lea eax, [r10+r11*1]
+	add eax, 1
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	lea eax, [r10+r11*1]
+	add eax, 1
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	jmp ._U9_for.unrolled
+._U10_for.remainder:
+	cmp r11d, r12d
+	jge ._U11_for.end
+._U12_for:
+	lea eax, [r10+r11*1]
+	add eax, 1
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	cmp r11d, r12d
+	jl ._U12_for
+._U11_for.end:
+	mov edi, r10d
+	call printnum
+	lea eax, [r12+1]
+	mov r12d, eax
+	cmp r12d, 11
+	jl ._U8_for
+._U7_for.end:
+	mov r10d, 23 ; Loading number literal
+	xor r11d, r11d
+	mov esi, 1 ; Loading number literal
+._U13_for.unrolled:
+	movsxd rax, esi
+	add rax, 4
+	movsxd rcx, r10d
+	cmp rax, rcx
+	jg ._U14_for.remainder
+	lea eax, [r11+rsi*1]
+	mov r11d, eax
+	lea eax, [rsi+2]
+	mov esi, eax
+	lea eax, [r11+rsi*1]
+	mov r11d, eax
+	lea eax, [rsi+2]
+	mov esi, eax
+	lea eax, [r11+rsi*1]
+	mov r11d, eax
+	lea eax, [rsi+2]
+	mov esi, eax
+	jmp ._U13_for.unrolled
+._U14_for.remainder:
+	cmp esi, r10d
+	jg ._U15_for.end
+._U16_for:
+	lea eax, [r11+rsi*1]
+	mov r11d, eax
+	lea eax, [rsi+2]
+	mov esi, eax
+	cmp esi, r10d
+	jle ._U16_for
+._U15_for.end:
+	mov edi, r11d
+	call printnum
+	mov r10d, 20 ; Loading number literal
+	xor r11d, r11d
+._U17_for.unrolled:
+	movsxd rax, r10d
+	add rax, -21
+	cmp rax, 0
+	jl ._U18_for.remainder
+	mov eax, r11d
+	shl eax, 1
+	add eax, r10d
+	mov r11d, eax
+	lea eax, [r10-3]
+	mov r10d, eax
+	mov eax, r11d
+	shl eax, 1
+	add eax, r10d
+	mov r11d, eax
+	lea eax, [r10-3]
+	mov r10d, eax
+	mov eax, r11d
+	shl eax, 1
+	add eax, r10d
+	mov r11d, eax
+	lea eax, [r10-3]
+	mov r10d, eax
+	mov eax, r11d
+	shl eax, 1
+	add eax, r10d
+	mov r11d, eax
+	lea eax, [r10-3]
+	mov r10d, eax
+	mov eax, r11d
+	shl eax, 1
+	add eax, r10d
+	mov r11d, eax
+	lea eax, [r10-3]
+	mov r10d, eax
+	mov eax, r11d
+	shl eax, 1
+	add eax, r10d
+	mov r11d, eax
+	lea eax, [r10-3]
+	mov r10d, eax
+	mov eax, r11d
+	shl eax, 1
+	add eax, r10d
+	mov r11d, eax
+	lea eax, [r10-3]
+	mov r10d, eax
+	mov eax, r11d
+	shl eax, 1
+	add eax, r10d
+	mov r11d, eax
+	lea eax, [r10-3]
+	mov r10d, eax
+	jmp ._U17_for.unrolled
+._U18_for.remainder:
+	cmp r10d, 0
+	jl ._U19_for.end
+._U20_for:
+	mov eax, r11d
+	shl eax, 1
+	add eax, r10d
+	mov r11d, eax
+	lea eax, [r10-3]
+	mov r10d, eax
+	cmp r10d, 0
+	jge ._U20_for
+._U19_for.end:
+	mov edi, r11d
+	call printnum
+	xor r10d, r10d
+	mov r11d, 1 ; Loading number literal
+	xor esi, esi
+	lea edi, [r10+r11*1]
+	mov eax, r11d
+	mov r10d, eax
+	mov eax, edi
+	mov r11d, eax
+	lea eax, [rsi+1]
+	mov esi, eax
+	lea edi, [r10+r11*1]
+	mov eax, r11d
+	mov r10d, eax
+	mov eax, edi
+	mov r11d, eax
+	lea eax, [rsi+1]
+	mov esi, eax
+	lea edi, [r10+r11*1]
+	mov eax, r11d
+	mov r10d, eax
+	mov eax, edi
+	mov r11d, eax
+	lea eax, [rsi+1]
+	mov esi, eax
+	lea edi, [r10+r11*1]
+	mov eax, r11d
+	mov r10d, eax
+	mov eax, edi
+	mov r11d, eax
+	lea eax, [rsi+1]
+	mov esi, eax
+	lea edi, [r10+r11*1]
+	mov eax, r11d
+	mov r10d, eax
+	mov eax, edi
+	mov r11d, eax
+	lea eax, [rsi+1]
+	mov esi, eax
+	lea edi, [r10+r11*1]
+	mov eax, r11d
+	mov r10d, eax
+	mov eax, edi
+	mov r11d, eax
+	lea eax, [rsi+1]
+	mov esi, eax
+	lea edi, [r10+r11*1]
+	mov eax, r11d
+	mov r10d, eax
+	mov eax, edi
+	mov r11d, eax
+	lea eax, [rsi+1]
+	mov esi, eax
+	lea edi, [r10+r11*1]
+	mov eax, r11d
+	mov r10d, eax
+	mov eax, edi
+	mov r11d, eax
+	lea eax, [rsi+1]
+	mov esi, eax
+	lea edi, [r10+r11*1]
+	mov eax, r11d
+	mov r10d, eax
+	mov eax, edi
+	mov r11d, eax
+	lea eax, [rsi+1]
+	mov esi, eax
+	lea edi, [r10+r11*1]
+	mov eax, r11d
+	mov r10d, eax
+	mov eax, edi
+	mov r11d, eax
+	lea eax, [rsi+1]
+	mov esi, eax
+	lea edi, [r10+r11*1]
+	mov eax, r11d
+	mov r10d, eax
+	mov eax, edi
+	mov r11d, eax
+	lea eax, [rsi+1]
+	mov esi, eax
+	lea edi, [r10+r11*1]
+	mov eax, r11d
+	mov r10d, eax
+	mov eax, edi
+	mov r11d, eax
+	lea eax, [rsi+1]
+	mov esi, eax
+	lea edi, [r10+r11*1]
+	mov eax, r11d
+	mov r10d, eax
+	mov eax, edi
+	mov r11d, eax
+	lea eax, [rsi+1]
+	mov esi, eax
+	lea edi, [r10+r11*1]
+	mov eax, r11d
+	mov r10d, eax
+	mov eax, edi
+	mov r11d, eax
+	lea eax, [rsi+1]
+	mov esi, eax
+	lea edi, [r10+r11*1]
+	mov eax, r11d
+	mov r10d, eax
+	mov eax, edi
+	mov r11d, eax
+	lea eax, [rsi+1]
+	mov esi, eax
+	lea edi, [r10+r11*1]
+	mov eax, r11d
+	mov r10d, eax
+	mov eax, edi
+	mov r11d, eax
+	lea eax, [rsi+1]
+	mov esi, eax
+	lea edi, [r10+r11*1]
+	mov eax, r11d
+	mov r10d, eax
+	mov eax, edi
+	mov r11d, eax
+	lea eax, [rsi+1]
+	mov esi, eax
+	lea edi, [r10+r11*1]
+	mov eax, r11d
+	mov r10d, eax
+	mov eax, edi
+	mov r11d, eax
+	lea eax, [rsi+1]
+	mov esi, eax
+	lea edi, [r10+r11*1]
+	mov eax, r11d
+	mov r10d, eax
+	mov eax, edi
+	mov r11d, eax
+	lea eax, [rsi+1]
+	mov esi, eax
+	lea edi, [r10+r11*1]
+	mov eax, r11d
+	mov r10d, eax
+	mov eax, edi
+	mov r11d, eax
+	lea eax, [rsi+1]
+	mov esi, eax
+._U23_for.end:
+	mov edi, r10d
+	call printnum
+	xor r12d, r12d
+	xor r10d, r10d
+._U25_for:
+	lea eax, [r12+5]
+	mov r12d, eax
+	lea eax, [r10+1]
+	mov r10d, eax
+	cmp r10d, 3
+	jl ._U25_for
+._U24_for.end:
+	mov edi, r12d
+	call printnum
+	xor r10d, r10d
+	lea eax, [r12+1]
+	mov r12d, eax
+	lea eax, [r10+1]
+	mov r10d, eax
+	lea eax, [r12+1]
+	mov r12d, eax
+	lea eax, [r10+1]
+	mov r10d, eax
+._U28_for.end:
+	mov edi, r12d
+	call printnum
+	xor r10d, r10d
+	xor r12d, r12d
+	mov r11d, 2147483640 ; Loading number literal
+._U29_for.unrolled:
+	movsxd rax, r11d
+	add rax, 3
+	cmp rax, 2147483647
+	jge ._U30_for.remainder
+	mov eax, r11d
+	mov r10d, eax
+	lea eax, [r12+1]
+	mov r12d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	mov eax, r11d
+	mov r10d, eax
+	lea eax, [r12+1]
+	mov r12d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	mov eax, r11d
+	mov r10d, eax
+	lea eax, [r12+1]
+	mov r12d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	mov eax, r11d
+	mov r10d, eax
+	lea eax, [r12+1]
+	mov r12d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	jmp ._U29_for.unrolled
+._U30_for.remainder:
+	cmp r11d, 2147483647
+	jge ._U31_for.end
+._U32_for:
+	mov eax, r11d
+	mov r10d, eax
+	lea eax, [r12+1]
+	mov r12d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	cmp r11d, 2147483647
+	jl ._U32_for
+._U31_for.end:
+	mov edi, r10d
+	call printnum
+	mov edi, r12d
+	call printnum
+	mov r10d, 10 ; Loading number literal
+	xor r11d, r11d
+	xor esi, esi
+	cmp esi, r10d
+	jge ._U33_for.end
+._U34_for:
+	lea eax, [r10-1]
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	lea eax, [rsi+1]
+	mov esi, eax
+	cmp esi, r10d
+	jl ._U34_for
+._U33_for.end:
+	mov edi, r11d
+	call printnum
+	xor eax, eax
+._U0_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop r12
+	ret
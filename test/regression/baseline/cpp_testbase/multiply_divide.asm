@@ -0,0 +1,8911 @@
+section .data
+
+section .rodata
+
+section .bss
+
+section .text
+	extern printnum:function
+
+	global main:function
+	global _start:function
+
+_start:
+	call main
+	mov rdi, rax            ; Exit code (0) expects return of main to be put in rax for now
+	mov rax, 60                  ; Syscall number for exit (60)
+	syscall                      ; Make the syscall
+
+main:
+	push r12
+	push r13
+	push r14
+	push r15
+	push rbx
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 8 ; Creating space on the stack
+	xor r12d, r12d
+	mov r13d, 1 ; Loading number literal
+	mov r14d, 7 ; Loading number literal
+	mov r15d, 100 ; Loading number literal
+	mov ebx, 2147483647 ; Loading number literal
+	mov r10d, 4294967295 ; Loading number literal
+	mov r11d, 4294967289 ; Loading number literal
+	mov esi, 4294967196 ; Loading number literal
+	mov r8d, 2147483648 ; Loading number literal
+	mov r9d, 3 ; Loading number literal
+	mov ecx, 4294967293 ; Loading number literal
+	xor eax, eax
+	mov [rbp-4], eax ; Storing value in memory
+	mov eax, r12d
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	xor eax, eax
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 31
+	add edx, eax
+	sar edx, 1
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 31
+	add edx, eax
+	sar edx, 1
+	shl edx, 1
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	movsxd rdx, eax
+	imul rdx, rdx, 1431655766
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	movsxd rdx, eax
+	imul rdx, rdx, 1431655766
+	sar rdx, 32
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 3
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 30
+	add edx, eax
+	sar edx, 2
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 30
+	add edx, eax
+	sar edx, 2
+	shl edx, 2
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 1
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 1
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 5
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	movsxd rdx, eax
+	imul rdx, rdx, 715827883
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	movsxd rdx, eax
+	imul rdx, rdx, 715827883
+	sar rdx, 32
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 6
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	movsxd rdx, eax
+	imul rdx, rdx, -1840700269
+	sar rdx, 32
+	add edx, eax
+	sar edx, 2
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	movsxd rdx, eax
+	imul rdx, rdx, -1840700269
+	sar rdx, 32
+	add edx, eax
+	sar edx, 2
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 7
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 29
+	add edx, eax
+	sar edx, 3
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 29
+	add edx, eax
+	sar edx, 3
+	shl edx, 3
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 2
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 2
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 10
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 28
+	add edx, eax
+	sar edx, 4
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 28
+	add edx, eax
+	sar edx, 4
+	shl edx, 4
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	movsxd rdx, eax
+	imul rdx, rdx, 1374389535
+	sar rdx, 32
+	sar edx, 3
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	movsxd rdx, eax
+	imul rdx, rdx, 1374389535
+	sar rdx, 32
+	sar edx, 3
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 25
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 3
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 3
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 125
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	movsxd rdx, eax
+	imul rdx, rdx, 6700417
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	movsxd rdx, eax
+	imul rdx, rdx, 6700417
+	sar rdx, 32
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 641
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 6
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 6
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 1000
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 16
+	add edx, eax
+	sar edx, 16
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 16
+	add edx, eax
+	sar edx, 16
+	shl edx, 16
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	movsxd rdx, eax
+	imul rdx, rdx, 1073741825
+	sar rdx, 32
+	sar edx, 29
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	movsxd rdx, eax
+	imul rdx, rdx, 1073741825
+	sar rdx, 32
+	sar edx, 29
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 2147483647
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	mov edi, r9d
+	cdq
+	idiv edi
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	mov edi, r9d
+	cdq
+	idiv edi
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	mov edi, ecx
+	cdq
+	idiv edi
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r12d
+	mov edi, ecx
+	cdq
+	idiv edi
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	xor eax, eax
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 31
+	add edx, eax
+	sar edx, 1
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 31
+	add edx, eax
+	sar edx, 1
+	shl edx, 1
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	movsxd rdx, eax
+	imul rdx, rdx, 1431655766
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	movsxd rdx, eax
+	imul rdx, rdx, 1431655766
+	sar rdx, 32
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 3
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 30
+	add edx, eax
+	sar edx, 2
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 30
+	add edx, eax
+	sar edx, 2
+	shl edx, 2
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 1
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 1
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 5
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	movsxd rdx, eax
+	imul rdx, rdx, 715827883
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	movsxd rdx, eax
+	imul rdx, rdx, 715827883
+	sar rdx, 32
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 6
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	movsxd rdx, eax
+	imul rdx, rdx, -1840700269
+	sar rdx, 32
+	add edx, eax
+	sar edx, 2
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	movsxd rdx, eax
+	imul rdx, rdx, -1840700269
+	sar rdx, 32
+	add edx, eax
+	sar edx, 2
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 7
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 29
+	add edx, eax
+	sar edx, 3
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 29
+	add edx, eax
+	sar edx, 3
+	shl edx, 3
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 2
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 2
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 10
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 28
+	add edx, eax
+	sar edx, 4
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 28
+	add edx, eax
+	sar edx, 4
+	shl edx, 4
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	movsxd rdx, eax
+	imul rdx, rdx, 1374389535
+	sar rdx, 32
+	sar edx, 3
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	movsxd rdx, eax
+	imul rdx, rdx, 1374389535
+	sar rdx, 32
+	sar edx, 3
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 25
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 3
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 3
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 125
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	movsxd rdx, eax
+	imul rdx, rdx, 6700417
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	movsxd rdx, eax
+	imul rdx, rdx, 6700417
+	sar rdx, 32
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 641
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 6
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 6
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 1000
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 16
+	add edx, eax
+	sar edx, 16
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 16
+	add edx, eax
+	sar edx, 16
+	shl edx, 16
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	movsxd rdx, eax
+	imul rdx, rdx, 1073741825
+	sar rdx, 32
+	sar edx, 29
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	movsxd rdx, eax
+	imul rdx, rdx, 1073741825
+	sar rdx, 32
+	sar edx, 29
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 2147483647
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	mov edi, r9d
+	cdq
+	idiv edi
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	mov edi, r9d
+	cdq
+	idiv edi
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	mov edi, ecx
+	cdq
+	idiv edi
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r13d
+	mov edi, ecx
+	cdq
+	idiv edi
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	xor eax, eax
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 31
+	add edx, eax
+	sar edx, 1
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 31
+	add edx, eax
+	sar edx, 1
+	shl edx, 1
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	movsxd rdx, eax
+	imul rdx, rdx, 1431655766
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	movsxd rdx, eax
+	imul rdx, rdx, 1431655766
+	sar rdx, 32
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 3
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 30
+	add edx, eax
+	sar edx, 2
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 30
+	add edx, eax
+	sar edx, 2
+	shl edx, 2
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 1
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 1
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 5
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	movsxd rdx, eax
+	imul rdx, rdx, 715827883
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	movsxd rdx, eax
+	imul rdx, rdx, 715827883
+	sar rdx, 32
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 6
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	movsxd rdx, eax
+	imul rdx, rdx, -1840700269
+	sar rdx, 32
+	add edx, eax
+	sar edx, 2
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	movsxd rdx, eax
+	imul rdx, rdx, -1840700269
+	sar rdx, 32
+	add edx, eax
+	sar edx, 2
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 7
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 29
+	add edx, eax
+	sar edx, 3
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 29
+	add edx, eax
+	sar edx, 3
+	shl edx, 3
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 2
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 2
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 10
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 28
+	add edx, eax
+	sar edx, 4
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 28
+	add edx, eax
+	sar edx, 4
+	shl edx, 4
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	movsxd rdx, eax
+	imul rdx, rdx, 1374389535
+	sar rdx, 32
+	sar edx, 3
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	movsxd rdx, eax
+	imul rdx, rdx, 1374389535
+	sar rdx, 32
+	sar edx, 3
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 25
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 3
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 3
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 125
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	movsxd rdx, eax
+	imul rdx, rdx, 6700417
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	movsxd rdx, eax
+	imul rdx, rdx, 6700417
+	sar rdx, 32
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 641
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 6
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 6
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 1000
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 16
+	add edx, eax
+	sar edx, 16
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 16
+	add edx, eax
+	sar edx, 16
+	shl edx, 16
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	movsxd rdx, eax
+	imul rdx, rdx, 1073741825
+	sar rdx, 32
+	sar edx, 29
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	movsxd rdx, eax
+	imul rdx, rdx, 1073741825
+	sar rdx, 32
+	sar edx, 29
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 2147483647
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	mov edi, r9d
+	cdq
+	idiv edi
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	mov edi, r9d
+	cdq
+	idiv edi
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	mov edi, ecx
+	cdq
+	idiv edi
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	mov edi, ecx
+	cdq
+	idiv edi
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	xor eax, eax
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 31
+	add edx, eax
+	sar edx, 1
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 31
+	add edx, eax
+	sar edx, 1
+	shl edx, 1
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	movsxd rdx, eax
+	imul rdx, rdx, 1431655766
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	movsxd rdx, eax
+	imul rdx, rdx, 1431655766
+	sar rdx, 32
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 3
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 30
+	add edx, eax
+	sar edx, 2
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 30
+	add edx, eax
+	sar edx, 2
+	shl edx, 2
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 1
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 1
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 5
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	movsxd rdx, eax
+	imul rdx, rdx, 715827883
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	movsxd rdx, eax
+	imul rdx, rdx, 715827883
+	sar rdx, 32
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 6
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	movsxd rdx, eax
+	imul rdx, rdx, -1840700269
+	sar rdx, 32
+	add edx, eax
+	sar edx, 2
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	movsxd rdx, eax
+	imul rdx, rdx, -1840700269
+	sar rdx, 32
+	add edx, eax
+	sar edx, 2
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 7
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 29
+	add edx, eax
+	sar edx, 3
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 29
+	add edx, eax
+	sar edx, 3
+	shl edx, 3
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 2
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 2
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 10
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 28
+	add edx, eax
+	sar edx, 4
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 28
+	add edx, eax
+	sar edx, 4
+	shl edx, 4
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	movsxd rdx, eax
+	imul rdx, rdx, 1374389535
+	sar rdx, 32
+	sar edx, 3
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	movsxd rdx, eax
+	imul rdx, rdx, 1374389535
+	sar rdx, 32
+	sar edx, 3
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 25
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 3
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 3
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 125
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	movsxd rdx, eax
+	imul rdx, rdx, 6700417
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	movsxd rdx, eax
+	imul rdx, rdx, 6700417
+	sar rdx, 32
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 641
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 6
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 6
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 1000
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 16
+	add edx, eax
+	sar edx, 16
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 16
+	add edx, eax
+	sar edx, 16
+	shl edx, 16
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	movsxd rdx, eax
+	imul rdx, rdx, 1073741825
+	sar rdx, 32
+	sar edx, 29
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	movsxd rdx, eax
+	imul rdx, rdx, 1073741825
+	sar rdx, 32
+	sar edx, 29
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 2147483647
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	mov edi, r9d
+	cdq
+	idiv edi
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	mov edi, r9d
+	cdq
+	idiv edi
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	mov edi, ecx
+	cdq
+	idiv edi
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r15d
+	mov edi, ecx
+	cdq
+	idiv edi
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	xor eax, eax
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	mov edx, eax
+	sar edx, 31
+	shr edx, 31
+	add edx, eax
+	sar edx, 1
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	mov edx, eax
+	sar edx, 31
+	shr edx, 31
+	add edx, eax
+	sar edx, 1
+	shl edx, 1
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	movsxd rdx, eax
+	imul rdx, rdx, 1431655766
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	movsxd rdx, eax
+	imul rdx, rdx, 1431655766
+	sar rdx, 32
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 3
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	mov edx, eax
+	sar edx, 31
+	shr edx, 30
+	add edx, eax
+	sar edx, 2
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	mov edx, eax
+	sar edx, 31
+	shr edx, 30
+	add edx, eax
+	sar edx, 2
+	shl edx, 2
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 1
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 1
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 5
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	movsxd rdx, eax
+	imul rdx, rdx, 715827883
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	movsxd rdx, eax
+	imul rdx, rdx, 715827883
+	sar rdx, 32
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 6
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	movsxd rdx, eax
+	imul rdx, rdx, -1840700269
+	sar rdx, 32
+	add edx, eax
+	sar edx, 2
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	movsxd rdx, eax
+	imul rdx, rdx, -1840700269
+	sar rdx, 32
+	add edx, eax
+	sar edx, 2
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 7
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	mov edx, eax
+	sar edx, 31
+	shr edx, 29
+	add edx, eax
+	sar edx, 3
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	mov edx, eax
+	sar edx, 31
+	shr edx, 29
+	add edx, eax
+	sar edx, 3
+	shl edx, 3
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 2
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 2
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 10
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	mov edx, eax
+	sar edx, 31
+	shr edx, 28
+	add edx, eax
+	sar edx, 4
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	mov edx, eax
+	sar edx, 31
+	shr edx, 28
+	add edx, eax
+	sar edx, 4
+	shl edx, 4
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	movsxd rdx, eax
+	imul rdx, rdx, 1374389535
+	sar rdx, 32
+	sar edx, 3
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	movsxd rdx, eax
+	imul rdx, rdx, 1374389535
+	sar rdx, 32
+	sar edx, 3
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 25
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 3
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 3
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 125
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	movsxd rdx, eax
+	imul rdx, rdx, 6700417
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	movsxd rdx, eax
+	imul rdx, rdx, 6700417
+	sar rdx, 32
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 641
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 6
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 6
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 1000
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	mov edx, eax
+	sar edx, 31
+	shr edx, 16
+	add edx, eax
+	sar edx, 16
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	mov edx, eax
+	sar edx, 31
+	shr edx, 16
+	add edx, eax
+	sar edx, 16
+	shl edx, 16
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	movsxd rdx, eax
+	imul rdx, rdx, 1073741825
+	sar rdx, 32
+	sar edx, 29
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	movsxd rdx, eax
+	imul rdx, rdx, 1073741825
+	sar rdx, 32
+	sar edx, 29
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 2147483647
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	mov edi, r9d
+	cdq
+	idiv edi
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	mov edi, r9d
+	cdq
+	idiv edi
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	mov edi, ecx
+	cdq
+	idiv edi
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, ebx
+	mov edi, ecx
+	cdq
+	idiv edi
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	xor eax, eax
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 31
+	add edx, eax
+	sar edx, 1
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 31
+	add edx, eax
+	sar edx, 1
+	shl edx, 1
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	movsxd rdx, eax
+	imul rdx, rdx, 1431655766
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	movsxd rdx, eax
+	imul rdx, rdx, 1431655766
+	sar rdx, 32
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 3
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 30
+	add edx, eax
+	sar edx, 2
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 30
+	add edx, eax
+	sar edx, 2
+	shl edx, 2
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 1
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 1
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 5
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	movsxd rdx, eax
+	imul rdx, rdx, 715827883
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	movsxd rdx, eax
+	imul rdx, rdx, 715827883
+	sar rdx, 32
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 6
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	movsxd rdx, eax
+	imul rdx, rdx, -1840700269
+	sar rdx, 32
+	add edx, eax
+	sar edx, 2
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	movsxd rdx, eax
+	imul rdx, rdx, -1840700269
+	sar rdx, 32
+	add edx, eax
+	sar edx, 2
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 7
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 29
+	add edx, eax
+	sar edx, 3
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 29
+	add edx, eax
+	sar edx, 3
+	shl edx, 3
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 2
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 2
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 10
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 28
+	add edx, eax
+	sar edx, 4
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 28
+	add edx, eax
+	sar edx, 4
+	shl edx, 4
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	movsxd rdx, eax
+	imul rdx, rdx, 1374389535
+	sar rdx, 32
+	sar edx, 3
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	movsxd rdx, eax
+	imul rdx, rdx, 1374389535
+	sar rdx, 32
+	sar edx, 3
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 25
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 3
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 3
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 125
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	movsxd rdx, eax
+	imul rdx, rdx, 6700417
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	movsxd rdx, eax
+	imul rdx, rdx, 6700417
+	sar rdx, 32
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 641
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 6
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 6
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 1000
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 16
+	add edx, eax
+	sar edx, 16
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 16
+	add edx, eax
+	sar edx, 16
+	shl edx, 16
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	movsxd rdx, eax
+	imul rdx, rdx, 1073741825
+	sar rdx, 32
+	sar edx, 29
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	movsxd rdx, eax
+	imul rdx, rdx, 1073741825
+	sar rdx, 32
+	sar edx, 29
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 2147483647
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	mov edi, r9d
+	cdq
+	idiv edi
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	mov edi, r9d
+	cdq
+	idiv edi
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	mov edi, ecx
+	cdq
+	idiv edi
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r10d
+	mov edi, ecx
+	cdq
+	idiv edi
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	xor eax, eax
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 31
+	add edx, eax
+	sar edx, 1
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 31
+	add edx, eax
+	sar edx, 1
+	shl edx, 1
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	movsxd rdx, eax
+	imul rdx, rdx, 1431655766
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	movsxd rdx, eax
+	imul rdx, rdx, 1431655766
+	sar rdx, 32
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 3
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 30
+	add edx, eax
+	sar edx, 2
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 30
+	add edx, eax
+	sar edx, 2
+	shl edx, 2
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 1
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 1
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 5
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	movsxd rdx, eax
+	imul rdx, rdx, 715827883
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	movsxd rdx, eax
+	imul rdx, rdx, 715827883
+	sar rdx, 32
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 6
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	movsxd rdx, eax
+	imul rdx, rdx, -1840700269
+	sar rdx, 32
+	add edx, eax
+	sar edx, 2
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	movsxd rdx, eax
+	imul rdx, rdx, -1840700269
+	sar rdx, 32
+	add edx, eax
+	sar edx, 2
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 7
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 29
+	add edx, eax
+	sar edx, 3
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 29
+	add edx, eax
+	sar edx, 3
+	shl edx, 3
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 2
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 2
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 10
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 28
+	add edx, eax
+	sar edx, 4
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 28
+	add edx, eax
+	sar edx, 4
+	shl edx, 4
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	movsxd rdx, eax
+	imul rdx, rdx, 1374389535
+	sar rdx, 32
+	sar edx, 3
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	movsxd rdx, eax
+	imul rdx, rdx, 1374389535
+	sar rdx, 32
+	sar edx, 3
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 25
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 3
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 3
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 125
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	movsxd rdx, eax
+	imul rdx, rdx, 6700417
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	movsxd rdx, eax
+	imul rdx, rdx, 6700417
+	sar rdx, 32
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 641
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 6
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 6
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 1000
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 16
+	add edx, eax
+	sar edx, 16
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 16
+	add edx, eax
+	sar edx, 16
+	shl edx, 16
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	movsxd rdx, eax
+	imul rdx, rdx, 1073741825
+	sar rdx, 32
+	sar edx, 29
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	movsxd rdx, eax
+	imul rdx, rdx, 1073741825
+	sar rdx, 32
+	sar edx, 29
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 2147483647
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	mov edi, r9d
+	cdq
+	idiv edi
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	mov edi, r9d
+	cdq
+	idiv edi
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	mov edi, ecx
+	cdq
+	idiv edi
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, r11d
+	mov edi, ecx
+	cdq
+	idiv edi
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	xor eax, eax
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	mov edx, eax
+	sar edx, 31
+	shr edx, 31
+	add edx, eax
+	sar edx, 1
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	mov edx, eax
+	sar edx, 31
+	shr edx, 31
+	add edx, eax
+	sar edx, 1
+	shl edx, 1
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	movsxd rdx, eax
+	imul rdx, rdx, 1431655766
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	movsxd rdx, eax
+	imul rdx, rdx, 1431655766
+	sar rdx, 32
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 3
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	mov edx, eax
+	sar edx, 31
+	shr edx, 30
+	add edx, eax
+	sar edx, 2
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	mov edx, eax
+	sar edx, 31
+	shr edx, 30
+	add edx, eax
+	sar edx, 2
+	shl edx, 2
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 1
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 1
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 5
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	movsxd rdx, eax
+	imul rdx, rdx, 715827883
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	movsxd rdx, eax
+	imul rdx, rdx, 715827883
+	sar rdx, 32
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 6
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	movsxd rdx, eax
+	imul rdx, rdx, -1840700269
+	sar rdx, 32
+	add edx, eax
+	sar edx, 2
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	movsxd rdx, eax
+	imul rdx, rdx, -1840700269
+	sar rdx, 32
+	add edx, eax
+	sar edx, 2
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 7
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	mov edx, eax
+	sar edx, 31
+	shr edx, 29
+	add edx, eax
+	sar edx, 3
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	mov edx, eax
+	sar edx, 31
+	shr edx, 29
+	add edx, eax
+	sar edx, 3
+	shl edx, 3
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 2
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 2
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 10
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	mov edx, eax
+	sar edx, 31
+	shr edx, 28
+	add edx, eax
+	sar edx, 4
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	mov edx, eax
+	sar edx, 31
+	shr edx, 28
+	add edx, eax
+	sar edx, 4
+	shl edx, 4
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	movsxd rdx, eax
+	imul rdx, rdx, 1374389535
+	sar rdx, 32
+	sar edx, 3
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	movsxd rdx, eax
+	imul rdx, rdx, 1374389535
+	sar rdx, 32
+	sar edx, 3
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 25
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 3
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 3
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 125
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	movsxd rdx, eax
+	imul rdx, rdx, 6700417
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	movsxd rdx, eax
+	imul rdx, rdx, 6700417
+	sar rdx, 32
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 641
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 6
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 6
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 1000
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	mov edx, eax
+	sar edx, 31
+	shr edx, 16
+	add edx, eax
+	sar edx, 16
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	mov edx, eax
+	sar edx, 31
+	shr edx, 16
+	add edx, eax
+	sar edx, 16
+	shl edx, 16
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	movsxd rdx, eax
+	imul rdx, rdx, 1073741825
+	sar rdx, 32
+	sar edx, 29
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	movsxd rdx, eax
+	imul rdx, rdx, 1073741825
+	sar rdx, 32
+	sar edx, 29
+	mov edi, eax
+	shr edi, 31
+	add edx, edi
+	imul edx, edx, 2147483647
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	mov edi, r9d
+	cdq
+	idiv edi
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	mov edi, r9d
+	cdq
+	idiv edi
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	mov edi, ecx
+	cdq
+	idiv edi
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	mov eax, esi
+	mov edi, ecx
+	cdq
+	idiv edi
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	xor eax, eax
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 31
+	add edx, eax
+	sar edx, 1
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 31
+	add edx, eax
+	sar edx, 1
+	shl edx, 1
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	movsxd rdx, eax
+	imul rdx, rdx, 1431655766
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	movsxd rdx, eax
+	imul rdx, rdx, 1431655766
+	sar rdx, 32
+	mov esi, eax
+	shr esi, 31
+	add edx, esi
+	imul edx, edx, 3
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 30
+	add edx, eax
+	sar edx, 2
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 30
+	add edx, eax
+	sar edx, 2
+	shl edx, 2
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 1
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 1
+	mov esi, eax
+	shr esi, 31
+	add edx, esi
+	imul edx, edx, 5
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	movsxd rdx, eax
+	imul rdx, rdx, 715827883
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	movsxd rdx, eax
+	imul rdx, rdx, 715827883
+	sar rdx, 32
+	mov esi, eax
+	shr esi, 31
+	add edx, esi
+	imul edx, edx, 6
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	movsxd rdx, eax
+	imul rdx, rdx, -1840700269
+	sar rdx, 32
+	add edx, eax
+	sar edx, 2
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	movsxd rdx, eax
+	imul rdx, rdx, -1840700269
+	sar rdx, 32
+	add edx, eax
+	sar edx, 2
+	mov esi, eax
+	shr esi, 31
+	add edx, esi
+	imul edx, edx, 7
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 29
+	add edx, eax
+	sar edx, 3
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 29
+	add edx, eax
+	sar edx, 3
+	shl edx, 3
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 2
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	movsxd rdx, eax
+	imul rdx, rdx, 1717986919
+	sar rdx, 32
+	sar edx, 2
+	mov esi, eax
+	shr esi, 31
+	add edx, esi
+	imul edx, edx, 10
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 28
+	add edx, eax
+	sar edx, 4
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 28
+	add edx, eax
+	sar edx, 4
+	shl edx, 4
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	movsxd rdx, eax
+	imul rdx, rdx, 1374389535
+	sar rdx, 32
+	sar edx, 3
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	movsxd rdx, eax
+	imul rdx, rdx, 1374389535
+	sar rdx, 32
+	sar edx, 3
+	mov esi, eax
+	shr esi, 31
+	add edx, esi
+	imul edx, edx, 25
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 3
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 3
+	mov esi, eax
+	shr esi, 31
+	add edx, esi
+	imul edx, edx, 125
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	movsxd rdx, eax
+	imul rdx, rdx, 6700417
+	sar rdx, 32
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	movsxd rdx, eax
+	imul rdx, rdx, 6700417
+	sar rdx, 32
+	mov esi, eax
+	shr esi, 31
+	add edx, esi
+	imul edx, edx, 641
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 6
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	movsxd rdx, eax
+	imul rdx, rdx, 274877907
+	sar rdx, 32
+	sar edx, 6
+	mov esi, eax
+	shr esi, 31
+	add edx, esi
+	imul edx, edx, 1000
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 16
+	add edx, eax
+	sar edx, 16
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 16
+	add edx, eax
+	sar edx, 16
+	shl edx, 16
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	movsxd rdx, eax
+	imul rdx, rdx, 1073741825
+	sar rdx, 32
+	sar edx, 29
+	shr eax, 31
+	add eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	movsxd rdx, eax
+	imul rdx, rdx, 1073741825
+	sar rdx, 32
+	sar edx, 29
+	mov esi, eax
+	shr esi, 31
+	add edx, esi
+	imul edx, edx, 2147483647
+	sub eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	mov esi, r9d
+	cdq
+	idiv esi
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	mov esi, r9d
+	cdq
+	idiv esi
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	mov esi, ecx
+	cdq
+	idiv esi
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	mov esi, ecx
+	cdq
+	idiv esi
+	mov eax, edx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	xor eax, eax
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	xor eax, eax
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	shl eax, 1
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	shl eax, 1
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	lea eax, [rax+rax*2]
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	lea eax, [rax+rax*2]
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	lea eax, [rax+rax*4]
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	lea eax, [rax+rax*4]
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	lea eax, [rax+rax*8]
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	lea eax, [rax+rax*8]
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	lea eax, [rax+rax*4]
+	shl eax, 1
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	lea eax, [rax+rax*4]
+	shl eax, 1
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	lea eax, [rax+rax*2]
+	shl eax, 2
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	lea eax, [rax+rax*2]
+	shl eax, 2
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	lea eax, [rax+rax*8]
+	shl eax, 1
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	lea eax, [rax+rax*8]
+	shl eax, 1
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	lea eax, [rax+rax*2]
+	shl eax, 3
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	lea eax, [rax+rax*2]
+	shl eax, 3
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	lea eax, [rax+rax*4]
+	shl eax, 3
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	lea eax, [rax+rax*4]
+	shl eax, 3
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	lea eax, [rax+rax*8]
+	shl eax, 3
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	lea eax, [rax+rax*8]
+	shl eax, 3
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	imul eax, eax, 100
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	imul eax, eax, 100
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	imul eax, eax, 1000
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	imul eax, eax, 1000
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	shl eax, 16
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	shl eax, 16
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	imul eax, eax, 7
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	imul eax, eax, 7
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r14d
+	imul eax, ecx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	xor eax, eax
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	xor eax, eax
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	shl eax, 1
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	shl eax, 1
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	lea eax, [rax+rax*2]
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	lea eax, [rax+rax*2]
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	lea eax, [rax+rax*4]
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	lea eax, [rax+rax*4]
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	lea eax, [rax+rax*8]
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	lea eax, [rax+rax*8]
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	lea eax, [rax+rax*4]
+	shl eax, 1
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	lea eax, [rax+rax*4]
+	shl eax, 1
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	lea eax, [rax+rax*2]
+	shl eax, 2
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	lea eax, [rax+rax*2]
+	shl eax, 2
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	lea eax, [rax+rax*8]
+	shl eax, 1
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	lea eax, [rax+rax*8]
+	shl eax, 1
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	lea eax, [rax+rax*2]
+	shl eax, 3
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	lea eax, [rax+rax*2]
+	shl eax, 3
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	lea eax, [rax+rax*4]
+	shl eax, 3
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	lea eax, [rax+rax*4]
+	shl eax, 3
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	lea eax, [rax+rax*8]
+	shl eax, 3
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	lea eax, [rax+rax*8]
+	shl eax, 3
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	imul eax, eax, 100
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	imul eax, eax, 100
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	imul eax, eax, 1000
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	imul eax, eax, 1000
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	shl eax, 16
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	shl eax, 16
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	imul eax, eax, 7
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	imul eax, eax, 7
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r11d
+	imul eax, ecx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	xor eax, eax
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	xor eax, eax
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	shl eax, 1
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	shl eax, 1
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	lea eax, [rax+rax*2]
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	lea eax, [rax+rax*2]
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	lea eax, [rax+rax*4]
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	lea eax, [rax+rax*4]
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	lea eax, [rax+rax*8]
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	lea eax, [rax+rax*8]
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	lea eax, [rax+rax*4]
+	shl eax, 1
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	lea eax, [rax+rax*4]
+	shl eax, 1
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	lea eax, [rax+rax*2]
+	shl eax, 2
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	lea eax, [rax+rax*2]
+	shl eax, 2
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	lea eax, [rax+rax*8]
+	shl eax, 1
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	lea eax, [rax+rax*8]
+	shl eax, 1
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	lea eax, [rax+rax*2]
+	shl eax, 3
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	lea eax, [rax+rax*2]
+	shl eax, 3
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	lea eax, [rax+rax*4]
+	shl eax, 3
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	lea eax, [rax+rax*4]
+	shl eax, 3
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	lea eax, [rax+rax*8]
+	shl eax, 3
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	lea eax, [rax+rax*8]
+	shl eax, 3
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	imul eax, eax, 100
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	imul eax, eax, 100
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	imul eax, eax, 1000
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	imul eax, eax, 1000
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	shl eax, 16
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	shl eax, 16
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	imul eax, eax, 7
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	imul eax, eax, 7
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, ebx
+	imul eax, ecx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	xor eax, eax
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	xor eax, eax
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	shl eax, 1
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	shl eax, 1
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	lea eax, [rax+rax*2]
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	lea eax, [rax+rax*2]
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	lea eax, [rax+rax*4]
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	lea eax, [rax+rax*4]
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	lea eax, [rax+rax*8]
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	lea eax, [rax+rax*8]
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	lea eax, [rax+rax*4]
+	shl eax, 1
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	lea eax, [rax+rax*4]
+	shl eax, 1
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	lea eax, [rax+rax*2]
+	shl eax, 2
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	lea eax, [rax+rax*2]
+	shl eax, 2
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	lea eax, [rax+rax*8]
+	shl eax, 1
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	lea eax, [rax+rax*8]
+	shl eax, 1
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	lea eax, [rax+rax*2]
+	shl eax, 3
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	lea eax, [rax+rax*2]
+	shl eax, 3
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	lea eax, [rax+rax*4]
+	shl eax, 3
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	lea eax, [rax+rax*4]
+	shl eax, 3
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	lea eax, [rax+rax*8]
+	shl eax, 3
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	lea eax, [rax+rax*8]
+	shl eax, 3
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	imul eax, eax, 100
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	imul eax, eax, 100
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	imul eax, eax, 1000
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	imul eax, eax, 1000
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	shl eax, 16
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	shl eax, 16
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	imul eax, eax, 7
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	imul eax, eax, 7
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop r11
+	mov eax, r8d
+	imul eax, ecx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r9
+	call printnum
+	pop r9
+	pop r11
+	mov eax, 5 ; Loading number literal
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r9
+	call printnum
+	pop r9
+	pop r11
+	mov eax, 6 ; Loading number literal
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	push r11
+	push r9
+	call printnum
+	pop r9
+	pop r11
+	mov eax, r9d
+	imul eax, r9d
+	imul eax, r9d
+	mov ecx, eax
+	sar ecx, 31
+	shr ecx, 31
+	add ecx, eax
+	sar ecx, 1
+	mov eax, ecx
+	mov ecx, r11d
+	mov esi, r9d
+	push rax
+	mov eax, ecx
+	cdq
+	idiv esi
+	mov ecx, edx
+	pop rax
+	lea ecx, [rcx+rcx*4]
+	shl ecx, 1
+	add eax, ecx
+	mov [rbp-4], eax ; Storing value in memory
+	mov edi, eax
+	call printnum
+	xor eax, eax
+._U0_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop rbx
+	pop r15
+	pop r14
+	pop r13
+	pop r12
+	ret
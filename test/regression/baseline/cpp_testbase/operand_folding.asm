@@ -0,0 +1,411 @@
+section .data
+
+section .rodata
+
+section .bss
+
+section .text
+	extern printnum:function
+
+	global main:function
+	global _start:function
+
+_start:
+	call main
+	mov rdi, rax            ; Exit code (0) expects return of main to be put in rax for now
+	mov rax, 60                  ; Syscall number for exit (60)
+	syscall                      ; Make the syscall
+
+main:
+	push r12
+	push r13
+	push r14
+	push r15
+	push rbx
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 24 ; Creating space on the stack
+	mov r12d, 1 ; Loading number literal
+	mov r13d, 2 ; Loading number literal
+	mov r14d, 3 ; Loading number literal
+	mov r15d, 4 ; Loading number literal
+	mov ebx, 5 ; Loading number literal
+	mov r10d, 6 ; Loading number literal
+	mov r11d, 7 ; Loading number literal
+	mov esi, 8 ; Loading number literal
+	mov r8d, 9 ; Loading number literal
+	mov r9d, 10 ; Loading number literal
+	mov edx, 11 ; Loading number literal
+	mov eax, 12 ; Loading number literal
+	mov [rbp-4], eax ; Storing value in memory
+	mov eax, 13 ; Loading number literal
+	mov [rbp-8], eax ; Storing value in memory
+	mov eax, 14 ; Loading number literal
+	mov [rbp-12], eax ; Storing value in memory
+	mov eax, 15 ; Loading number literal
+	mov [rbp-16], eax ; Storing value in memory
+	mov eax, 16 ; Loading number literal
+	mov [rbp-20], eax ; Storing value in memory
+	mov ecx, 4294967293 ; Loading number literal
+	lea eax, [r12+7]
+	mov [rbp-24], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rdx
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, 7 ; Loading number literal
+	add eax, dword [rbp-20]
+	mov [rbp-24], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rdx
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, [rbp-20] ; Loading value from memory
+	sub eax, 20
+	mov [rbp-24], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rdx
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, [rbp-16] ; Loading value from memory
+	add eax, dword [rbp-20]
+	mov [rbp-24], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rdx
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	lea eax, [r12+r13*1]
+	sub eax, dword [rbp-20]
+	mov [rbp-24], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rdx
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, r14d
+	imul eax, r15d
+	imul eax, dword [rbp-16]
+	mov [rbp-24], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rdx
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	lea eax, [rbx+r10*1]
+	imul eax, dword [rbp-20]
+	mov [rbp-24], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rdx
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	movsx eax, cl
+	add eax, dword [rbp-20]
+	mov [rbp-24], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rdx
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, [rbp-20] ; Loading value from memory
+	movsx edi, cl
+	sub eax, edi
+	mov [rbp-24], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rdx
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	cmp dword [rbp-20], 5
+	setl al
+	movzx eax, al
+	mov [rbp-24], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rdx
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, 5 ; Loading number literal
+	cmp eax, dword [rbp-20]
+	setl al
+	movzx eax, al
+	mov [rbp-24], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rdx
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov eax, [rbp-16] ; Loading value from memory
+	cmp eax, dword [rbp-20]
+	setl al
+	movzx eax, al
+	mov [rbp-24], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rdx
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	movsx eax, cl
+	cmp eax, r12d
+	setl al
+	movzx eax, al
+	mov [rbp-24], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rdx
+	call printnum
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	cmp dword [rbp-20], 15
+	jle ._U2_end_if
+	mov edi, 100 ; Loading number literal
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rdx
+	call printnum
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+._U2_end_if:
+	cmp dword [rbp-16], 15
+	jne ._U4_end_if
+	mov edi, 200 ; Loading number literal
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rdx
+	call printnum
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+._U4_end_if:
+	xor ecx, ecx
+	cmp ecx, dword [rbp-12]
+	jge ._U6_while.end
+._U5_while:
+	lea eax, [rcx+3]
+	mov ecx, eax
+	cmp ecx, dword [rbp-12]
+	jl ._U5_while
+._U6_while.end:
+	mov edi, ecx
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rdx
+	call printnum
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	lea eax, [r12+r13*1]
+	add eax, r14d
+	add eax, r15d
+	add eax, ebx
+	add eax, r10d
+	add eax, r11d
+	add eax, esi
+	add eax, r8d
+	add eax, r9d
+	add eax, edx
+	add eax, dword [rbp-4]
+	add eax, dword [rbp-8]
+	add eax, dword [rbp-12]
+	add eax, dword [rbp-16]
+	add eax, dword [rbp-20]
+	mov [rbp-24], eax ; Storing value in memory
+	mov edi, eax
+	call printnum
+	xor eax, eax
+._U0_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop rbx
+	pop r15
+	pop r14
+	pop r13
+	pop r12
+	ret
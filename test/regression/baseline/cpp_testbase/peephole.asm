@@ -0,0 +1,113 @@
+section .data
+
+section .rodata
+
+section .bss
+
+section .text
+	extern printnum:function
+
+	global main:function
+	global _start:function
+
+_start:
+	call main
+	mov rdi, rax            ; Exit code (0) expects return of main to be put in rax for now
+	mov rax, 60                  ; Syscall number for exit (60)
+	syscall                      ; Make the syscall
+
+main:
+	push r12
+	push r13
+	push r14
+	push r15
+	push rbx
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 24 ; Creating space on the stack
+	xor r10d, r10d
+	mov edi, r10d
+	call printnum
+	mov r12d, 1 ; Loading number literal
+	mov r13d, 2 ; Loading number literal
+	mov r14d, 3 ; Loading number literal
+	mov r15d, 4 ; Loading number literal
+	mov ebx, 5 ; Loading number literal
+	mov r10d, 6 ; Loading number literal
+	mov r11d, 7 ; Loading number literal
+	mov esi, 8 ; Loading number literal
+	mov r8d, 9 ; Loading number literal
+	mov r9d, 10 ; Loading number literal
+	mov edx, 11 ; Loading number literal
+	mov eax, 12 ; Loading number literal
+	mov [rbp-4], eax ; Storing value in memory
+	mov eax, 13 ; Loading number literal
+	mov [rbp-8], eax ; Storing value in memory
+	mov eax, 14 ; Loading number literal
+	mov [rbp-12], eax ; Storing value in memory
+	mov eax, 15 ; Loading number literal
+	mov [rbp-16], eax ; Storing value in memory
+	mov eax, 16 ; Loading number literal
+	mov [rbp-20], eax ; Storing value in memory
+	lea eax, [r12+r13*1]
+	add eax, r14d
+	add eax, r15d
+	add eax, ebx
+	add eax, r10d
+	add eax, r11d
+	add eax, esi
+	add eax, r8d
+	add eax, r9d
+	add eax, edx
+	add eax, dword [rbp-4]
+	add eax, dword [rbp-8]
+	add eax, dword [rbp-12]
+	add eax, dword [rbp-16]
+	add eax, dword [rbp-20]
+	mov [rbp-24], eax ; Storing value in memory
+	mov edi, eax
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rdx
+	call printnum
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov ecx, [rbp-24] ; Loading value from memory
+	mov eax, ecx
+	add eax, dword [rbp-12]
+	mov ecx, eax
+	lea edi, [r12+r13*1]
+	add edi, r14d
+	add edi, r15d
+	add edi, ebx
+	add edi, r10d
+	add edi, r11d
+	add edi, esi
+	add edi, r8d
+	add edi, r9d
+	add edi, edx
+	add edi, dword [rbp-4]
+	add edi, dword [rbp-8]
+	add edi, dword [rbp-12]
+	add edi, dword [rbp-16]
+	add edi, dword [rbp-20]
+	add edi, ecx
+	sub edi, dword [rbp-24]
+	call printnum
+	xor eax, eax
+._U0_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop rbx
+	pop r15
+	pop r14
+	pop r13
+	pop r12
+	ret
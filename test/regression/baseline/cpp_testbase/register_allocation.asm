@@ -0,0 +1,53 @@
+section .data
+
+section .rodata
+
+section .bss
+
+section .text
+	extern printnum:function
+
+	global main:function
+	global _start:function
+
+_start:
+	call main
+	mov rdi, rax            ; Exit code (0) expects return of main to be put in rax for now
+	mov rax, 60                  ; Syscall number for exit (60)
+	syscall                      ; Make the syscall
+
+main:
+	push r12
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 8 ; Creating space on the stack
+	xor r12d, r12d
+	xor r10d, r10d
+	mov r11d, 1 ; Loading number literal
+._U2_for:
+	mov esi, r11d
+	lea eax, [r12+rsi*1]
+	mov r12d, eax
+	lea eax, [r10+1]
+	mov r10d, eax
+	lea eax, [r11+1]
+	mov r11d, eax
+	cmp r11d, 10
+	jle ._U2_for
+._U1_for.end:
+	mov edi, r10d
+	call printnum
+	mov edi, r12d
+	call printnum
+	mov edi, r12d
+	call printnum
+	mov r10d, 1 ; Loading number literal
+	mov r11d, 2 ; Loading number literal
+	lea edi, [r10+r11*1]
+	call printnum
+	xor eax, eax
+._U0_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop r12
+	ret
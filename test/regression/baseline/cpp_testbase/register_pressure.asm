@@ -0,0 +1,467 @@
+section .data
+	align 4
+	global seed:data 4
+seed:
+seed.local:
+	dd 3
+
+section .rodata
+
+section .bss
+
+section .text
+	extern printnum:function
+
+	global remainders:function
+	global crowdedDivision:function
+	global main:function
+	global _start:function
+
+_start:
+	call main
+	mov rdi, rax            ; Exit code (0) expects return of main to be put in rax for now
+	mov rax, 60                  ; Syscall number for exit (60)
+	syscall                      ; Make the syscall
+
+remainders:
+	push r12
+	push r13
+	push r14
+	push rbx
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	mov r10d, [rel seed.local] ; Loading value from memory
+	add r10d, 1
+	mov r11d, [rel seed.local] ; Loading value from memory
+	add r11d, 2
+	mov esi, [rel seed.local] ; Loading value from memory
+	add esi, 3
+	mov edi, [rel seed.local] ; Loading value from memory
+	add edi, 4
+	mov r8d, [rel seed.local] ; Loading value from memory
+	add r8d, 5
+	mov r9d, [rel seed.local] ; Loading value from memory
+	add r9d, 6
+	mov edx, [rel seed.local] ; Loading value from memory
+	add edx, 7
+	mov ecx, [rel seed.local] ; Loading value from memory
+	add ecx, 8
+	mov eax, [rel seed.local] ; Loading value from memory
+	add eax, 9
+	mov [rbp-4], eax ; Storing value in memory
+	mov eax, [rel seed.local] ; Loading value from memory
+	add eax, 10
+	mov [rbp-8], eax ; Storing value in memory
+	mov eax, [rel seed.local] ; Loading value from memory
+	add eax, 11
+	mov [rbp-12], eax ; Storing value in memory
+	mov eax, [rel seed.local] ; Loading value from memory
+	add eax, 12
+	mov [rbp-16], eax ; Storing value in memory
+	mov eax, [rel seed.local] ; Loading value from memory
+	add eax, 13
+	mov [rbp-20], eax ; Storing value in memory
+	mov r13d, 1 ; Loading number literal
+	mov eax, 2 ; Loading number literal
+	mov ebx, r10d
+	imul ebx, ebx, 31
+	add ebx, 5
+	movsxd r12, ebx
+	imul r12, r12, -1840700269
+	sar r12, 32
+	add r12d, ebx
+	sar r12d, 2
+	mov r14d, ebx
+	shr r14d, 31
+	add r12d, r14d
+	imul r12d, r12d, 7
+	sub ebx, r12d
+	cmp ebx, 2
+	cmovg r13d, eax
+	mov r12d, r10d
+	imul r12d, r12d, 31
+	add r12d, 5
+	movsxd rax, r12d
+	imul rax, rax, -1840700269
+	sar rax, 32
+	add eax, r12d
+	sar eax, 2
+	mov ebx, r12d
+	shr ebx, 31
+	add eax, ebx
+	imul eax, eax, 7
+	sub r12d, eax
+	mov eax, esi
+	mov ebx, eax
+	sar ebx, 31
+	shr ebx, 30
+	add ebx, eax
+	sar ebx, 2
+	shl ebx, 2
+	sub eax, ebx
+	imul r12d, eax
+	lea eax, [r13+r12*1]
+	add eax, r10d
+	add eax, r11d
+	add eax, esi
+	add eax, edi
+	add eax, r8d
+	add eax, r9d
+	add eax, edx
+	add eax, ecx
+	add eax, dword [rbp-4]
+	add eax, dword [rbp-8]
+	add eax, dword [rbp-12]
+	add eax, dword [rbp-16]
+	add eax, dword [rbp-20]
+._U0_return:
+	pop rbp ; Restore the base pointer
+	pop rbx
+	pop r14
+	pop r13
+	pop r12
+	ret
+crowdedDivision:
+	push r12
+	push r13
+	push r14
+	push r15
+	push rbx
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 8 ; Creating space on the stack
+	mov r12d, edi
+	mov r13d, edx
+	mov r14d, dword [rsp+64] ; Loading stack argument
+	mov r15d, r13d
+	mov eax, r12d
+	mov edx, eax
+	sar edx, 31
+	shr edx, 31
+	add edx, eax
+	sar edx, 1
+	shl edx, 1
+	sub eax, edx
+	mov edx, r12d
+	mov r10d, r9d
+	test r10, r10
+	jne ._U4_logical.shortcut
+	mov edi, r13d
+	test rdi, rdi
+	setne dil
+	movzx edi, dil
+	jmp ._U5_logical.end
+._U4_logical.shortcut:
+	mov edi, 1 ; Loading number literal
+._U5_logical.end:
+	cmp edx, edi
+	setne dl
+	movzx edx, dl
+	add eax, edx
+	test rax, rax
+	je ._U3_end_if
+	mov ebx, 4 ; Loading number literal
+	mov r10d, esi
+	cmp esi, 1
+	setg al
+	movzx eax, al
+	sub r10d, eax
+	mov r11d, ecx
+	movsxd rax, r11d
+	imul rax, rax, 1717986919
+	sar rax, 32
+	sar eax, 1
+	mov edx, r11d
+	shr edx, 31
+	add eax, edx
+	imul eax, eax, 5
+	sub r11d, eax
+	add r11d, 6
+._U6_do_while:
+	mov eax, r10d
+	test rax, rax
+	jne ._U8_logical.shortcut
+	mov edi, r12d
+	push rcx ; Spilling register
+	mov ecx, r11d
+	mov eax, edi
+	cdq
+	idiv ecx
+	mov edi, eax
+	pop rcx ; Reloading spilled register
+	imul edi, r14d
+	test rdi, rdi
+	setne dil
+	movzx edi, dil
+	jmp ._U9_logical.end
+._U8_logical.shortcut:
+	mov edi, 1 ; Loading number literal
+._U9_logical.end:
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rcx
+	call printnum
+	pop rcx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	lea eax, [rbx-1]
+	mov ebx, eax
+	cmp ebx, 0
+	jg ._U6_do_while
+._U7_do_while.end:
+	mov eax, r12d
+	mov edx, r15d
+	test rdx, rdx
+	jne ._U10_logical.shortcut
+	mov ecx, r15d
+	test rcx, rcx
+	setne cl
+	movzx ecx, cl
+	jmp ._U11_logical.end
+._U10_logical.shortcut:
+	mov ecx, 1 ; Loading number literal
+._U11_logical.end:
+	sub ecx, r13d
+	cmp eax, ecx
+	setg al
+	movzx eax, al
+	mov r9d, eax
+	mov edi, esi
+	push r8
+	push r9
+	call printnum
+	pop r9
+	pop r8
+	xor r13d, r13d
+	mov eax, r12d
+	movsxd rcx, eax
+	imul rcx, rcx, 954437177
+	sar rcx, 32
+	sar ecx, 1
+	mov edx, eax
+	shr edx, 31
+	add ecx, edx
+	imul ecx, ecx, 9
+	sub eax, ecx
+	mov r12d, eax
+	cmp r13d, r12d
+	jge ._U12_for.end
+._U13_for:
+	mov edi, r8d
+	push r8
+	push r9
+	call printnum
+	pop r9
+	pop r8
+	lea eax, [r13+1]
+	mov r13d, eax
+	cmp r13d, r12d
+	jl ._U13_for
+._U12_for.end:
+._U3_end_if:
+	mov eax, r9d
+._U1_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop rbx
+	pop r15
+	pop r14
+	pop r13
+	pop r12
+	ret
+main:
+	push r12
+	push r13
+	push r14
+	push r15
+	push rbx
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 24 ; Creating space on the stack
+	mov r12d, 1 ; Loading number literal
+	mov eax, 2 ; Loading number literal
+	mov [rbp-4], eax ; Storing value in memory
+	mov eax, 3 ; Loading number literal
+	mov [rbp-8], eax ; Storing value in memory
+	mov eax, 4 ; Loading number literal
+	mov [rbp-12], eax ; Storing value in memory
+	mov eax, 5 ; Loading number literal
+	mov [rbp-16], eax ; Storing value in memory
+	mov r10d, 6 ; Loading number literal
+	mov r11d, 7 ; Loading number literal
+	mov esi, 8 ; Loading number literal
+	mov r8d, 9 ; Loading number literal
+	mov r9d, 10 ; Loading number literal
+	mov edx, 11 ; Loading number literal
+	mov ecx, 12 ; Loading number literal
+	mov r13d, 13 ; Loading number literal
+	mov eax, 14 ; Loading number literal
+	mov [rbp-20], eax ; Storing value in memory
+	mov edi, r12d
+	add edi, dword [rbp-4]
+	add edi, dword [rbp-8]
+	add edi, dword [rbp-12]
+	add edi, dword [rbp-16]
+	add edi, r10d
+	add edi, r11d
+	add edi, esi
+	add edi, r8d
+	add edi, r9d
+	add edi, edx
+	add edi, ecx
+	add edi, r13d
+	add edi, dword [rbp-20]
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rdx
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	xor r14d, r14d
+	xor r15d, r15d
+	mov ebx, [rbp-8] ; Loading value from memory
+	add ebx, dword [rbp-12]
+	mov r15d, ebx
+	add ebx, dword [rbp-4]
+	mov r14d, ebx
+	add ebx, r12d
+	mov edi, ebx
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rdx
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov edi, r14d
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rdx
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov edi, r15d
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rdx
+	push rcx
+	sub rsp, 8 ; Aligning the stack for the call
+	call printnum
+	add rsp, 8
+	pop rcx
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	mov edi, r12d
+	add edi, dword [rbp-4]
+	add edi, dword [rbp-8]
+	add edi, dword [rbp-12]
+	add edi, dword [rbp-16]
+	add edi, r10d
+	add edi, r11d
+	add edi, esi
+	add edi, r8d
+	add edi, r9d
+	add edi, edx
+	add edi, ecx
+	add edi, r13d
+	add edi, dword [rbp-20]
+	sub edi, dword [rbp-20]
+	sub edi, r13d
+	sub edi, ecx
+	sub edi, edx
+	sub edi, r9d
+	sub edi, r8d
+	sub edi, esi
+	sub edi, r11d
+	sub edi, r10d
+	sub edi, dword [rbp-16]
+	sub edi, dword [rbp-12]
+	sub edi, dword [rbp-8]
+	sub edi, dword [rbp-4]
+	call printnum
+	mov edi, [rbp-20] ; Loading value from memory
+	call printnum
+	call remainders
+	mov edi, eax
+	call printnum
+	mov edi, 7 ; Loading number literal
+	mov esi, 1 ; Loading number literal
+	mov edx, 2 ; Loading number literal
+	mov ecx, 3 ; Loading number literal
+	mov r8d, 4 ; Loading number literal
+	mov r9d, 5 ; Loading number literal
+	sub rsp, 16 ; Reserving the stack arguments
+	mov eax, 6 ; Loading number literal
+	mov [rsp], rax ; Stack argument
+	call crowdedDivision
+	add rsp, 16
+	mov edi, eax
+	call printnum
+	mov edi, 8 ; Loading number literal
+	xor esi, esi
+	xor edx, edx
+	mov ecx, 13 ; Loading number literal
+	mov r8d, 4 ; Loading number literal
+	xor r9d, r9d
+	sub rsp, 16 ; Reserving the stack arguments
+	mov eax, 6 ; Loading number literal
+	mov [rsp], rax ; Stack argument
+	call crowdedDivision
+	add rsp, 16
+	mov edi, eax
+	call printnum
+	xor eax, eax
+._U14_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop rbx
+	pop r15
+	pop r14
+	pop r13
+	pop r12
+	ret
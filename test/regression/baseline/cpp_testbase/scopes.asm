@@ -16,11 +16,5 @@ _start:
 	syscall                      ; Make the syscall
 
 main:
-	push rbp                 ; Save the base pointer
-	mov rbp, rsp              ; Set base pointer to current stack pointer
-	sub rsp, 4 ; Creating space on the stack
-	sub rsp, 4 ; Creating space on the stack
-	sub rsp, 4 ; Creating space on the stack
-	mov rsp, rbp              ; Restoring stack pointer
-	pop rbp                   ; Restore the base pointer
+._U0_return:
 	ret
@@ -0,0 +1,169 @@
+section .data
+
+section .rodata
+
+section .bss
+
+section .text
+	extern printnum:function
+
+	global main:function
+	global _start:function
+
+_start:
+	call main
+	mov rdi, rax            ; Exit code (0) expects return of main to be put in rax for now
+	mov rax, 60                  ; Syscall number for exit (60)
+	syscall                      ; Make the syscall
+
+main:
+	push r12
+	push r13
+	push r14
+	push r15
+	push rbx
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 24 ; Creating space on the stack
+	mov r12d, 1 ; Loading number literal
+	mov r13d, 2 ; Loading number literal
+	mov r14d, 3 ; Loading number literal
+	mov r15d, 4 ; Loading number literal
+	mov ebx, 5 ; Loading number literal
+	mov r10d, 6 ; Loading number literal
+	mov r11d, 7 ; Loading number literal
+	mov esi, 8 ; Loading number literal
+	mov r8d, 9 ; Loading number literal
+	mov r9d, 10 ; Loading number literal
+	mov edx, 11 ; Loading number literal
+	mov eax, 12 ; Loading number literal
+	mov [rbp-8], eax ; Storing value in memory
+	mov eax, 13 ; Loading number literal
+	mov [rbp-12], eax ; Storing value in memory
+	mov eax, 14 ; Loading number literal
+	mov [rbp-16], eax ; Storing value in memory
+	mov eax, r12d
+	test rax, rax
+	je ._U1_else
+	lea ecx, [r12+r13*1]
+	mov edi, ecx
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rdx
+	call printnum
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	jmp ._U2_end_if
+._U1_else:
+	lea ecx, [r14+r15*1]
+	mov edi, ecx
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rdx
+	call printnum
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+._U2_end_if:
+	lea eax, [r12-1]
+	test rax, rax
+	je ._U3_else
+	lea ecx, [r12+r13*1]
+	mov edi, ecx
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rdx
+	call printnum
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	jmp ._U4_end_if
+._U3_else:
+	lea ecx, [r14+r15*1]
+	mov edi, ecx
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rdx
+	call printnum
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+._U4_end_if:
+	xor eax, eax
+	mov [rbp-4], eax ; Storing value in memory
+	cmp dword [rbp-4], 200
+	jge ._U6_while.end
+._U5_while:
+	mov ecx, [rbp-4] ; Loading value from memory
+	add ecx, 1
+	mov eax, ecx
+	mov [rbp-4], eax ; Storing value in memory
+	cmp dword [rbp-4], 200
+	jl ._U5_while
+._U6_while.end:
+	mov edi, [rbp-4] ; Loading value from memory
+	push r10
+	push r11
+	push rsi
+	push r8
+	push r9
+	push rdx
+	call printnum
+	pop rdx
+	pop r9
+	pop r8
+	pop rsi
+	pop r11
+	pop r10
+	lea edi, [r12+r13*1]
+	add edi, r14d
+	add edi, r15d
+	add edi, ebx
+	add edi, r10d
+	add edi, r11d
+	add edi, esi
+	add edi, r8d
+	add edi, r9d
+	add edi, edx
+	add edi, dword [rbp-8]
+	add edi, dword [rbp-12]
+	add edi, dword [rbp-16]
+	add edi, dword [rbp-4]
+	sub edi, dword [rbp-4]
+	add edi, 15
+	call printnum
+	xor eax, eax
+._U0_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop rbx
+	pop r15
+	pop r14
+	pop r13
+	pop r12
+	ret
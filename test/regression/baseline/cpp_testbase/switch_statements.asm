@@ -0,0 +1,289 @@
+section .data
+
+section .rodata
+align 8
+pick._U12_jump_table:
+	dq pick._U8_case
+	dq pick._U9_case
+	dq pick._U10_case
+	dq pick._U11_case
+
+align 8
+main._U24_jump_table:
+	dq main._U17_case
+	dq main._U18_case
+	dq main._U19_case
+	dq main._U20_case
+	dq main._U21_case
+	dq main._U23_default
+	dq main._U22_case
+
+align 8
+main._U44_jump_table:
+	dq main._U39_case
+	dq main._U40_case
+	dq main._U41_case
+	dq main._U43_default
+	dq main._U43_default
+	dq main._U42_case
+
+
+section .bss
+
+section .text
+	extern printnum:function
+
+	global pick:function
+	global main:function
+	global _start:function
+
+_start:
+	call main
+	mov rdi, rax            ; Exit code (0) expects return of main to be put in rax for now
+	mov rax, 60                  ; Syscall number for exit (60)
+	syscall                      ; Make the syscall
+
+pick:
+	push r12
+	push r13
+	push r14
+	push r15
+	push rbx
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 4 ; Creating space on the stack
+	xor eax, eax
+	mov [rbp-4], eax ; Storing value in memory
+	mov eax, edi
+	cmp eax, 3
+	ja ._U7_switch.end
+	lea rcx, [rel pick._U12_jump_table]
+	jmp qword [rcx+rax*8]
+._U8_case:
+	mov eax, 10 ; Loading number literal
+	mov [rbp-4], eax ; Storing value in memory
+	jmp ._U7_switch.end
+._U9_case:
+	mov eax, 11 ; Loading number literal
+	mov [rbp-4], eax ; Storing value in memory
+	jmp ._U7_switch.end
+._U10_case:
+	mov eax, 12 ; Loading number literal
+	mov [rbp-4], eax ; Storing value in memory
+	jmp ._U7_switch.end
+._U11_case:
+	mov eax, 13 ; Loading number literal
+	mov [rbp-4], eax ; Storing value in memory
+._U7_switch.end:
+;-- START -- asm binding requests
+;-- START -- user defined
+nop
+;-- END -- user defined
+	mov eax, [rbp-4] ; Loading value from memory
+._U0_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop rbx
+	pop r15
+	pop r14
+	pop r13
+	pop r12
+	ret
+main:
+	push r12
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 8 ; Creating space on the stack
+	xor r10d, r10d
+	mov r11d, 4294967294 ; Loading number literal
+	cmp r11d, 10
+	jge ._U14_for.end
+._U15_for:
+	mov eax, r11d
+	cmp eax, 6
+	ja ._U23_default
+	lea rcx, [rel main._U24_jump_table]
+	jmp qword [rcx+rax*8]
+._U17_case:
+	lea eax, [r10+1]
+	mov r10d, eax
+	jmp ._U16_switch.end
+._U18_case:
+	lea eax, [r10+10]
+	mov r10d, eax
+._U19_case:
+	lea eax, [r10+100]
+	mov r10d, eax
+	jmp ._U16_switch.end
+._U20_case:
+._U21_case:
+	lea eax, [r10+1000]
+	mov r10d, eax
+	jmp ._U16_switch.end
+._U22_case:
+	lea eax, [r10+10000]
+	mov r10d, eax
+	jmp ._U16_switch.end
+._U23_default:
+	lea eax, [r10+7]
+	mov r10d, eax
+._U16_switch.end:
+	lea eax, [r11+1]
+	mov r11d, eax
+	cmp r11d, 10
+	jl ._U15_for
+._U14_for.end:
+	mov edi, r10d
+	call printnum
+	xor r10d, r10d
+	xor r11d, r11d
+._U26_for:
+	mov eax, r11d
+	imul eax, eax, 7
+	cmp eax, 1400
+	je ._U31_case
+	jg ._U35_switch.upper
+	cmp eax, 7
+	je ._U28_case
+	cmp eax, 70
+	je ._U29_case
+	cmp eax, 700
+	je ._U30_case
+	jmp ._U27_switch.end
+._U35_switch.upper:
+	cmp eax, 2100
+	je ._U32_case
+	cmp eax, 7000
+	je ._U33_case
+	cmp eax, 13993
+	je ._U34_case
+	jmp ._U27_switch.end
+._U28_case:
+	lea eax, [r10+1]
+	mov r10d, eax
+	jmp ._U27_switch.end
+._U29_case:
+	lea eax, [r10+2]
+	mov r10d, eax
+	jmp ._U27_switch.end
+._U30_case:
+	lea eax, [r10+3]
+	mov r10d, eax
+	jmp ._U27_switch.end
+._U31_case:
+	lea eax, [r10+4]
+	mov r10d, eax
+	jmp ._U27_switch.end
+._U32_case:
+	lea eax, [r10+5]
+	mov r10d, eax
+	jmp ._U27_switch.end
+._U33_case:
+	lea eax, [r10+6]
+	mov r10d, eax
+	jmp ._U27_switch.end
+._U34_case:
+	lea eax, [r10+7]
+	mov r10d, eax
+._U27_switch.end:
+	lea eax, [r11+1]
+	mov r11d, eax
+	cmp r11d, 2000
+	jl ._U26_for
+._U25_for.end:
+	mov edi, r10d
+	call printnum
+	xor r10d, r10d
+	mov r11d, 4294967293 ; Loading number literal
+	cmp r11d, 4
+	jge ._U36_for.end
+._U37_for:
+	mov eax, r11d
+	sub eax, -3
+	cmp eax, 5
+	ja ._U43_default
+	lea rcx, [rel main._U44_jump_table]
+	jmp qword [rcx+rax*8]
+._U39_case:
+	lea eax, [r10+1]
+	mov r10d, eax
+	jmp ._U38_switch.end
+._U40_case:
+	lea eax, [r10+2]
+	mov r10d, eax
+	jmp ._U38_switch.end
+._U41_case:
+	lea eax, [r10+4]
+	mov r10d, eax
+	jmp ._U38_switch.end
+._U42_case:
+	lea eax, [r10+8]
+	mov r10d, eax
+	jmp ._U38_switch.end
+._U43_default:
+	lea eax, [r10+100]
+	mov r10d, eax
+._U38_switch.end:
+	lea eax, [r11+1]
+	mov r11d, eax
+	cmp r11d, 4
+	jl ._U37_for
+._U36_for.end:
+	mov edi, r10d
+	call printnum
+	mov r12d, 5 ; Loading number literal
+	mov eax, r12d
+	cmp eax, 5
+	je ._U47_case
+._U46_default:
+	xor edi, edi
+	call printnum
+	jmp ._U45_switch.end
+._U47_case:
+	mov edi, 5 ; Loading number literal
+	call printnum
+._U45_switch.end:
+	mov eax, r12d
+._U48_switch.end:
+	xor r10d, r10d
+	cmp r10d, 100
+	jge ._U50_while.end
+._U49_while:
+	cmp r10d, 13
+	jne ._U52_end_if
+	jmp ._U50_while.end
+._U52_end_if:
+	lea eax, [r10+1]
+	mov r10d, eax
+	cmp r10d, 100
+	jl ._U49_while
+._U50_while.end:
+	mov edi, r10d
+	call printnum
+	xor r10d, r10d
+._U53_do_while:
+	lea eax, [r10+3]
+	mov r10d, eax
+	cmp r10d, 20
+	jle ._U56_end_if
+	jmp ._U54_do_while.end
+._U56_end_if:
+	cmp r10d, 100
+	jl ._U53_do_while
+._U54_do_while.end:
+	mov edi, r10d
+	call printnum
+	mov edi, 2 ; Loading number literal
+	call pick
+	mov edi, eax
+	call printnum
+	mov edi, 7 ; Loading number literal
+	call pick
+	mov edi, eax
+	call printnum
+	xor eax, eax
+._U13_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop r12
+	ret
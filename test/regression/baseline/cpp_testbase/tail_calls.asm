@@ -0,0 +1,337 @@
+section .data
+
+section .rodata
+
+section .bss
+
+section .text
+	extern printnum:function
+
+	global seven:function
+	global three:function
+	global four:function
+	global sum:function
+	global forward:function
+	global forwardTwice:function
+	global pickFour:function
+	global letter:function
+	global fromChar:function
+	global ten:function
+	global nine:function
+	global fact:function
+	global id:function
+	global offsetPair:function
+	global clampBelow:function
+	global main:function
+	global _start:function
+
+_start:
+	call main
+	mov rdi, rax            ; Exit code (0) expects return of main to be put in rax for now
+	mov rax, 60                  ; Syscall number for exit (60)
+	syscall                      ; Make the syscall
+
+seven:
+	mov eax, 7 ; Loading number literal
+._U0_return:
+	ret
+three:
+	mov eax, 3 ; Loading number literal
+._U1_return:
+	ret
+four:
+	mov eax, 4 ; Loading number literal
+._U2_return:
+	ret
+four.d:
+	mov eax, 4 ; Loading number literal
+._U3_return:
+	ret
+sum:
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	call seven
+	push rax
+	sub rsp, 8 ; Aligning the stack for the call
+	call three
+	add rsp, 8
+	mov ecx, eax
+	pop rax
+	add eax, ecx
+._U4_return:
+	pop rbp ; Restore the base pointer
+	ret
+forward:
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	pop rbp ; Restore the base pointer
+	jmp sum ; Tail call
+._U5_return:
+	pop rbp ; Restore the base pointer
+	ret
+forwardTwice:
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	pop rbp ; Restore the base pointer
+	jmp forward ; Tail call
+._U6_return:
+	pop rbp ; Restore the base pointer
+	ret
+pickFour:
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	call seven
+	mov edi, eax
+	pop rbp ; Restore the base pointer
+	jmp four ; Tail call
+._U7_return:
+	pop rbp ; Restore the base pointer
+	ret
+letter:
+	mov eax, 65 ; Loading number literal
+._U8_return:
+	ret
+fromChar:
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	call letter
+	movsx eax, al
+._U9_return:
+	pop rbp ; Restore the base pointer
+	ret
+ten:
+	mov eax, 10 ; Loading number literal
+._U10_return:
+	ret
+nine:
+	mov r10d, 4 ; Loading number literal
+	mov r11d, 5 ; Loading number literal
+	lea eax, [r10+r11*1]
+._U11_return:
+	ret
+fact:
+	push r12
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 8 ; Creating space on the stack
+	mov r12d, edi
+	cmp r12d, 1
+	jg ._U14_end_if
+	mov eax, 1 ; Loading number literal
+	jmp ._U12_return
+._U14_end_if:
+	lea edi, [r12-1]
+	call fact
+	imul eax, r12d
+._U12_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop r12
+	ret
+id:
+	mov eax, edi
+._U15_return:
+	ret
+offsetPair:
+	mov r10d, edi
+	imul r10d, esi
+	lea r11d, [rdi+rsi*1]
+	mov eax, r11d
+	sub eax, r10d
+	sub eax, 40
+._U16_return:
+	ret
+offsetPair._.k3:
+	mov r10d, edi
+	lea r10d, [r10+r10*2]
+	lea r11d, [rdi+3]
+	mov eax, r11d
+	sub eax, r10d
+	sub eax, 40
+._U17_return:
+	ret
+clampBelow:
+	push r12
+	push r13
+	push r14
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	sub rsp, 8 ; Creating space on the stack
+	mov r12d, edi
+	mov r13d, 3 ; Loading number literal
+	cmp r13d, 0
+	jle ._U20_while.end
+._U19_while:
+	lea eax, [r13-1]
+	mov r13d, eax
+	mov r14d, esi
+	mov edi, r12d
+	push rsi
+	sub rsp, 8 ; Aligning the stack for the call
+	call offsetPair._.k3
+	add rsp, 8
+	pop rsi
+	cmp r14d, eax
+	setl r14b
+	movzx r14d, r14b
+	sub r14d, 1
+	mov eax, r14d
+	mov esi, eax
+	cmp r13d, 0
+	jg ._U19_while
+._U20_while.end:
+	mov eax, esi
+._U18_return:
+	mov rsp, rbp ; Restoring stack pointer
+	pop rbp ; Restore the base pointer
+	pop r14
+	pop r13
+	pop r12
+	ret
+main:
+	push r12
+	push r13
+	push rbp ; Save the base pointer
+	mov rbp, rsp ; Set base pointer to current stack pointer
+	mov r12d, 5 ; Loading number literal
+	call seven
+	mov edi, eax
+	add edi, r12d
+	call printnum
+	call seven
+	mov edi, eax
+	push rdi
+	sub rsp, 8 ; Aligning the stack for the call
+	call three
+	add rsp, 8
+	pop rdi
+	imul edi, eax
+	push rdi
+	sub rsp, 8 ; Aligning the stack for the call
+	call sum
+	add rsp, 8
+	pop rdi
+	sub edi, eax
+	call printnum
+	push rdi
+	push rax
+	call sum
+	mov ecx, eax
+	pop rax
+	pop rdi
+	push rdi
+	push rcx
+	push rax
+	sub rsp, 8 ; Aligning the stack for the call
+	call seven
+	add rsp, 8
+	mov edx, eax
+	pop rax
+	pop rcx
+	pop rdi
+	add ecx, edx
+	push rdi
+	push rcx
+	call three
+	pop rcx
+	pop rdi
+	imul eax, ecx
+	push rax
+	sub rsp, 8 ; Aligning the stack for the call
+	call seven
+	add rsp, 8
+	mov edi, eax
+	pop rax
+	add edi, eax
+	call printnum
+	call seven
+	mov edi, eax
+	call four
+	mov edi, eax
+	add edi, r12d
+	call printnum
+	call three
+	mov edi, eax
+	push rdi
+	sub rsp, 8 ; Aligning the stack for the call
+	call four.d
+	add rsp, 8
+	pop rdi
+	add edi, eax
+	call four
+	mov edi, eax
+	imul edi, r12d
+	call printnum
+	call forwardTwice
+	mov r13d, eax
+	mov edi, r13d
+	call printnum
+	call pickFour
+	mov edi, eax
+	call printnum
+	call fromChar
+	mov edi, eax
+	call printnum
+	call ten
+	mov r13d, eax
+	call nine
+	mov edi, eax
+	imul edi, r13d
+	call printnum
+	mov edi, 10 ; Loading number literal
+	call fact
+	mov edi, eax
+	call printnum
+	mov edi, r13d
+	call id
+	mov edi, eax
+	add edi, r13d
+	call printnum
+	call seven
+	push rax
+	sub rsp, 8 ; Aligning the stack for the call
+	call three
+	add rsp, 8
+	mov ecx, eax
+	pop rax
+	cmp eax, ecx
+	jle ._U23_end_if
+	mov edi, 1 ; Loading number literal
+	call printnum
+._U23_end_if:
+	mov eax, r12d
+	push rax
+	sub rsp, 8 ; Aligning the stack for the call
+	call seven
+	add rsp, 8
+	mov ecx, eax
+	pop rax
+	cmp eax, ecx
+	jge ._U25_while.end
+._U24_while:
+	lea eax, [r12+1]
+	mov r12d, eax
+	mov eax, r12d
+	push rax
+	sub rsp, 8 ; Aligning the stack for the call
+	call seven
+	add rsp, 8
+	mov ecx, eax
+	pop rax
+	cmp eax, ecx
+	jl ._U24_while
+._U25_while.end:
+	mov edi, r12d
+	call printnum
+	mov edi, 4294967287 ; Loading number literal
+	mov esi, 2 ; Loading number literal
+	call clampBelow
+	mov edi, eax
+	call printnum
+	call forward
+	sub eax, 10
+._U21_return:
+	pop rbp ; Restore the base pointer
+	pop r13
+	pop r12
+	ret